@@ -285,8 +285,9 @@ void Catalog::setTableComment(table_id_t tableID, const std::string& comment) {
 }
 
 CatalogContent* Catalog::getVersion(Transaction* tx) const {
-    return tx->getType() == TransactionType::READ_ONLY ? readOnlyVersion.get() :
-                                                         readWriteVersion.get();
+    return (tx->getType() == TransactionType::READ_ONLY || readWriteVersion == nullptr) ?
+               readOnlyVersion.get() :
+               readWriteVersion.get();
 }
 
 } // namespace catalog
@@ -26,6 +26,21 @@ bool isExpressionComparison(ExpressionType type) {
            ExpressionType::LESS_THAN == type || ExpressionType::LESS_THAN_EQUALS == type;
 }
 
+ExpressionType reverseComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return type;
+    }
+}
+
 bool isExpressionNullOperator(ExpressionType type) {
     return ExpressionType::IS_NULL == type || ExpressionType::IS_NOT_NULL == type;
 }
@@ -31,6 +31,17 @@ std::string FileSystem::getFileExtension(const std::filesystem::path& path) {
     return path.extension().string();
 }
 
+void FileSystem::executeIORequests(const std::vector<FileIORequest>& requests) const {
+    for (auto& request : requests) {
+        KU_ASSERT(request.fileInfo->fileSystem == this);
+        if (request.type == FileIOType::READ) {
+            readFromFile(request.fileInfo, request.buffer, request.numBytes, request.offset);
+        } else {
+            writeFile(request.fileInfo, request.buffer, request.numBytes, request.offset);
+        }
+    }
+}
+
 void FileSystem::writeFile(FileInfo* /*fileInfo*/, const uint8_t* /*buffer*/, uint64_t /*numBytes*/,
     uint64_t /*offset*/) const {
     KU_UNREACHABLE;
@@ -0,0 +1,195 @@
+#include "common/file_system/io_uring.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "common/assert.h"
+
+#ifdef KUZU_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+#include "common/exception/exception.h"
+#include "common/string_format.h"
+#include "common/system_message.h"
+#endif
+
+namespace kuzu {
+namespace common {
+
+#ifdef KUZU_IO_URING
+
+static int ioUringSetup(uint32_t numEntries, io_uring_params* params) {
+    return (int)syscall(__NR_io_uring_setup, numEntries, params);
+}
+
+static int ioUringEnter(int ringFD, uint32_t numToSubmit, uint32_t minNumToComplete) {
+    return (int)syscall(__NR_io_uring_enter, ringFD, numToSubmit, minNumToComplete,
+        minNumToComplete > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+}
+
+// Set once setting up a ring failed, so that other threads don't retry.
+static std::atomic<bool> isIOUringUnavailable{false};
+
+IOUring* IOUring::getThreadLocalRing() {
+    static thread_local std::unique_ptr<IOUring> ring;
+    if (ring == nullptr && !isIOUringUnavailable.load(std::memory_order_relaxed)) {
+        auto newRing = std::unique_ptr<IOUring>(new IOUring());
+        if (newRing->init()) {
+            ring = std::move(newRing);
+        } else {
+            isIOUringUnavailable.store(true, std::memory_order_relaxed);
+        }
+    }
+    return ring.get();
+}
+
+bool IOUring::init() {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ringFD = ioUringSetup(QUEUE_DEPTH, &params);
+    if (ringFD < 0) {
+        return false;
+    }
+    numSQEntries = params.sq_entries;
+    sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    auto isSingleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (isSingleMmap) {
+        sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+    }
+    auto ring = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+        ringFD, IORING_OFF_SQ_RING);
+    if (ring == MAP_FAILED) {
+        return false;
+    }
+    sqRing = (uint8_t*)ring;
+    if (isSingleMmap) {
+        cqRing = sqRing;
+    } else {
+        ring = mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFD,
+            IORING_OFF_CQ_RING);
+        if (ring == MAP_FAILED) {
+            return false;
+        }
+        cqRing = (uint8_t*)ring;
+    }
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    ring = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFD,
+        IORING_OFF_SQES);
+    if (ring == MAP_FAILED) {
+        return false;
+    }
+    sqes = ring;
+    sqTail = (uint32_t*)(sqRing + params.sq_off.tail);
+    sqMask = *(uint32_t*)(sqRing + params.sq_off.ring_mask);
+    sqArray = (uint32_t*)(sqRing + params.sq_off.array);
+    cqHead = (uint32_t*)(cqRing + params.cq_off.head);
+    cqTail = (uint32_t*)(cqRing + params.cq_off.tail);
+    cqMask = *(uint32_t*)(cqRing + params.cq_off.ring_mask);
+    cqes = cqRing + params.cq_off.cqes;
+    return true;
+}
+
+IOUring::~IOUring() {
+    if (sqes != nullptr) {
+        munmap(sqes, sqesSize);
+    }
+    if (cqRing != nullptr && cqRing != sqRing) {
+        munmap(cqRing, cqRingSize);
+    }
+    if (sqRing != nullptr) {
+        munmap(sqRing, sqRingSize);
+    }
+    if (ringFD >= 0) {
+        close(ringFD);
+    }
+}
+
+void IOUring::submitAndWait(std::vector<IOUringRequest>& requests) {
+    for (auto i = 0u; i < requests.size(); i += numSQEntries) {
+        submitAndWaitBatch(
+            requests.data() + i, std::min<uint64_t>(numSQEntries, requests.size() - i));
+    }
+}
+
+void IOUring::submitAndWaitBatch(IOUringRequest* requests, uint32_t numRequests) {
+    // The ring is only used by this thread, so the submission queue is empty and all completions
+    // belong to this batch.
+    std::vector<iovec> iovecs(numRequests);
+    auto tail = *sqTail;
+    for (auto i = 0u; i < numRequests; i++) {
+        auto& request = requests[i];
+        iovecs[i].iov_base = request.buffer;
+        iovecs[i].iov_len = request.numBytes;
+        auto idx = tail & sqMask;
+        auto sqe = (io_uring_sqe*)sqes + idx;
+        memset(sqe, 0, sizeof(io_uring_sqe));
+        // READV and WRITEV are supported by all kernels with io_uring.
+        sqe->opcode = request.isWrite ? IORING_OP_WRITEV : IORING_OP_READV;
+        sqe->fd = request.fd;
+        sqe->addr = (uint64_t)&iovecs[i];
+        sqe->len = 1;
+        sqe->off = request.offset;
+        sqe->user_data = i;
+        sqArray[idx] = idx;
+        tail++;
+    }
+    __atomic_store_n(sqTail, tail, __ATOMIC_RELEASE);
+    uint32_t numSubmitted = 0;
+    uint32_t numCompleted = 0;
+    while (numCompleted < numRequests) {
+        auto numToSubmit = numRequests - numSubmitted;
+        auto ret = ioUringEnter(ringFD, numToSubmit, numToSubmit > 0 ? 0 : 1);
+        if (ret < 0) {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                continue;
+            }
+            // LCOV_EXCL_START
+            throw Exception(stringFormat("io_uring_enter failed: {}", posixErrMessage()));
+            // LCOV_EXCL_STOP
+        }
+        numSubmitted += numToSubmit > 0 ? ret : 0;
+        auto head = *cqHead;
+        auto cqTailValue = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+        while (head != cqTailValue) {
+            auto cqe = (io_uring_cqe*)cqes + (head & cqMask);
+            requests[cqe->user_data].result = cqe->res;
+            head++;
+            numCompleted++;
+        }
+        __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+    }
+}
+
+#else
+
+IOUring* IOUring::getThreadLocalRing() {
+    return nullptr;
+}
+
+IOUring::~IOUring() = default;
+
+void IOUring::submitAndWait(std::vector<IOUringRequest>& /*requests*/) {
+    KU_UNREACHABLE;
+}
+
+bool IOUring::init() {
+    return false;
+}
+
+void IOUring::submitAndWaitBatch(IOUringRequest* /*requests*/, uint32_t /*numRequests*/) {
+    KU_UNREACHABLE;
+}
+
+#endif
+
+} // namespace common
+} // namespace kuzu
@@ -1,6 +1,7 @@
 #include "common/file_system/local_file_system.h"
 
 #include "common/cast.h"
+#include "common/file_system/io_uring.h"
 #include "common/string_utils.h"
 #include "main/client_context.h"
 #include "main/settings.h"
@@ -228,6 +229,49 @@ void LocalFileSystem::readFromFile(
 #endif
 }
 
+void LocalFileSystem::executeIORequests(const std::vector<FileIORequest>& requests) const {
+    auto ring = IOUring::getThreadLocalRing();
+    if (ring == nullptr || requests.size() <= 1) {
+        FileSystem::executeIORequests(requests);
+        return;
+    }
+#ifndef _WIN32
+    std::vector<IOUringRequest> ringRequests;
+    ringRequests.reserve(requests.size());
+    for (auto& request : requests) {
+        auto localFileInfo = ku_dynamic_cast<FileInfo*, LocalFileInfo*>(request.fileInfo);
+        // Larger requests are split by readFromFile/writeFile.
+        auto numBytes = (uint32_t)std::min<uint64_t>(request.numBytes, 1ull << 30);
+        ringRequests.push_back(IOUringRequest{localFileInfo->fd,
+            request.type == FileIOType::WRITE, request.buffer, numBytes, request.offset});
+    }
+    ring->submitAndWait(ringRequests);
+    for (auto i = 0u; i < requests.size(); i++) {
+        auto& request = requests[i];
+        auto result = ringRequests[i].result;
+        if (result < 0) {
+            // LCOV_EXCL_START
+            throw Exception(stringFormat("Cannot {} file: {} numBytes: {} offset: {}. Error: {}",
+                request.type == FileIOType::READ ? "read from" : "write to", request.fileInfo->path,
+                request.numBytes, request.offset, systemErrMessage(-result)));
+            // LCOV_EXCL_STOP
+        }
+        // Short reads and writes are completed synchronously. For reads, this also checks whether
+        // the end of the file was reached.
+        if ((uint64_t)result < request.numBytes) {
+            auto buffer = request.buffer + result;
+            auto numBytes = request.numBytes - result;
+            auto offset = request.offset + result;
+            if (request.type == FileIOType::READ) {
+                readFromFile(request.fileInfo, buffer, numBytes, offset);
+            } else {
+                writeFile(request.fileInfo, buffer, numBytes, offset);
+            }
+        }
+    }
+#endif
+}
+
 int64_t LocalFileSystem::readFile(FileInfo* fileInfo, void* buf, size_t nbyte) const {
     auto localFileInfo = ku_dynamic_cast<FileInfo*, LocalFileInfo*>(fileInfo);
 #if defined(_WIN32)
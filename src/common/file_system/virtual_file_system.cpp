@@ -1,5 +1,7 @@
 #include "common/file_system/virtual_file_system.h"
 
+#include <algorithm>
+
 #include "common/assert.h"
 #include "common/file_system/local_file_system.h"
 #include "main/client_context.h"
@@ -41,6 +43,23 @@ bool VirtualFileSystem::fileOrPathExists(const std::string& path) const {
     return findFileSystem(path)->fileOrPathExists(path);
 }
 
+void VirtualFileSystem::executeIORequests(const std::vector<FileIORequest>& requests) const {
+    std::vector<std::pair<FileSystem*, std::vector<FileIORequest>>> requestsPerFileSystem;
+    for (auto& request : requests) {
+        auto fileSystem = request.fileInfo->fileSystem;
+        auto it = std::find_if(requestsPerFileSystem.begin(), requestsPerFileSystem.end(),
+            [&](const auto& entry) { return entry.first == fileSystem; });
+        if (it == requestsPerFileSystem.end()) {
+            requestsPerFileSystem.emplace_back(fileSystem, std::vector<FileIORequest>{});
+            it = requestsPerFileSystem.end() - 1;
+        }
+        it->second.push_back(request);
+    }
+    for (auto& [fileSystem, fileSystemRequests] : requestsPerFileSystem) {
+        fileSystem->executeIORequests(fileSystemRequests);
+    }
+}
+
 void VirtualFileSystem::readFromFile(
     FileInfo* /*fileInfo*/, void* /*buffer*/, uint64_t /*numBytes*/, uint64_t /*position*/) const {
     KU_UNREACHABLE;
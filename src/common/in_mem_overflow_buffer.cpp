@@ -1,11 +1,13 @@
 #include "common/in_mem_overflow_buffer.h"
 
+#include <bit>
+
 namespace kuzu {
 namespace common {
 
 uint8_t* InMemOverflowBuffer::allocateSpace(uint64_t size) {
     if (requireNewBlock(size)) {
-        allocateNewBlock();
+        allocateNewBlock(size);
     }
     KU_ASSERT(size <= BufferPoolConstants::PAGE_256KB_SIZE);
     auto data = currentBlock->block->buffer + currentBlock->currentOffset;
@@ -13,12 +15,29 @@ uint8_t* InMemOverflowBuffer::allocateSpace(uint64_t size) {
     return data;
 }
 
-void InMemOverflowBuffer::allocateNewBlock() {
+void InMemOverflowBuffer::allocateNewBlock(uint64_t sizeToAllocate) {
+    auto blockSize = storage::MemoryManager::MIN_BUFFER_SIZE;
+    if (currentBlock != nullptr) {
+        blockSize = std::min(2 * currentBlock->size, BufferPoolConstants::PAGE_256KB_SIZE);
+    }
+    blockSize = std::max(blockSize, std::bit_ceil(sizeToAllocate));
     auto newBlock = make_unique<BufferBlock>(
-        memoryManager->allocateBuffer(false /* do not initialize to zero */));
+        memoryManager->allocateBuffer(false /* do not initialize to zero */, blockSize));
     currentBlock = newBlock.get();
     blocks.push_back(std::move(newBlock));
 }
 
+void InMemOverflowBuffer::pinBlocks() {
+    for (auto& block : blocks) {
+        block->block->pin();
+    }
+}
+
+void InMemOverflowBuffer::unpinBlocks() {
+    for (auto& block : blocks) {
+        block->block->unpin();
+    }
+}
+
 } // namespace common
 } // namespace kuzu
@@ -40,14 +40,15 @@ void TaskScheduler::scheduleTaskAndWaitOrError(
             taskLck.unlock();
             break;
         }
-        if (context->clientContext->hasTimeout()) {
+        // Tasks which are not part of a query have no context, so they are never interrupted.
+        if (context != nullptr && context->clientContext->hasTimeout()) {
             timeout = context->clientContext->getTimeoutRemainingInMS();
             if (timeout == 0) {
                 context->clientContext->interrupt();
             } else {
                 timedWait = true;
             }
-        } else if (task->hasExceptionNoLock()) {
+        } else if (context != nullptr && task->hasExceptionNoLock()) {
             // Interrupt tasks that errored, so other threads can stop working on them early.
             context->clientContext->interrupt();
         }
@@ -1025,6 +1025,12 @@ void BuiltInFunctionsUtils::registerTableFunctions(CatalogSet* catalogSet) {
         SHOW_CONNECTION_FUNC_NAME, ShowConnectionFunction::getFunctionSet()));
     catalogSet->createEntry(std::make_unique<TableFunctionCatalogEntry>(
         STORAGE_INFO_FUNC_NAME, StorageInfoFunction::getFunctionSet()));
+    catalogSet->createEntry(std::make_unique<TableFunctionCatalogEntry>(
+        MEMORY_MANAGER_INFO_FUNC_NAME, MemoryManagerInfoFunction::getFunctionSet()));
+    catalogSet->createEntry(std::make_unique<TableFunctionCatalogEntry>(
+        BUFFER_MANAGER_INFO_FUNC_NAME, BufferManagerInfoFunction::getFunctionSet()));
+    catalogSet->createEntry(std::make_unique<TableFunctionCatalogEntry>(
+        BUFFER_POOL_WARM_UP_INFO_FUNC_NAME, BufferPoolWarmUpInfoFunction::getFunctionSet()));
     // Read functions
     catalogSet->createEntry(std::make_unique<TableFunctionCatalogEntry>(
         READ_PARQUET_FUNC_NAME, ParquetScanFunction::getFunctionSet()));
@@ -0,0 +1,76 @@
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+struct BufferManagerInfoBindData : public CallTableFuncBindData {
+    std::vector<FileCacheStats> stats;
+
+    BufferManagerInfoBindData(std::vector<FileCacheStats> stats,
+        std::vector<LogicalType> returnTypes, std::vector<std::string> returnColumnNames,
+        offset_t maxOffset)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames), maxOffset},
+          stats{std::move(stats)} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<BufferManagerInfoBindData>(
+            stats, columnTypes, columnNames, maxOffset);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState =
+        ku_dynamic_cast<TableFuncSharedState*, CallFuncSharedState*>(input.sharedState);
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto& stats =
+        ku_dynamic_cast<TableFuncBindData*, BufferManagerInfoBindData*>(input.bindData)->stats;
+    auto numRowsToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numRowsToOutput; i++) {
+        auto& fileStats = stats[morsel.startOffset + i];
+        dataChunk.getValueVector(0)->setValue(i, fileStats.filePath);
+        dataChunk.getValueVector(1)->setValue<int64_t>(i, fileStats.pageSize);
+        dataChunk.getValueVector(2)->setValue<int64_t>(i, fileStats.numPages);
+        dataChunk.getValueVector(3)->setValue<int64_t>(i, fileStats.stats.numCacheHits);
+        dataChunk.getValueVector(4)->setValue<int64_t>(i, fileStats.stats.numCacheMisses);
+        dataChunk.getValueVector(5)->setValue<int64_t>(i, fileStats.stats.numEvictions);
+        dataChunk.getValueVector(6)->setValue<int64_t>(i, fileStats.stats.numPrefetchedPages);
+    }
+    return numRowsToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(
+    main::ClientContext* context, TableFuncBindInput*) {
+    std::vector<std::string> columnNames;
+    std::vector<LogicalType> columnTypes;
+    columnNames.emplace_back("file_path");
+    columnTypes.emplace_back(*LogicalType::STRING());
+    for (auto columnName : {"page_size", "num_pages", "num_cache_hits", "num_cache_misses",
+             "num_evictions", "num_prefetched_pages"}) {
+        columnNames.emplace_back(columnName);
+        columnTypes.emplace_back(*LogicalType::INT64());
+    }
+    auto stats = context->getMemoryManager()->getBufferManager()->getFileCacheStats();
+    auto numFiles = stats.size();
+    return std::make_unique<BufferManagerInfoBindData>(
+        std::move(stats), std::move(columnTypes), std::move(columnNames), numFiles);
+}
+
+function_set BufferManagerInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(BUFFER_MANAGER_INFO_FUNC_NAME,
+        tableFunc, bindFunc, initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,65 @@
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/buffer_pool_warm_up.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+struct BufferPoolWarmUpInfoBindData : public CallTableFuncBindData {
+    BufferPoolWarmUpProgress progress;
+
+    BufferPoolWarmUpInfoBindData(BufferPoolWarmUpProgress progress,
+        std::vector<LogicalType> returnTypes, std::vector<std::string> returnColumnNames)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames),
+              1 /* one row */},
+          progress{progress} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<BufferPoolWarmUpInfoBindData>(progress, columnTypes, columnNames);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState =
+        ku_dynamic_cast<TableFuncSharedState*, CallFuncSharedState*>(input.sharedState);
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto& progress =
+        ku_dynamic_cast<TableFuncBindData*, BufferPoolWarmUpInfoBindData*>(input.bindData)
+            ->progress;
+    dataChunk.getValueVector(0)->setValue(0, BufferPoolWarmUpStateUtils::toString(progress.state));
+    dataChunk.getValueVector(1)->setValue<int64_t>(0, progress.numPagesToLoad);
+    dataChunk.getValueVector(2)->setValue<int64_t>(0, progress.numLoadedPages);
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(
+    main::ClientContext* context, TableFuncBindInput*) {
+    std::vector<std::string> columnNames;
+    std::vector<LogicalType> columnTypes;
+    columnNames.emplace_back("state");
+    columnTypes.emplace_back(*LogicalType::STRING());
+    for (auto columnName : {"num_pages_to_load", "num_loaded_pages"}) {
+        columnNames.emplace_back(columnName);
+        columnTypes.emplace_back(*LogicalType::INT64());
+    }
+    return std::make_unique<BufferPoolWarmUpInfoBindData>(
+        context->getBufferPoolWarmUp()->getProgress(), std::move(columnTypes),
+        std::move(columnNames));
+}
+
+function_set BufferPoolWarmUpInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(BUFFER_POOL_WARM_UP_INFO_FUNC_NAME,
+        tableFunc, bindFunc, initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
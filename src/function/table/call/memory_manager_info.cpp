@@ -0,0 +1,73 @@
+#include "function/table/call_functions.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+struct MemoryManagerInfoBindData : public CallTableFuncBindData {
+    std::vector<MemoryAllocatorStats> stats;
+
+    MemoryManagerInfoBindData(std::vector<MemoryAllocatorStats> stats,
+        std::vector<LogicalType> returnTypes, std::vector<std::string> returnColumnNames,
+        offset_t maxOffset)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames), maxOffset},
+          stats{std::move(stats)} {}
+
+    inline std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<MemoryManagerInfoBindData>(
+            stats, columnTypes, columnNames, maxOffset);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState =
+        ku_dynamic_cast<TableFuncSharedState*, CallFuncSharedState*>(input.sharedState);
+    auto morsel = sharedState->getMorsel();
+    if (!morsel.hasMoreToOutput()) {
+        return 0;
+    }
+    auto& stats =
+        ku_dynamic_cast<TableFuncBindData*, MemoryManagerInfoBindData*>(input.bindData)->stats;
+    auto numRowsToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numRowsToOutput; i++) {
+        auto& allocatorStats = stats[morsel.startOffset + i];
+        dataChunk.getValueVector(0)->setValue<int64_t>(i, allocatorStats.bufferSize);
+        dataChunk.getValueVector(1)->setValue<int64_t>(i, allocatorStats.numBuffers);
+        dataChunk.getValueVector(2)->setValue<int64_t>(i, allocatorStats.numBuffersInUse);
+        dataChunk.getValueVector(3)->setValue<int64_t>(i, allocatorStats.numAllocations);
+        dataChunk.getValueVector(4)->setValue<int64_t>(
+            i, allocatorStats.numSharedFreeListAccesses);
+    }
+    return numRowsToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(
+    main::ClientContext* context, TableFuncBindInput*) {
+    std::vector<std::string> columnNames;
+    std::vector<LogicalType> columnTypes;
+    for (auto columnName : {"buffer_size", "num_buffers", "num_buffers_in_use", "num_allocations",
+             "num_shared_free_list_accesses"}) {
+        columnNames.emplace_back(columnName);
+        columnTypes.emplace_back(*LogicalType::INT64());
+    }
+    // The stats are collected at bind time, so they don't include the buffers of this query.
+    auto stats = context->getMemoryManager()->getStats();
+    auto numSizeClasses = stats.size();
+    return std::make_unique<MemoryManagerInfoBindData>(
+        std::move(stats), std::move(columnTypes), std::move(columnNames), numSizeClasses);
+}
+
+function_set MemoryManagerInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(MEMORY_MANAGER_INFO_FUNC_NAME,
+        tableFunc, bindFunc, initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -69,7 +69,7 @@ struct BufferPoolConstants {
     static constexpr double DEFAULT_PHY_MEM_SIZE_RATIO_FOR_BM = 0.8;
     // For each PURGE_EVICTION_QUEUE_INTERVAL candidates added to the eviction queue, we will call
     // `removeNonEvictableCandidates` to remove candidates that are not evictable. See
-    // `EvictionQueue::removeNonEvictableCandidates()` for more details.
+    // `EvictionPolicy::removeNonEvictableCandidates()` for more details.
     static constexpr uint64_t EVICTION_QUEUE_PURGING_INTERVAL = 1024;
 // The default max size for a VMRegion.
 #ifdef __32BIT__
@@ -96,6 +96,11 @@ struct StorageConstants {
     static constexpr char DATA_FILE_NAME[] = "data.kz";
     static constexpr char METADATA_FILE_NAME[] = "metadata.kz";
     static constexpr char LOCK_FILE_NAME[] = ".lock";
+    // Spill files are named mm-256KB-<pid>-<id>.spill, so that databases sharing a spill directory
+    // never use the same file.
+    static constexpr char SPILL_FILE_PREFIX[] = "mm-256KB";
+    static constexpr char SPILL_FILE_SUFFIX[] = ".spill";
+    static constexpr char BUFFER_POOL_DUMP_FILE_NAME[] = "buffer_pool.dump";
 
     // The number of pages that we add at one time when we need to grow a file.
     static constexpr uint64_t PAGE_GROUP_SIZE_LOG2 = 10;
@@ -104,6 +109,9 @@ struct StorageConstants {
 
     static constexpr uint64_t NODE_GROUP_SIZE_LOG2 = 17; // 64 * 2048 nodes per group
     static constexpr uint64_t NODE_GROUP_SIZE = (uint64_t)1 << NODE_GROUP_SIZE_LOG2;
+    // Late materialized scans fall back to scanning whole pages if more than this fraction of a
+    // vector is selected.
+    static constexpr double MAX_SPARSE_LOOKUP_SELECTIVITY = 0.1;
 
     static constexpr double PACKED_CSR_DENSITY = 0.8;
     static constexpr double LEAF_LOW_CSR_DENSITY = 0.1;
@@ -167,6 +175,9 @@ struct LoggerConstants {
 struct PlannerKnobs {
     static constexpr double NON_EQUALITY_PREDICATE_SELECTIVITY = 0.1;
     static constexpr double EQUALITY_PREDICATE_SELECTIVITY = 0.01;
+    // Properties scanned after filters pushed down to a node scan are fetched with sparse lookups
+    // of the surviving nodes if the filters are estimated to select at most this fraction of nodes.
+    static constexpr double LATE_MATERIALIZATION_SELECTIVITY = 0.05;
     static constexpr uint64_t BUILD_PENALTY = 2;
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
@@ -178,6 +189,8 @@ struct ClientConfigDefault {
     static constexpr uint64_t TIMEOUT_IN_MS = 0;
     static constexpr uint32_t VAR_LENGTH_MAX_DEPTH = 30;
     static constexpr bool ENABLE_SEMI_MASK = true;
+    // 0 means the memory of queries is not limited by default.
+    static constexpr uint64_t QUERY_MEMORY_LIMIT = 0;
 };
 
 struct OrderByConstants {
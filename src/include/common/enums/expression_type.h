@@ -241,6 +241,9 @@ const char* const CURRENT_SETTING_FUNC_NAME = "CURRENT_SETTING";
 const char* const SHOW_TABLES_FUNC_NAME = "SHOW_TABLES";
 const char* const SHOW_CONNECTION_FUNC_NAME = "SHOW_CONNECTION";
 const char* const STORAGE_INFO_FUNC_NAME = "STORAGE_INFO";
+const char* const MEMORY_MANAGER_INFO_FUNC_NAME = "MEMORY_MANAGER_INFO";
+const char* const BUFFER_MANAGER_INFO_FUNC_NAME = "BUFFER_MANAGER_INFO";
+const char* const BUFFER_POOL_WARM_UP_INFO_FUNC_NAME = "BUFFER_POOL_WARM_UP_INFO";
 // Table functions - read functions
 const char* const READ_PARQUET_FUNC_NAME = "READ_PARQUET";
 const char* const READ_NPY_FUNC_NAME = "READ_NPY";
@@ -305,6 +308,8 @@ bool isExpressionUnary(ExpressionType type);
 bool isExpressionBinary(ExpressionType type);
 bool isExpressionBoolConnection(ExpressionType type);
 bool isExpressionComparison(ExpressionType type);
+// Returns the comparison with its operands swapped, e.g. `30 < a.age` becomes `a.age > 30`.
+ExpressionType reverseComparison(ExpressionType type);
 bool isExpressionNullOperator(ExpressionType type);
 bool isExpressionLiteral(ExpressionType type);
 bool isExpressionAggregate(ExpressionType type);
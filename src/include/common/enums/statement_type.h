@@ -35,6 +35,12 @@ struct StatementTypeUtils {
             return true;
         }
     }
+
+    // Only queries can write in a write transaction running concurrently with other write
+    // transactions, since other statements write to the catalog or write tables in bulk.
+    static bool allowConcurrentWriteTransaction(StatementType statementType) {
+        return statementType == StatementType::QUERY;
+    }
 };
 
 } // namespace common
@@ -15,6 +15,19 @@ namespace common {
 
 enum class FileLockType : uint8_t { NO_LOCK = 0, READ_LOCK = 1, WRITE_LOCK = 2 };
 
+enum class FileIOType : uint8_t { READ = 0, WRITE = 1 };
+
+// A read or write of a range of a file, executed as part of a batch, see
+// `FileSystem::executeIORequests`. Reads tolerate reaching the end of the file, like
+// `FileInfo::readFromFile`.
+struct FileIORequest {
+    FileIOType type;
+    FileInfo* fileInfo;
+    uint8_t* buffer;
+    uint64_t numBytes;
+    uint64_t offset;
+};
+
 class KUZU_API FileSystem {
     friend struct FileInfo;
 
@@ -43,6 +56,12 @@ public:
 
     virtual bool canHandleFile(const std::string& /*path*/) const { KU_UNREACHABLE; }
 
+    // Submits a batch of requests and waits for all of them to complete. The requests may be
+    // executed concurrently and in any order, so a request must not overlap with a write in the
+    // same batch. Throws if any of the requests fails. By default, the requests are executed one
+    // at a time.
+    virtual void executeIORequests(const std::vector<FileIORequest>& requests) const;
+
 protected:
     virtual void readFromFile(
         FileInfo* fileInfo, void* buffer, uint64_t numBytes, uint64_t position) const = 0;
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+
+struct IOUringRequest {
+    int fd;
+    bool isWrite;
+    uint8_t* buffer;
+    uint32_t numBytes;
+    uint64_t offset;
+    // Set to the number of bytes transferred, or to -errno if the request failed.
+    int64_t result = 0;
+};
+
+// A minimal io_uring (available since Linux 5.1) set up through the raw system calls, so that the
+// LocalFileSystem can keep many reads and writes in flight with a single system call instead of
+// issuing one pread/pwrite at a time.
+// A ring must only be used by one thread at a time, so each thread gets its own ring when it first
+// executes a batch. If io_uring is not compiled in (see ENABLE_IO_URING), not supported by the
+// kernel or not permitted (e.g. by the seccomp profile of a container), no ring is created, and the
+// LocalFileSystem falls back to pread/pwrite.
+class IOUring {
+public:
+    static constexpr uint32_t QUEUE_DEPTH = 64;
+
+    // Returns nullptr if io_uring is not available.
+    static IOUring* getThreadLocalRing();
+
+    ~IOUring();
+
+    // Submits the requests, QUEUE_DEPTH of them at a time, and waits until all of them have
+    // completed. Requests may complete with fewer bytes transferred than requested.
+    void submitAndWait(std::vector<IOUringRequest>& requests);
+
+private:
+    IOUring() = default;
+    bool init();
+    void submitAndWaitBatch(IOUringRequest* requests, uint32_t numRequests);
+
+private:
+    int ringFD = -1;
+    uint32_t numSQEntries = 0;
+    uint8_t* sqRing = nullptr;
+    uint64_t sqRingSize = 0;
+    uint8_t* cqRing = nullptr;
+    uint64_t cqRingSize = 0;
+    void* sqes = nullptr;
+    uint64_t sqesSize = 0;
+    uint32_t* sqTail = nullptr;
+    uint32_t sqMask = 0;
+    uint32_t* sqArray = nullptr;
+    uint32_t* cqHead = nullptr;
+    uint32_t* cqTail = nullptr;
+    uint32_t cqMask = 0;
+    void* cqes = nullptr;
+};
+
+} // namespace common
+} // namespace kuzu
@@ -44,6 +44,9 @@ public:
 
     bool fileOrPathExists(const std::string& path) const override;
 
+    // Uses the io_uring of the calling thread if it is available, see `IOUring`.
+    void executeIORequests(const std::vector<FileIORequest>& requests) const override;
+
 protected:
     void readFromFile(
         FileInfo* fileInfo, void* buffer, uint64_t numBytes, uint64_t position) const override;
@@ -30,6 +30,9 @@ public:
 
     bool fileOrPathExists(const std::string& path) const override;
 
+    // Requests are forwarded to the file systems of their files.
+    void executeIORequests(const std::vector<FileIORequest>& requests) const override;
+
 protected:
     void readFromFile(
         FileInfo* fileInfo, void* buffer, uint64_t numBytes, uint64_t position) const override;
@@ -13,7 +13,7 @@ namespace common {
 struct BufferBlock {
 public:
     explicit BufferBlock(std::unique_ptr<storage::MemoryBuffer> block)
-        : size{block->allocator->getPageSize()}, currentOffset{0}, block{std::move(block)} {}
+        : size{block->allocator->getBufferSize()}, currentOffset{0}, block{std::move(block)} {}
 
 public:
     uint64_t size;
@@ -41,15 +41,19 @@ public:
         currentBlock = other.currentBlock;
     }
 
+    // See FactorizedTable::unpinBlocks().
+    void pinBlocks();
+    void unpinBlocks();
+
     // Releases all memory accumulated for string overflows so far and re-initializes its state to
     // an empty buffer. If there is a large string that used point to any of these overflow buffers
-    // they will error.
+    // they will error. The last block is kept, since blocks grow in size and it is the largest.
     inline void resetBuffer() {
         if (!blocks.empty()) {
-            auto firstBlock = std::move(blocks[0]);
+            auto lastBlock = std::move(blocks.back());
             blocks.clear();
-            firstBlock->resetCurrentOffset();
-            blocks.push_back(std::move(firstBlock));
+            lastBlock->resetCurrentOffset();
+            blocks.push_back(std::move(lastBlock));
         }
         if (!blocks.empty()) {
             currentBlock = blocks[0].get();
@@ -67,7 +71,9 @@ private:
                (currentBlock->currentOffset + sizeToAllocate) > currentBlock->size;
     }
 
-    void allocateNewBlock();
+    // Blocks start small, since most overflow buffers only hold a few strings, and double in size
+    // up to PAGE_256KB_SIZE.
+    void allocateNewBlock(uint64_t sizeToAllocate);
 
 private:
     std::vector<std::unique_ptr<BufferBlock>> blocks;
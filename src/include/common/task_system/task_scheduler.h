@@ -45,7 +45,8 @@ public:
     // not concurrently), and throws an exception if any of the tasks errors. Regardless of
     // whether or not the given task or one of its dependencies errors, when this function
     // returns, no task related to the given task will be in the task queue. Further no worker
-    // thread will be working on the given task.
+    // thread will be working on the given task. The context is null for tasks which are not
+    // part of a query, e.g., replaying the WAL.
     void scheduleTaskAndWaitOrError(
         const std::shared_ptr<Task>& task, processor::ExecutionContext* context);
 
@@ -85,6 +85,11 @@ public:
 
     inline void setSequential() { _isSequential = true; }
     inline bool isSequential() const { return _isSequential; }
+    // Set by storage scans when every position of an unflat vector holds the same non-null value
+    // (e.g. when scanning a single run of a run-length encoded column). Consumers can then
+    // evaluate the first selected position once instead of every position.
+    inline void setConstant(bool isConstant) { _isConstant = isConstant; }
+    inline bool isConstant() const { return _isConstant; }
 
     KUZU_API void resetAuxiliaryBuffer();
 
@@ -102,6 +107,7 @@ public:
 
 private:
     bool _isSequential = false;
+    bool _isConstant = false;
     std::unique_ptr<uint8_t[]> valueBuffer;
     std::unique_ptr<NullMask> nullMask;
     uint32_t numBytesPerValue;
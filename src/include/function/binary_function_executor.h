@@ -307,6 +307,30 @@ struct BinaryFunctionExecutor {
         numSelectedValues += (resultValue == true);
     }
 
+    // Evaluates the predicate once when the unflat operand holds the same value at every position
+    // (see ValueVector::isConstant), and then selects either all or none of its positions.
+    template<class LEFT_TYPE, class RIGHT_TYPE, class FUNC, typename SELECT_WRAPPER>
+    static bool selectConstant(common::ValueVector& left, common::ValueVector& right,
+        uint64_t lPos, uint64_t rPos, const common::SelectionVector& unFlatSelVector,
+        common::SelectionVector& selVector) {
+        uint64_t numSelectedValues = 0;
+        // The result position is ignored, and shouldn't overwrite the output buffer before the
+        // selected positions are copied into it, since they may share the same buffer.
+        common::sel_t resultPos;
+        selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(
+            left, right, lPos, rPos, 0 /*resPos*/, numSelectedValues, &resultPos);
+        if (numSelectedValues == 0) {
+            selVector.selectedSize = 0;
+            return false;
+        }
+        auto selectedPositionsBuffer = selVector.getSelectedPositionsBuffer();
+        for (auto i = 0u; i < unFlatSelVector.selectedSize; ++i) {
+            selectedPositionsBuffer[i] = unFlatSelVector.selectedPositions[i];
+        }
+        selVector.selectedSize = unFlatSelVector.selectedSize;
+        return true;
+    }
+
     template<class LEFT_TYPE, class RIGHT_TYPE, class FUNC, typename SELECT_WRAPPER>
     static uint64_t selectBothFlat(common::ValueVector& left, common::ValueVector& right) {
         auto lPos = left.state->selVector->selectedPositions[0];
@@ -328,6 +352,9 @@ struct BinaryFunctionExecutor {
         auto selectedPositionsBuffer = selVector.getSelectedPositionsBuffer();
         if (left.isNull(lPos)) {
             return numSelectedValues;
+        } else if (right.isConstant() && right.state->selVector->selectedSize > 0) {
+            return selectConstant<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right, lPos,
+                right.state->selVector->selectedPositions[0], *right.state->selVector, selVector);
         } else if (right.hasNoNullsGuarantee()) {
             if (right.state->selVector->isUnfiltered()) {
                 for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
@@ -371,6 +398,10 @@ struct BinaryFunctionExecutor {
         auto selectedPositionsBuffer = selVector.getSelectedPositionsBuffer();
         if (right.isNull(rPos)) {
             return numSelectedValues;
+        } else if (left.isConstant() && left.state->selVector->selectedSize > 0) {
+            return selectConstant<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right,
+                left.state->selVector->selectedPositions[0], rPos, *left.state->selVector,
+                selVector);
         } else if (left.hasNoNullsGuarantee()) {
             if (left.state->selVector->isUnfiltered()) {
                 for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
@@ -11,7 +11,9 @@ struct EndsWith {
         common::ku_string_t& left, common::ku_string_t& right, uint8_t& result) {
         int64_t pos = 0;
         Find::operation(left, right, pos);
-        result = (pos == left.len - right.len + 1);
+        // The lengths are unsigned, so a left string shorter than the right one must be ruled out
+        // before subtracting them.
+        result = left.len >= right.len && pos == left.len - right.len + 1;
     }
 };
 
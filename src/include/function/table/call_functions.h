@@ -74,5 +74,17 @@ struct StorageInfoFunction final : public CallFunction {
     static function_set getFunctionSet();
 };
 
+struct MemoryManagerInfoFunction final : public CallFunction {
+    static function_set getFunctionSet();
+};
+
+struct BufferManagerInfoFunction final : public CallFunction {
+    static function_set getFunctionSet();
+};
+
+struct BufferPoolWarmUpInfoFunction final : public CallFunction {
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
@@ -18,6 +18,8 @@ struct ClientConfig {
     uint64_t timeoutInMS;
     // variable length maximum depth
     uint32_t varLengthMaxDepth;
+    // Max bytes of memory used by each query (0 means unlimited), see `storage::MemoryTracker`.
+    uint64_t queryMemoryLimit;
 };
 
 } // namespace main
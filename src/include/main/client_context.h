@@ -70,6 +70,10 @@ public:
     uint64_t getTimeoutRemainingInMS() const;
     void resetActiveQuery() { activeQuery.reset(); }
 
+    // Memory limit
+    void setQueryMemoryLimit(uint64_t numBytes);
+    uint64_t getQueryMemoryLimit() const;
+
     // Parallelism
     void setMaxNumThreadForExec(uint64_t numThreads);
     uint64_t getMaxNumThreadForExec() const;
@@ -94,6 +98,7 @@ public:
     KUZU_API Database* getDatabase() const { return database; }
     storage::StorageManager* getStorageManager();
     storage::MemoryManager* getMemoryManager();
+    storage::BufferPoolWarmUp* getBufferPoolWarmUp();
     catalog::Catalog* getCatalog();
     common::VirtualFileSystem* getVFSUnsafe() const;
     common::RandomEngine* getRandomEngine();
@@ -118,6 +123,8 @@ private:
     std::unique_ptr<PreparedStatement> prepareNoLock(parser::Statement* parsedStatement,
         bool enumerateAllPlans = false, std::string_view joinOrder = std::string_view());
 
+    void initWriteTransactionIfNecessaryNoLock();
+
     template<typename T, typename... Args>
     std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
         std::unordered_map<std::string, std::unique_ptr<common::Value>> params,
@@ -91,6 +91,19 @@ public:
      */
     KUZU_API uint64_t getQueryTimeOut();
 
+    /**
+     * @brief sets the max number of bytes of memory each query of the current connection may use
+     * for its intermediate results and pinned pages. A value of zero (the default) disables the
+     * limit.
+     */
+    KUZU_API void setQueryMemoryLimit(uint64_t numBytes);
+
+    /**
+     * @brief gets the memory limit of the queries of the current connection in bytes. A value of
+     * zero (the default) means that the memory of queries is not limited.
+     */
+    KUZU_API uint64_t getQueryMemoryLimit();
+
     template<typename TR, typename... Args>
     void createScalarFunction(std::string name, TR (*udfFunc)(Args...)) {
         auto autoTrx = startUDFAutoTrx(clientContext->getTransactionContext());
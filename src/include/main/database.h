@@ -54,6 +54,59 @@ struct KUZU_API SystemConfig {
     bool enableCompression;
     bool readOnly;
     uint64_t maxDBSize;
+    /**
+     * The directory in which intermediate results of queries are spilled to disk when they don't
+     * fit in the buffer pool. Spilling is disabled if it is empty.
+     */
+    std::string spillDirectory;
+    /**
+     * The maximum number of bytes spilled to disk. The value is default to
+     * `DEFAULT_VM_REGION_MAX_SIZE`.
+     */
+    uint64_t maxSpillSize = -1u;
+    /**
+     * The policy used to choose which pages to evict from the buffer pool, either "2Q" or "FIFO".
+     * The default "2Q" policy keeps frequently accessed pages cached during large scans.
+     */
+    std::string evictionPolicy = "2Q";
+    /**
+     * Whether to back the memory of intermediate results with transparent huge pages on Linux.
+     */
+    bool useHugePages = false;
+    /**
+     * The placement of the buffer pool memory on NUMA machines, either "DEFAULT" (the policy of
+     * the process), "LOCAL" (on the node of the thread first accessing it) or "INTERLEAVE" (spread
+     * across all nodes). Only supported on Linux.
+     */
+    std::string numaPolicy = "DEFAULT";
+    /**
+     * Whether to write the pages cached in the buffer pool to the database directory when the
+     * database is closed, and to load them in the background when it is opened again. The progress
+     * of the loading is shown by `CALL buffer_pool_warm_up_info()`.
+     */
+    bool warmUpBufferPool = false;
+    /**
+     * Whether to checkpoint committed write transactions on a background thread once no
+     * transaction is active, instead of when committing them, so that commits do not wait for
+     * read-only transactions to leave. A write transaction started before the checkpoint ran still
+     * runs it first, so it waits for read-only transactions to leave and new ones wait for the
+     * checkpoint. Transactions with DDL statements or COPY are still checkpointed when committing.
+     */
+    bool checkpointInBackground = false;
+    /**
+     * How long a write transaction waits for the active write transaction to end before failing.
+     * Waiting write transactions are started in the order in which they began. If 0, a write
+     * transaction fails immediately if another one is active.
+     */
+    uint64_t writeTransactionWaitTimeoutInMicros = 0;
+    /**
+     * Whether write transactions which only run queries, i.e., no DDL statements or COPY, run
+     * concurrently with each other. A transaction fails when it writes to a table written by
+     * another active transaction, or by one committed after it started. Commits still happen one
+     * at a time. Transactions don't read from a snapshot: a concurrent write transaction sees the
+     * data committed by other transactions while it runs (read committed).
+     */
+    bool enableConcurrentWriteTransactions = false;
 };
 
 /**
@@ -131,6 +184,8 @@ private:
     std::shared_ptr<spdlog::logger> logger;
     std::unique_ptr<common::FileInfo> lockFile;
     std::unique_ptr<extension::ExtensionOptions> extensionOptions;
+    // Declared last, so that its thread is stopped before the components it uses are destroyed.
+    std::unique_ptr<storage::BufferPoolWarmUp> bufferPoolWarmUp;
 };
 
 } // namespace main
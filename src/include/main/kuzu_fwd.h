@@ -37,6 +37,7 @@ class VirtualFileSystem;
 namespace storage {
 class MemoryManager;
 class BufferManager;
+class BufferPoolWarmUp;
 class StorageManager;
 class WAL;
 enum class WALReplayMode : uint8_t;
@@ -30,6 +30,11 @@ public:
      * @return query execution time in milliseconds.
      */
     KUZU_API double getExecutionTime() const;
+    /**
+     * @return peak number of bytes of memory used by the intermediate results and pinned pages of
+     * the query.
+     */
+    KUZU_API uint64_t getPeakMemory() const;
 
     void setPreparedSummary(PreparedSummary preparedSummary_);
 
@@ -40,6 +45,7 @@ public:
 
 private:
     double executionTime = 0;
+    uint64_t peakMemory = 0;
     PreparedSummary preparedSummary;
 };
 
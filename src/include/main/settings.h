@@ -30,6 +30,18 @@ struct TimeoutSetting {
     }
 };
 
+struct QueryMemoryLimitSetting {
+    static constexpr const char* name = "query_memory_limit";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        KU_ASSERT(parameter.getDataType()->getLogicalTypeID() == common::LogicalTypeID::INT64);
+        context->getClientConfigUnsafe()->queryMemoryLimit = parameter.getValue<int64_t>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->queryMemoryLimit);
+    }
+};
+
 struct VarLengthExtendMaxDepthSetting {
     static constexpr const char* name = "var_length_extend_max_depth";
     static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::INT64;
@@ -3,11 +3,18 @@
 #include "planner/operator/logical_plan.h"
 
 namespace kuzu {
+namespace planner {
+class CardinalityEstimator;
+} // namespace planner
+
 namespace optimizer {
 
 class FilterPushDownOptimizer {
 public:
-    FilterPushDownOptimizer() { predicateSet = std::make_unique<PredicateSet>(); }
+    explicit FilterPushDownOptimizer(const planner::CardinalityEstimator* cardinalityEstimator)
+        : cardinalityEstimator{cardinalityEstimator} {
+        predicateSet = std::make_unique<PredicateSet>();
+    }
 
     void rewrite(planner::LogicalPlan* plan);
 
@@ -69,6 +76,8 @@ private:
     };
 
 private:
+    // Used to estimate the selectivity of pushed down predicates
+    const planner::CardinalityEstimator* cardinalityEstimator;
     std::unique_ptr<PredicateSet> predicateSet;
 };
 
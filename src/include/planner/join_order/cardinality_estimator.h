@@ -1,5 +1,6 @@
 #pragma once
 
+#include "binder/expression/property_expression.h"
 #include "binder/query/query_graph.h"
 #include "planner/operator/logical_plan.h"
 #include "storage/stats/nodes_store_statistics.h"
@@ -29,6 +30,10 @@ public:
         const LogicalPlan& probePlan, const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans);
     uint64_t estimateFlatten(const LogicalPlan& childPlan, f_group_pos groupPosToFlatten);
     uint64_t estimateFilter(const LogicalPlan& childPlan, const binder::Expression& predicate);
+    // Estimated fraction of tuples satisfying the predicate. Comparisons between a property and a
+    // literal, and null checks on a property, are estimated from the property statistics; other
+    // predicates fall back to fixed selectivities.
+    double estimateSelectivity(const binder::Expression& predicate) const;
 
     double getExtensionRate(
         const binder::RelExpression& rel, const binder::NodeExpression& boundNode);
@@ -44,9 +49,16 @@ private:
 
     uint64_t getNumRels(const std::vector<common::table_id_t>& tableIDs);
 
+    // Statistics of the property in each table it is defined in, along with the number of tuples
+    // in the table.
+    std::vector<std::pair<const storage::PropertyStatistics*, uint64_t>> getPropertyStatistics(
+        const binder::PropertyExpression& property) const;
+    // Estimated number of distinct values of the property, or 0 if unknown.
+    uint64_t estimateNumDistinctValues(const binder::PropertyExpression& property) const;
+
 private:
-    const storage::NodesStoreStatsAndDeletedIDs* nodesStatistics;
-    const storage::RelsStoreStats* relsStatistics;
+    const storage::NodesStoreStatsAndDeletedIDs* nodesStatistics = nullptr;
+    const storage::RelsStoreStats* relsStatistics = nullptr;
     // The domain of nodeID is defined as the number of unique value of nodeID, i.e. num nodes.
     std::unordered_map<std::string, uint64_t> nodeIDName2dom;
 };
@@ -26,15 +26,32 @@ public:
     inline std::vector<common::table_id_t> getTableIDs() const { return nodeTableIDs; }
     inline binder::expression_vector getProperties() const { return properties; }
 
+    // Comparisons between a scanned property and a literal which can be evaluated against zone
+    // maps to skip whole node groups.
+    inline void setPropertyPredicates(binder::expression_vector predicates) {
+        propertyPredicates = std::move(predicates);
+    }
+    inline binder::expression_vector getPropertyPredicates() const { return propertyPredicates; }
+
+    // Set if most nodes are expected to have been filtered out before this scan, so that the
+    // properties should only be read for the remaining nodes instead of scanning whole pages.
+    inline void setLateMaterialization(bool value) { lateMaterialization = value; }
+    inline bool isLateMaterialization() const { return lateMaterialization; }
+
     inline std::unique_ptr<LogicalOperator> copy() final {
-        return make_unique<LogicalScanNodeProperty>(
+        auto result = make_unique<LogicalScanNodeProperty>(
             nodeID, nodeTableIDs, properties, children[0]->copy());
+        result->setPropertyPredicates(propertyPredicates);
+        result->setLateMaterialization(lateMaterialization);
+        return result;
     }
 
 private:
     std::shared_ptr<binder::Expression> nodeID;
     std::vector<common::table_id_t> nodeTableIDs;
     binder::expression_vector properties;
+    binder::expression_vector propertyPredicates;
+    bool lateMaterialization = false;
 };
 
 } // namespace planner
@@ -2,6 +2,7 @@
 
 #include "common/profiler.h"
 #include "main/client_context.h"
+#include "storage/buffer_manager/memory_tracker.h"
 
 namespace kuzu {
 namespace processor {
@@ -9,9 +10,13 @@ namespace processor {
 struct ExecutionContext {
     common::Profiler* profiler;
     main::ClientContext* clientContext;
+    // Accounts the memory used by the threads executing the query, if set.
+    std::shared_ptr<storage::MemoryTracker> memoryTracker;
 
-    ExecutionContext(common::Profiler* profiler, main::ClientContext* clientContext)
-        : profiler{profiler}, clientContext{clientContext} {}
+    ExecutionContext(common::Profiler* profiler, main::ClientContext* clientContext,
+        std::shared_ptr<storage::MemoryTracker> memoryTracker = nullptr)
+        : profiler{profiler}, clientContext{clientContext},
+          memoryTracker{std::move(memoryTracker)} {}
 };
 
 } // namespace processor
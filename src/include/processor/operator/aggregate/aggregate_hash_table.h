@@ -87,6 +87,10 @@ public:
 
     void resize(uint64_t newSize);
 
+    // Also (un)pins the hash tables of distinct aggregates.
+    void pinBlocks() override;
+    void unpinBlocks() override;
+
     static void getCompareEntryWithKeysFunc(
         const common::LogicalType& logicalType, compare_function_t& func);
 
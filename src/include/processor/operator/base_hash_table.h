@@ -17,6 +17,22 @@ public:
 
     virtual ~BaseHashTable() = default;
 
+    // Unpins the hash slots and tuples of the table while it waits for the next phase, so that
+    // they can be spilled to disk. Pointers into them stay valid, but the table must be pinned
+    // again before it is accessed. See FactorizedTable::unpinBlocks().
+    virtual void pinBlocks() {
+        for (auto& block : hashSlotsBlocks) {
+            block->pin();
+        }
+        factorizedTable->pinBlocks();
+    }
+    virtual void unpinBlocks() {
+        for (auto& block : hashSlotsBlocks) {
+            block->unpin();
+        }
+        factorizedTable->unpinBlocks();
+    }
+
 protected:
     inline void setMaxNumHashSlots(uint64_t newSize) {
         maxNumHashSlots = newSize;
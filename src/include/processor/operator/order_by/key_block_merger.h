@@ -54,6 +54,10 @@ public:
     uint8_t* getBlockEndTuplePtr(
         uint32_t blockIdx, uint64_t endTupleIdx, uint32_t endTupleBlockIdx) const;
 
+    // Sorted runs waiting in the queue to be merged are unpinned, so they can be spilled to disk.
+    void pin();
+    void unpin();
+
 private:
     uint32_t numBytesPerTuple;
     uint32_t numTuplesPerBlock;
@@ -33,6 +33,10 @@ public:
 
     void executeInternal(ExecutionContext* context) override;
 
+    void finalize(ExecutionContext* /*context*/) override {
+        sharedState->pinMergedKeyBlockAndPayloadTables();
+    }
+
     std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<OrderByMerge>(sharedState, sharedDispatcher, id, paramsString);
     }
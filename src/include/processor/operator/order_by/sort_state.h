@@ -31,6 +31,9 @@ public:
 
     void combineFTHasNoNullGuarantee();
 
+    // Pins the result of the merge and the payload tables before they are scanned.
+    void pinMergedKeyBlockAndPayloadTables();
+
     std::vector<FactorizedTable*> getPayloadTables() const;
 
     inline MergedKeyBlocks* getMergedKeyBlock() const {
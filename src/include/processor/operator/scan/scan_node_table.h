@@ -11,11 +11,23 @@ namespace processor {
 struct ScanNodeTableInfo {
     storage::NodeTable* table;
     std::vector<common::column_id_t> columnIDs;
+    // Predicates checked against the zone maps of each node group to skip scanning it.
+    std::vector<storage::ColumnPredicate> columnPredicates;
+    // Predicates on STRING columns which are evaluated on dictionary indices while scanning.
+    std::vector<storage::StringColumnPredicate> stringPredicates;
+    // Read the columns with sparse lookups of the selected nodes.
+    bool lateMaterialization = false;
 
-    ScanNodeTableInfo(storage::NodeTable* table, std::vector<common::column_id_t> columnIDs)
-        : table{table}, columnIDs{std::move(columnIDs)} {}
+    ScanNodeTableInfo(storage::NodeTable* table, std::vector<common::column_id_t> columnIDs,
+        std::vector<storage::ColumnPredicate> columnPredicates = {},
+        std::vector<storage::StringColumnPredicate> stringPredicates = {})
+        : table{table}, columnIDs{std::move(columnIDs)},
+          columnPredicates{std::move(columnPredicates)}, stringPredicates{
+                                                             std::move(stringPredicates)} {}
     ScanNodeTableInfo(const ScanNodeTableInfo& other)
-        : table{other.table}, columnIDs{other.columnIDs} {}
+        : table{other.table}, columnIDs{other.columnIDs}, columnPredicates{other.columnPredicates},
+          stringPredicates{other.stringPredicates}, lateMaterialization{
+                                                         other.lateMaterialization} {}
 
     inline std::unique_ptr<ScanNodeTableInfo> copy() const {
         return std::make_unique<ScanNodeTableInfo>(*this);
@@ -34,6 +46,11 @@ public:
         ResultSet* resultSet, ExecutionContext* executionContext) final {
         ScanTable::initLocalStateInternal(resultSet, executionContext);
         readState = std::make_unique<storage::TableReadState>();
+        for (auto& predicate : info->stringPredicates) {
+            readState->dictionaryFilters.emplace_back(predicate);
+        }
+        readState->columnPredicates = info->columnPredicates;
+        readState->lateMaterialization = info->lateMaterialization;
     }
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
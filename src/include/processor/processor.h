@@ -14,6 +14,8 @@ public:
 
     std::shared_ptr<FactorizedTable> execute(PhysicalPlan* physicalPlan, ExecutionContext* context);
 
+    inline common::TaskScheduler* getTaskScheduler() const { return taskScheduler.get(); }
+
 private:
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
 
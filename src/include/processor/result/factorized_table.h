@@ -35,7 +35,7 @@ public:
     explicit DataBlock(storage::MemoryManager* memoryManager)
         : numTuples{0}, memoryManager{memoryManager} {
         block = memoryManager->allocateBuffer(true /* initializeToZero */);
-        freeSize = block->allocator->getPageSize();
+        freeSize = block->allocator->getBufferSize();
     }
 
     DataBlock(DataBlock&& other) = default;
@@ -48,6 +48,10 @@ public:
     inline void resetToZero() {
         memset(block->buffer, 0, common::BufferPoolConstants::PAGE_256KB_SIZE);
     }
+    // The data of an unpinned block may be spilled to disk, so it must be pinned again before it
+    // is accessed. See MemoryBuffer::unpin().
+    inline void pin() { block->pin(); }
+    inline void unpin() { block->unpin(); }
 
     static void copyTuples(DataBlock* blockToCopyFrom, ft_tuple_idx_t tupleIdxToCopyFrom,
         DataBlock* blockToCopyInto, ft_tuple_idx_t tupleIdxToCopyTo, uint32_t numTuplesToCopy,
@@ -85,6 +89,9 @@ public:
 
     void merge(DataBlockCollection& other);
 
+    void pin();
+    void unpin();
+
 private:
     uint32_t numBytesPerTuple;
     uint32_t numTuplesPerBlock;
@@ -212,6 +219,11 @@ public:
     void mergeMayContainNulls(FactorizedTable& other);
     void merge(FactorizedTable& other);
 
+    // Unpins all blocks of the table so that they can be spilled to disk while the table isn't
+    // accessed. The table must be pinned again before it is read or appended to.
+    void pinBlocks();
+    void unpinBlocks();
+
     inline common::InMemOverflowBuffer* getInMemOverflowBuffer() const {
         return inMemOverflowBuffer.get();
     }
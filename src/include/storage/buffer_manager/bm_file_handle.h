@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cmath>
 
@@ -15,6 +16,7 @@ class BufferManager;
 // Keeps the state information of a page in a file.
 class PageState {
     static constexpr uint64_t DIRTY_MASK = 0x0080000000000000;
+    static constexpr uint64_t REFERENCED_MASK = 0x0040000000000000;
     static constexpr uint64_t STATE_MASK = 0xFF00000000000000;
     static constexpr uint64_t VERSION_MASK = 0x00FFFFFFFFFFFFFF;
     static constexpr uint64_t NUM_BITS_TO_SHIFT_FOR_STATE = 56;
@@ -81,6 +83,15 @@ public:
         stateAndVersion &= ~DIRTY_MASK;
     }
     inline bool isDirty() const { return stateAndVersion & DIRTY_MASK; }
+    // Referenced pages are prioritized by the eviction policy until they are evicted, see
+    // `TwoQueueEvictionPolicy`.
+    inline void setReferenced() {
+        KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
+        stateAndVersion |= REFERENCED_MASK;
+    }
+    inline static bool isReferenced(uint64_t stateAndVersion) {
+        return stateAndVersion & REFERENCED_MASK;
+    }
     uint64_t getStateAndVersion() const { return stateAndVersion.load(); }
 
     inline void resetToEvicted() {
@@ -88,8 +99,8 @@ public:
     }
 
 private:
-    // Highest 1 bit is dirty bit, and the rest are page state and version bits.
-    // In the rest bits, the lowest 1 byte is state, and the rest are version.
+    // The highest byte is the page state, followed by the dirty bit and the referenced bit. The
+    // rest are version bits.
     std::atomic<uint64_t> stateAndVersion;
 };
 
@@ -123,6 +134,25 @@ private:
     std::vector<std::unique_ptr<std::mutex>> walPageIdxLocks;
 };
 
+// The states of the pages of a page group, which are cached in the frames of one frame group.
+struct PageGroup {
+    explicit PageGroup(common::frame_group_idx_t frameGroupIdx) : frameGroupIdx{frameGroupIdx} {}
+
+    common::frame_group_idx_t frameGroupIdx;
+    std::array<PageState, common::StorageConstants::PAGE_GROUP_SIZE> pageStates;
+};
+
+struct PageCacheStats {
+    // Number of times a page of the file was accessed while it was cached in its frame.
+    uint64_t numCacheHits;
+    // Number of times a page of the file had to be cached into its frame to be accessed.
+    uint64_t numCacheMisses;
+    uint64_t numEvictions;
+    // Number of pages of the file cached into their frames by prefetching, which aren't counted
+    // as misses.
+    uint64_t numPrefetchedPages;
+};
+
 // BMFileHandle is a file handle that is backed by BufferManager. It holds the state of
 // each page in the file. File Handle is the bridge between a Column/Lists/Index and the Buffer
 // Manager that abstracts the file in which that Column/Lists/Index is stored.
@@ -146,8 +176,10 @@ public:
 
     // This function assumes the page is already LOCKED.
     inline void setLockedPageDirty(common::page_idx_t pageIdx) {
-        KU_ASSERT(pageIdx < numPages);
-        pageStates[pageIdx]->setDirty();
+        getPageState(pageIdx)->setDirty();
+    }
+    inline void clearLockedPageDirty(common::page_idx_t pageIdx) {
+        getPageState(pageIdx)->clearDirty();
     }
 
     common::page_group_idx_t addWALPageIdxGroupIfNecessary(common::page_idx_t originalPageIdx);
@@ -173,14 +205,26 @@ public:
     // This function assumes that the caller has already acquired the wal page idx lock.
     void setWALPageIdxNoLock(common::page_idx_t originalPageIdx, common::page_idx_t pageIdxInWAL);
 
-private:
-    inline PageState* getPageState(common::page_idx_t pageIdx) {
-        KU_ASSERT(pageIdx < numPages && pageStates[pageIdx]);
-        return pageStates[pageIdx].get();
+    inline PageCacheStats getCacheStats() const {
+        return PageCacheStats{numCacheHits.load(), numCacheMisses.load(), numEvictions.load(),
+            numPrefetchedPages.load()};
     }
-    inline common::frame_idx_t getFrameIdx(common::page_idx_t pageIdx) {
+
+private:
+    // Page states and frames are looked up without locks, see `pageGroupDirectory`.
+    inline PageGroup* getPageGroup(common::page_idx_t pageIdx) const {
         KU_ASSERT(pageIdx < pageCapacity);
-        return (frameGroupIdxes[pageIdx >> common::StorageConstants::PAGE_GROUP_SIZE_LOG2]
+        auto directory = pageGroupDirectory.load(std::memory_order_acquire);
+        return directory[pageIdx >> common::StorageConstants::PAGE_GROUP_SIZE_LOG2].load(
+            std::memory_order_acquire);
+    }
+    inline PageState* getPageState(common::page_idx_t pageIdx) const {
+        KU_ASSERT(pageIdx < numPages);
+        return &getPageGroup(pageIdx)
+                    ->pageStates[pageIdx & common::StorageConstants::PAGE_IDX_IN_GROUP_MASK];
+    }
+    inline common::frame_idx_t getFrameIdx(common::page_idx_t pageIdx) const {
+        return ((common::frame_idx_t)getPageGroup(pageIdx)->frameGroupIdx
                    << common::StorageConstants::PAGE_GROUP_SIZE_LOG2) |
                (pageIdx & common::StorageConstants::PAGE_IDX_IN_GROUP_MASK);
     }
@@ -189,21 +233,32 @@ private:
     void initPageStatesAndGroups();
     common::page_idx_t addNewPageWithoutLock() override;
     void addNewPageGroupWithoutLock();
-    inline common::page_group_idx_t getNumPageGroups() {
-        return ceil((double)numPages / common::StorageConstants::PAGE_GROUP_SIZE);
-    }
 
 private:
     FileVersionedType fileVersionedType;
     BufferManager* bm;
     common::PageSizeClass pageSizeClass;
-    std::vector<std::unique_ptr<PageState>> pageStates;
-    // Each file page group corresponds to a frame group in the VMRegion.
-    std::vector<common::page_group_idx_t> frameGroupIdxes;
+    // Each file page group corresponds to a frame group in the VMRegion. Page groups are only
+    // added, under the exclusive `fhSharedMutex`, and never freed before the file handle is
+    // destroyed: the page groups beyond the page capacity after a truncation are kept, and reused
+    // with their frame groups when the file grows again.
+    std::vector<std::unique_ptr<PageGroup>> pageGroups;
+    // Readers look up page groups in the directory without any lock. When it is full, the
+    // directory is copied into one of twice the size, which is then published. Old directories
+    // are kept in `pageGroupDirectories` until the file handle is destroyed, since readers may
+    // still be using them.
+    std::atomic<std::atomic<PageGroup*>*> pageGroupDirectory;
+    uint64_t pageGroupDirectoryCapacity;
+    std::vector<std::unique_ptr<std::atomic<PageGroup*>[]>> pageGroupDirectories;
     // For each page group, if it has any WAL page version, we keep a `WALPageIdxGroup` in this map.
     // `WALPageIdxGroup` records the WAL page idx for each page in the page group.
     // Accesses to this map is synchronized by `fhSharedMutex`.
     std::unordered_map<common::page_group_idx_t, std::unique_ptr<WALPageIdxGroup>> walPageIdxGroups;
+    // Updated by the BM with relaxed ordering, since they are only used for monitoring.
+    std::atomic<uint64_t> numCacheHits;
+    std::atomic<uint64_t> numCacheMisses;
+    std::atomic<uint64_t> numEvictions;
+    std::atomic<uint64_t> numPrefetchedPages;
 };
 } // namespace storage
 } // namespace kuzu
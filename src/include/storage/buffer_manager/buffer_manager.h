@@ -1,68 +1,39 @@
 #pragma once
 
 #include <functional>
+#include <mutex>
+#include <span>
+#include <unordered_set>
 #include <vector>
 
+#include "common/file_system/file_system.h"
 #include "storage/buffer_manager/bm_file_handle.h"
-#include "storage/buffer_manager/locked_queue.h"
+#include "storage/buffer_manager/eviction_queue.h"
+#include "storage/buffer_manager/memory_tracker.h"
+#include "storage/buffer_manager/page_prefetcher.h"
 
 namespace kuzu {
 namespace storage {
 
-// This class keeps state info for pages potentially can be evicted.
-// The page state of a candidate is set to MARKED when it is first enqueued. After enqueued, if the
-// candidate was recently accessed, it is no longer immediately evictable. See the state transition
-// diagram above `BufferManager` class declaration for more details.
-struct EvictionCandidate {
-    // If the candidate is Marked and its version is the same as the one kept inside the candidate,
-    // it is evictable.
-    inline bool isEvictable(uint64_t currPageStateAndVersion) const {
-        return PageState::getState(currPageStateAndVersion) == PageState::MARKED &&
-               PageState::getVersion(currPageStateAndVersion) == pageVersion;
-    }
-    // If the candidate was recently read optimistically, it is second chance evictable.
-    inline bool isSecondChanceEvictable(uint64_t currPageStateAndVersion) const {
-        return PageState::getState(currPageStateAndVersion) == PageState::UNLOCKED &&
-               PageState::getVersion(currPageStateAndVersion) == pageVersion;
-    }
-
-    BMFileHandle* fileHandle = nullptr;
-    common::page_idx_t pageIdx = common::INVALID_PAGE_IDX;
-    PageState* pageState = nullptr;
-    // The version of the corresponding page at the time the candidate is enqueued.
-    uint64_t pageVersion = -1u;
-
-    inline bool operator==(const EvictionCandidate& other) const {
-        return fileHandle == other.fileHandle && pageIdx == other.pageIdx &&
-               pageState == other.pageState && pageVersion == other.pageVersion;
-    }
+// Cache statistics of a file managed by the BM.
+struct FileCacheStats {
+    std::string filePath;
+    uint64_t pageSize;
+    uint64_t numPages;
+    PageCacheStats stats;
 };
 
-class EvictionQueue {
-public:
-    EvictionQueue() { queue = std::make_unique<LockedQueue<EvictionCandidate>>(); }
+// Consecutive pages of a file, which are read or written with one I/O request.
+struct PageRun {
+    common::page_idx_t startPageIdx;
+    common::page_idx_t numPages;
 
-    inline void enqueue(EvictionCandidate& candidate) {
-        std::shared_lock sLck{mtx};
-        queue->enqueue(candidate);
-    }
-    inline void enqueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx, PageState* pageState,
-        uint64_t pageVersion) {
-        std::shared_lock sLck{mtx};
-        queue->enqueue(EvictionCandidate{fileHandle, pageIdx, pageState, pageVersion});
-    }
-    inline bool dequeue(EvictionCandidate& candidate) {
-        std::shared_lock sLck{mtx};
-        return queue->try_dequeue(candidate);
+    inline common::page_idx_t endPageIdx() const { return startPageIdx + numPages; }
+    // Runs never cross page groups, since the frames of different page groups are not consecutive.
+    inline bool canAppend(common::page_idx_t pageIdx, uint64_t maxNumPages) const {
+        return pageIdx == endPageIdx() && numPages < maxNumPages &&
+               pageIdx % common::StorageConstants::PAGE_GROUP_SIZE != 0;
     }
-
-    void removeNonEvictableCandidates();
-
-    void removeCandidatesForFile(BMFileHandle& fileHandle);
-
-private:
-    std::shared_mutex mtx;
-    std::unique_ptr<LockedQueue<EvictionCandidate>> queue;
 };
 
 /**
@@ -86,7 +57,13 @@ private:
  *
  * When users unpin their pages, the BM might spill them to disk. The behavior of what is guaranteed
  * to be kept in frame and what can be spilled to disk is directly determined by the pin/unpin
- * calls of the users.
+ * calls of the users. Memory buffers of the MM are only spilled if the MM is given a spill
+ * directory, see `MemoryManager`.
+ *
+ * To avoid reading cold pages one at a time, the BM can prefetch a range of pages of a file,
+ * reading consecutive pages which aren't cached with a single read into their frames. Ranges
+ * can be prefetched synchronously, or asynchronously on the I/O threads of a `PagePrefetcher`, so
+ * that scans can read ahead of the pages they are accessing.
  *
  * Also, BM provides some specialized functionalities for WAL files:
  * 1) it supports the caller to set pinned pages as dirty, which will be safely written back to disk
@@ -110,9 +87,10 @@ private:
  * 2) For each BMFileHandle backed by a temp in-mem file in MM, BM allocates a virtual memory region
  * of `maxSize` for it. Each memory buffer is mapped to a unique PAGE_256KB_SIZE frame in that
  * region. Both disk pages and memory buffers are all managed by the BM to make sure that actually
- * used physical memory doesn't go beyond max size specified by users. Currently, the BM uses a
- * queue based replacement policy and the MADV_DONTNEED hint to explicitly control evictions. See
- * comments above `claimAFrame()` for more details.
+ * used physical memory doesn't go beyond max size specified by users. The BM uses a pluggable
+ * replacement policy (see `EvictionPolicy`), which defaults to the scan-resistant 2Q policy, and
+ * the MADV_DONTNEED hint to explicitly control evictions. See comments above `claimAFrame()` for
+ * more details.
  *
  * Page states in BM:
  * A page can be in one of the four states: a) LOCKED, b) UNLOCKED, c) MARKED, d) EVICTED.
@@ -164,16 +142,56 @@ class BufferManager {
 public:
     enum class PageReadPolicy : uint8_t { READ_PAGE = 0, DONT_READ_PAGE = 1 };
 
-    BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize);
+    // Prefetching and flushing read and write at most MAX_NUM_PAGES_PER_IO_REQUEST consecutive
+    // pages with one request. It is also the maximum number of pages of an `optimisticReadPages`.
+    static constexpr uint64_t MAX_NUM_PAGES_PER_IO_REQUEST = 64;
+
+    // maxSpillSize is the number of bytes of memory buffers that the MM may spill to disk. Memory
+    // buffers beyond the buffer pool size need their own frames, so it enlarges the VMRegion for
+    // PAGE_256KB frames, which only reserves virtual memory.
+    // Huge pages (see `VMRegionConfig`) are only used for the PAGE_256KB frames, which hold the
+    // memory buffers of intermediate results, since each PAGE_4KB frame is released separately.
+    BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize, uint64_t maxSpillSize = 0,
+        EvictionPolicyType evictionPolicyType = EvictionPolicyType::TWO_QUEUE,
+        VMRegionConfig vmRegionConfig = VMRegionConfig{});
     ~BufferManager() = default;
 
+    // Pinned pages are accounted to the MemoryTracker of the calling thread, if any, as long as the
+    // MemoryTrackerScope they are pinned in lasts (see MemoryTracker).
     uint8_t* pin(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
     void optimisticRead(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
         const std::function<void(uint8_t*)>& func);
+    // Reads the pages in [startPageIdx, startPageIdx + numPages), which must be in the same page
+    // group, as one extent: their frames are consecutive, so `func` is called once with the frame
+    // of the first page, and the versions of all pages are validated after it returns. Evicted
+    // pages of the extent are first cached with one batch of reads. If they cannot all be cached
+    // (e.g. the buffer pool is full), `func` is called for each page with its own optimistic read.
+    // As with `optimisticRead`, `func` may be called again for pages whose read was invalidated.
+    void optimisticReadPages(BMFileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages,
+        const std::function<void(uint8_t* frame, common::page_idx_t startPageIdx,
+            common::page_idx_t numPages)>& func);
     // The function assumes that the requested page is already pinned.
     void unpin(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
 
+    // Caches the pages in [startPageIdx, startPageIdx + numPages) which are evicted into their
+    // frames and leaves them unpinned. Prefetching stops at the first page for which no frame can
+    // be claimed. Pages which cannot be read are left evicted.
+    void prefetchPages(
+        BMFileHandle& fileHandle, common::page_idx_t startPageIdx, common::page_idx_t numPages);
+    // Caches the pages of the runs like `prefetchPages`, reading the pages of all runs with one
+    // batch. Returns false if prefetching stopped because no frame could be claimed.
+    bool prefetchPageRuns(BMFileHandle& fileHandle, std::span<const PageRun> pageRuns);
+    // Returns the idxes of the cached pages of the file in ascending order.
+    std::vector<common::page_idx_t> getCachedPageIdxes(BMFileHandle& fileHandle);
+    // Schedules the pages to be prefetched by the I/O threads of the BM.
+    void prefetchPagesAsync(
+        BMFileHandle& fileHandle, common::page_idx_t startPageIdx, common::page_idx_t numPages);
+    // Writers updating database files without going through the BM must wait for the scheduled
+    // prefetches, which could otherwise cache stale pages.
+    inline void waitForPrefetches() { prefetcher->waitForAllRequests(); }
+
     // Currently, these functions are specifically used only for WAL files.
     void removeFilePagesFromFrames(BMFileHandle& fileHandle);
     void flushAllDirtyPagesInFrames(BMFileHandle& fileHandle);
@@ -191,11 +209,28 @@ public:
     inline common::frame_group_idx_t addNewFrameGroup(common::PageSizeClass pageSizeClass) {
         return vmRegions[pageSizeClass]->addNewFrameGroup();
     }
-    inline void clearEvictionQueue() { evictionQueue = std::make_unique<EvictionQueue>(); }
+    inline void clearEvictionQueue() {
+        evictionQueue->reset(
+            EvictionPolicy::createEvictionPolicy(evictionPolicyType, bufferPoolSize.load()));
+    }
+    inline EvictionPolicyType getEvictionPolicyType() const { return evictionPolicyType; }
+
+    // BMFileHandles register themselves, so that the cache stats of all files can be collected.
+    void registerFileHandle(BMFileHandle* fileHandle);
+    void unregisterFileHandle(BMFileHandle* fileHandle);
+    std::vector<FileCacheStats> getFileCacheStats();
+    // Returns nullptr if no file handle of the file is registered.
+    BMFileHandle* getFileHandle(const std::string& filePath);
+    inline uint64_t getUsedMemory() const { return usedMemory.load(); }
+    inline uint64_t getBufferPoolSize() const { return bufferPoolSize.load(); }
 
 private:
     static void verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize);
 
+    uint8_t* pinWithoutTracking(
+        BMFileHandle& fileHandle, common::page_idx_t pageIdx, PageReadPolicy pageReadPolicy);
+    void unpinWithoutTracking(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
+
     bool claimAFrame(
         BMFileHandle& fileHandle, common::page_idx_t pageIdx, PageReadPolicy pageReadPolicy);
     // Return number of bytes freed.
@@ -210,6 +245,12 @@ private:
     void addToEvictionQueue(
         BMFileHandle* fileHandle, common::page_idx_t pageIdx, PageState* pageState);
 
+    // The pages of a run must be in the same page group, so that their frames are consecutive.
+    common::FileIORequest getIORequestForRun(
+        common::FileIOType type, BMFileHandle& fileHandle, const PageRun& run);
+    // The pages of the runs must be locked and have claimed frames.
+    void readPagesIntoFrames(BMFileHandle& fileHandle, const std::vector<PageRun>& runs);
+
     inline uint64_t reserveUsedMemory(uint64_t size) { return usedMemory.fetch_add(size); }
     inline uint64_t freeUsedMemory(uint64_t size) { return usedMemory.fetch_sub(size); }
 
@@ -223,11 +264,15 @@ private:
 private:
     std::atomic<uint64_t> usedMemory;
     std::atomic<uint64_t> bufferPoolSize;
-    std::atomic<uint64_t> numEvictionQueueInsertions;
     // Each VMRegion corresponds to a virtual memory region of a specific page size. Currently, we
     // hold two sizes of PAGE_4KB and PAGE_256KB.
     std::vector<std::unique_ptr<VMRegion>> vmRegions;
+    EvictionPolicyType evictionPolicyType;
     std::unique_ptr<EvictionQueue> evictionQueue;
+    std::mutex fileHandlesMtx;
+    std::unordered_set<BMFileHandle*> fileHandles;
+    // Declared last, so that its threads are stopped before the other members are destroyed.
+    std::unique_ptr<PagePrefetcher> prefetcher;
 };
 
 } // namespace storage
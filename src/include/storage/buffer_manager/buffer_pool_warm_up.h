@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class VirtualFileSystem;
+} // namespace common
+
+namespace transaction {
+class TransactionManager;
+} // namespace transaction
+
+namespace storage {
+
+class BufferManager;
+
+enum class BufferPoolWarmUpState : uint8_t {
+    NOT_STARTED = 0,
+    LOADING = 1,
+    DONE = 2,
+    // Stopped before all pages were loaded, e.g. because the database was closed.
+    STOPPED = 3,
+};
+
+struct BufferPoolWarmUpStateUtils {
+    static std::string toString(BufferPoolWarmUpState state);
+};
+
+struct BufferPoolWarmUpProgress {
+    BufferPoolWarmUpState state;
+    uint64_t numPagesToLoad;
+    uint64_t numLoadedPages;
+};
+
+// The cached pages of a database file, which is identified by its name in the database directory.
+struct CachedFilePages {
+    std::string fileName;
+    std::vector<common::page_idx_t> pageIdxes;
+};
+
+// Restores the pages cached by the BM across restarts. When the database is closed, the idxes of
+// the cached pages of its files are written to the dump file in the database directory. When the
+// database is opened again, the dump is read and its pages are loaded on a background thread, file
+// by file in ascending page order, so that consecutive pages are read with few large requests.
+// The pages are loaded in batches, each inside a read-only transaction, so that checkpoints never
+// update the files while their pages are being loaded. Loading stops once the buffer pool is full,
+// so that pages cached by queries are not evicted in favour of dumped ones.
+class BufferPoolWarmUp {
+public:
+    static constexpr uint64_t NUM_PAGES_PER_BATCH = 4096;
+
+    BufferPoolWarmUp(BufferManager& bufferManager, common::VirtualFileSystem* vfs,
+        std::string databasePath, bool readOnly);
+    ~BufferPoolWarmUp();
+
+    // Writes the cached pages of the database files to the dump file. Should only be called when
+    // no query is running.
+    void dumpCachedPages();
+    // Reads the dump file, which is removed unless the database is read-only, and starts loading
+    // its pages. Does nothing if there is no dump file.
+    void start(transaction::TransactionManager* transactionManager);
+    // Stops loading pages and waits for the loading thread to exit.
+    void stop();
+    BufferPoolWarmUpProgress getProgress() const;
+
+private:
+    std::vector<CachedFilePages> readDump();
+    void loadPages(transaction::TransactionManager* transactionManager,
+        std::vector<CachedFilePages> filePages);
+    // Returns false if the buffer pool is full.
+    bool loadBatch(transaction::TransactionManager* transactionManager, const std::string& filePath,
+        const common::page_idx_t* pageIdxes, uint64_t numPages);
+
+private:
+    BufferManager& bufferManager;
+    common::VirtualFileSystem* vfs;
+    std::string databasePath;
+    bool readOnly;
+    std::atomic<BufferPoolWarmUpState> state;
+    std::atomic<uint64_t> numPagesToLoad;
+    std::atomic<uint64_t> numLoadedPages;
+    std::atomic<bool> stopRequested;
+    std::thread thread;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "storage/buffer_manager/bm_file_handle.h"
+
+namespace kuzu {
+namespace storage {
+
+// This class keeps state info for pages potentially can be evicted.
+// The page state of a candidate is set to MARKED when it is first enqueued. After enqueued, if the
+// candidate was recently accessed, it is no longer immediately evictable. See the state transition
+// diagram above `BufferManager` class declaration for more details.
+struct EvictionCandidate {
+    // If the candidate is Marked and its version is the same as the one kept inside the candidate,
+    // it is evictable.
+    inline bool isEvictable(uint64_t currPageStateAndVersion) const {
+        return PageState::getState(currPageStateAndVersion) == PageState::MARKED &&
+               PageState::getVersion(currPageStateAndVersion) == pageVersion;
+    }
+    // If the candidate was recently read optimistically, it is second chance evictable.
+    inline bool isSecondChanceEvictable(uint64_t currPageStateAndVersion) const {
+        return PageState::getState(currPageStateAndVersion) == PageState::UNLOCKED &&
+               PageState::getVersion(currPageStateAndVersion) == pageVersion;
+    }
+    // A page is referenced if it was reloaded shortly after being evicted, see
+    // `TwoQueueEvictionPolicy`.
+    inline bool isReferenced() const { return PageState::isReferenced(pageVersion); }
+
+    BMFileHandle* fileHandle = nullptr;
+    common::page_idx_t pageIdx = common::INVALID_PAGE_IDX;
+    PageState* pageState = nullptr;
+    // The version of the corresponding page at the time the candidate is enqueued.
+    uint64_t pageVersion = -1u;
+
+    inline bool operator==(const EvictionCandidate& other) const {
+        return fileHandle == other.fileHandle && pageIdx == other.pageIdx &&
+               pageState == other.pageState && pageVersion == other.pageVersion;
+    }
+};
+
+enum class EvictionPolicyType : uint8_t {
+    FIFO = 0,
+    TWO_QUEUE = 1,
+};
+
+struct EvictionPolicyTypeUtils {
+    static EvictionPolicyType fromString(const std::string& str);
+    static std::string toString(EvictionPolicyType type);
+};
+
+// The eviction policy decides the order in which the BM evicts unpinned pages. Candidates are
+// enqueued when pages are unpinned, and the BM dequeues candidates until it finds one which is
+// still evictable. Candidates of pages which were optimistically read since they were enqueued
+// are given a second chance by the BM, which enqueues them again.
+// Candidates are enqueued in batches by the `EvictionQueue`, so that the lock of the policy is
+// taken once per batch instead of once per unpinned page.
+class EvictionPolicy {
+public:
+    virtual ~EvictionPolicy() = default;
+
+    virtual void enqueue(const EvictionCandidate& candidate) = 0;
+    virtual void enqueueBatch(const EvictionCandidate* candidates, uint64_t numCandidates) = 0;
+    virtual bool dequeue(EvictionCandidate& candidate) = 0;
+
+    // Called by the BM after it evicted the page of a dequeued candidate.
+    virtual void notifyEvicted(const EvictionCandidate& /*candidate*/) {}
+    // Returns true if the page should be treated as referenced when it is cached into its frame.
+    virtual bool wasRecentlyEvicted(BMFileHandle* /*fileHandle*/, common::page_idx_t /*pageIdx*/) {
+        return false;
+    }
+
+    virtual void removeNonEvictableCandidates() = 0;
+    virtual void removeCandidatesForFile(BMFileHandle& fileHandle) = 0;
+
+    static std::unique_ptr<EvictionPolicy> createEvictionPolicy(
+        EvictionPolicyType type, uint64_t bufferPoolSize);
+};
+
+// A single FIFO queue with second chance marking. A large scan of cold pages flushes all other
+// pages out of the buffer pool.
+class FIFOEvictionPolicy final : public EvictionPolicy {
+public:
+    void enqueue(const EvictionCandidate& candidate) override;
+    void enqueueBatch(const EvictionCandidate* candidates, uint64_t numCandidates) override;
+    bool dequeue(EvictionCandidate& candidate) override;
+
+    void removeNonEvictableCandidates() override;
+    void removeCandidatesForFile(BMFileHandle& fileHandle) override;
+
+private:
+    std::mutex mtx;
+    std::deque<EvictionCandidate> queue;
+};
+
+// A simplified 2Q policy ("2Q: A Low Overhead High Performance Buffer Management Replacement
+// Algorithm", Johnson and Shasha, VLDB 1994), which is resistant to large scans.
+// Pages cached for the first time are enqueued into the probation queue (A1in). Pinning them again
+// while they are cached only moves them to the back of the probation queue, so repeated pins of a
+// page within a short period, such as the ones of a scan, don't make it hot.
+// When a page is evicted from the probation queue, it is remembered in the ghost queue (A1out). If
+// the page is reloaded while it is still remembered, it is referenced, and it is enqueued into the
+// protected queue (Am) from then on until it is evicted.
+// Pages are evicted from the probation queue as long as it holds more than a
+// PROBATION_QUEUE_RATIO of the buffer pool, so a scan can only flush the probation queue.
+// The sizes of the queues are approximate, since they include the candidates that are no longer
+// evictable.
+class TwoQueueEvictionPolicy final : public EvictionPolicy {
+public:
+    static constexpr double PROBATION_QUEUE_RATIO = 0.25;
+    // The ghost queue remembers half of the pages that fit in the buffer pool, up to
+    // MAX_NUM_GHOST_PAGES.
+    static constexpr double GHOST_QUEUE_RATIO = 0.5;
+    static constexpr uint64_t MAX_NUM_GHOST_PAGES = 1 << 18;
+
+    explicit TwoQueueEvictionPolicy(uint64_t bufferPoolSize);
+
+    void enqueue(const EvictionCandidate& candidate) override;
+    void enqueueBatch(const EvictionCandidate* candidates, uint64_t numCandidates) override;
+    bool dequeue(EvictionCandidate& candidate) override;
+
+    void notifyEvicted(const EvictionCandidate& candidate) override;
+    bool wasRecentlyEvicted(BMFileHandle* fileHandle, common::page_idx_t pageIdx) override;
+
+    void removeNonEvictableCandidates() override;
+    void removeCandidatesForFile(BMFileHandle& fileHandle) override;
+
+private:
+    static inline uint64_t getGhostKey(BMFileHandle* fileHandle, common::page_idx_t pageIdx) {
+        return std::hash<BMFileHandle*>{}(fileHandle) * 31 + pageIdx;
+    }
+    void enqueueNoLock(const EvictionCandidate& candidate);
+    void removeNonEvictableCandidatesNoLock(std::deque<EvictionCandidate>& queue,
+        uint64_t& queueSize);
+
+private:
+    std::mutex mtx;
+    uint64_t probationQueueCapacity;
+    uint64_t maxNumGhostPages;
+    std::deque<EvictionCandidate> probationQueue;
+    std::deque<EvictionCandidate> protectedQueue;
+    // Sizes of the queues in bytes.
+    uint64_t probationQueueSize;
+    uint64_t protectedQueueSize;
+    // Keys of pages recently evicted from the probation queue. A key may be in the ghost queue
+    // multiple times, so the map counts the occurrences of each key.
+    std::deque<uint64_t> ghostQueue;
+    std::unordered_map<uint64_t, uint32_t> ghostPages;
+};
+
+} // namespace storage
+} // namespace kuzu
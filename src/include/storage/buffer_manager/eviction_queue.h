@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+
+#include "storage/buffer_manager/eviction_policy.h"
+
+namespace kuzu {
+namespace storage {
+
+// Buffers the eviction candidates of unpinned pages before they are enqueued into the eviction
+// policy, so that unpinning a page neither allocates memory nor takes a lock.
+// The candidates are buffered in NUM_SHARDS shards. Each thread is assigned a shard round-robin
+// the first time it enqueues a candidate, so that threads rarely share a shard. A shard is a
+// bounded lock-free ring ("Bounded MPMC queue", Vyukov), which any thread can drain. When the
+// shard of a thread is full, the thread moves all of its candidates to the policy in one batch.
+// Before dequeuing from the policy, all shards are flushed, so that the BM sees the candidates of
+// all unpinned pages, in the order in which they were unpinned within each shard.
+class EvictionQueue {
+public:
+    static constexpr uint64_t NUM_SHARDS = 32;
+    static constexpr uint64_t SHARD_CAPACITY = 128;
+
+    explicit EvictionQueue(std::unique_ptr<EvictionPolicy> policy);
+
+    void enqueue(const EvictionCandidate& candidate);
+    bool dequeue(EvictionCandidate& candidate);
+    // Moves the candidates buffered in all shards to the policy.
+    void flush();
+    void removeCandidatesForFile(BMFileHandle& fileHandle);
+    // Drops all candidates, and replaces the policy.
+    void reset(std::unique_ptr<EvictionPolicy> newPolicy);
+
+    inline EvictionPolicy& getPolicy() { return *policy; }
+
+private:
+    struct Slot {
+        // The position of the slot in the ring for which the slot can next be written (if equal to
+        // the position) or read (if equal to the position + 1).
+        std::atomic<uint64_t> sequence;
+        EvictionCandidate candidate;
+    };
+
+    struct alignas(64) Shard {
+        Shard();
+
+        bool tryPush(const EvictionCandidate& candidate);
+        bool tryPop(EvictionCandidate& candidate);
+        inline bool isEmpty() const {
+            return enqueuePos.load(std::memory_order_relaxed) ==
+                   dequeuePos.load(std::memory_order_relaxed);
+        }
+
+        std::atomic<uint64_t> enqueuePos;
+        alignas(64) std::atomic<uint64_t> dequeuePos;
+        std::array<Slot, SHARD_CAPACITY> slots;
+    };
+
+    // Moves the candidates of the shard to the policy. The caller must hold `mtx`.
+    void flushShardNoLock(Shard& shard);
+
+private:
+    std::unique_ptr<EvictionPolicy> policy;
+    std::unique_ptr<Shard[]> shards;
+    // Taken in shared mode to move candidates to the policy, and in exclusive mode to remove
+    // candidates, so that no candidate is in flight between a shard and the policy.
+    std::shared_mutex mtx;
+    // For each EVICTION_QUEUE_PURGING_INTERVAL candidates moved to the policy, its non-evictable
+    // candidates are removed.
+    std::atomic<uint64_t> numInsertionsSincePurge;
+};
+
+} // namespace storage
+} // namespace kuzu
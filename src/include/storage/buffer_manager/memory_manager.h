@@ -1,11 +1,15 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
-#include <stack>
+#include <string>
+#include <vector>
 
+#include "common/constants.h"
 #include "common/types/types.h"
+#include "storage/buffer_manager/memory_tracker.h"
 
 namespace kuzu {
 namespace common {
@@ -20,65 +24,161 @@ class BufferManager;
 
 class MemoryBuffer {
 public:
-    MemoryBuffer(MemoryAllocator* allocator, common::page_idx_t blockIdx, uint8_t* buffer);
+    MemoryBuffer(MemoryAllocator* allocator, common::page_idx_t blockIdx, uint8_t* buffer,
+        std::shared_ptr<MemoryTracker> memoryTracker = nullptr);
     ~MemoryBuffer();
 
+    // An unpinned buffer may be spilled to disk and evicted by the buffer manager, so its content
+    // must not be accessed until it is pinned again. Each page is mapped to a fixed frame, so the
+    // buffer keeps its address across unpin/pin and pointers into it stay valid.
+    // Unpinning is a no-op if the allocator cannot spill the buffer. Callers are responsible for
+    // not pinning or unpinning the same buffer from multiple threads at the same time.
+    void pin();
+    void unpin();
+    inline bool isPinned() const { return pinned; }
+
 public:
     uint8_t* buffer;
+    // The first page of the buffer in the file of its allocator.
     common::page_idx_t pageIdx;
     MemoryAllocator* allocator;
+
+private:
+    // The tracker of the query which allocated the buffer, which accounts the buffer while it is
+    // pinned.
+    std::shared_ptr<MemoryTracker> memoryTracker;
+    bool pinned;
+};
+
+struct MemoryAllocatorStats {
+    uint64_t bufferSize;
+    // Number of buffers backed by the file of the allocator, including free ones.
+    uint64_t numBuffers;
+    uint64_t numBuffersInUse;
+    uint64_t numAllocations;
+    // Number of times a thread took the lock of the shared free list of the allocator.
+    uint64_t numSharedFreeListAccesses;
+};
+
+// Free list shared by all threads allocating buffers from a MemoryAllocator. It is owned through a
+// shared_ptr, so that thread-local caches outliving the allocator can check whether it still
+// exists.
+struct SharedFreeList {
+    std::mutex mtx;
+    std::vector<common::page_idx_t> pages;
 };
 
 class MemoryAllocator {
     friend class MemoryBuffer;
 
 public:
-    explicit MemoryAllocator(BufferManager* bm, common::VirtualFileSystem* vfs);
+    // Threads cache up to 2 * FREE_LIST_BATCH_SIZE free buffers of each allocator, and exchange
+    // batches of FREE_LIST_BATCH_SIZE buffers with the shared free list.
+    static constexpr uint64_t FREE_LIST_BATCH_SIZE = 16;
+
+    // Each buffer consists of the consecutive pages of a BMFileHandle starting at a multiple of
+    // the number of pages per buffer. Since that number is a power of two dividing the page group
+    // size, the pages of a buffer are mapped to consecutive frames in the VMRegion.
+    // Buffers are only spilled to disk if spillDirectory isn't empty.
+    MemoryAllocator(BufferManager* bm, common::VirtualFileSystem* vfs, uint64_t bufferSize,
+        const std::string& spillDirectory, uint64_t maxSpillSize);
     ~MemoryAllocator();
 
     std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false);
-    inline common::page_offset_t getPageSize() const { return pageSize; }
+    inline uint64_t getBufferSize() const { return bufferSize; }
+    inline const std::string& getSpillFilePath() const { return spillFilePath; }
+
+    MemoryAllocatorStats getStats() const;
 
 private:
-    void freeBlock(common::page_idx_t pageIdx);
+    common::page_idx_t getFreePageIdx();
+    void freeBlock(common::page_idx_t pageIdx, bool isPinned);
+    uint8_t* pinBlock(common::page_idx_t pageIdx,
+        bool readPages /* false if the content of the buffer isn't needed */);
+    void unpinBlock(common::page_idx_t pageIdx, bool spill);
+    // Returns false if the block cannot be spilled, in which case it is left pinned.
+    bool tryUnpinBlock(common::page_idx_t pageIdx);
+
+    // A page is written to the spill file at the offset of its page idx, so limiting spilling to
+    // the pages within maxSpillSize bounds the size of the spill file.
+    inline bool canSpill(common::page_idx_t pageIdx) const {
+        return !spillFilePath.empty() &&
+               ((uint64_t)pageIdx + numPagesPerBuffer) * pageSize <= maxSpillSize;
+    }
 
 private:
+    // Identifies the allocator in the thread-local caches of free buffers. Unlike its address, the
+    // id isn't reused by allocators created later.
+    uint64_t id;
     std::unique_ptr<BMFileHandle> fh;
     BufferManager* bm;
-    common::page_offset_t pageSize;
-    std::stack<common::page_idx_t> freePages;
-    std::mutex allocatorLock;
+    common::VirtualFileSystem* vfs;
+    uint64_t bufferSize;
+    uint64_t pageSize;
+    uint64_t numPagesPerBuffer;
+    // Empty if spilling is disabled, in which case fh is backed by a temp in-mem file.
+    std::string spillFilePath;
+    uint64_t maxSpillSize;
+    std::shared_ptr<SharedFreeList> sharedFreeList;
+    std::atomic<uint64_t> numBuffersInUse;
+    std::atomic<uint64_t> numAllocations;
+    std::atomic<uint64_t> numSharedFreeListAccesses;
 };
 
 /*
  * The Memory Manager (MM) is used for allocating/reclaiming intermediate memory blocks.
- * It can allocate a memory buffer of size PAGE_256KB from the buffer manager backed by a
- * BMFileHandle with temp in-mem file.
+ * It can allocate memory buffers with sizes that are powers of two from MIN_BUFFER_SIZE to
+ * MAX_BUFFER_SIZE from the buffer manager, backed by BMFileHandles with temp in-mem files.
  *
- * Internally, MM uses a MemoryAllocator. The MemoryAllocator is holding the BMFileHandle backed by
- * a temp in-mem file, and responsible for allocating/reclaiming memory buffers of its size class
- * from the buffer manager. The MemoryAllocator keeps track of free pages in the BMFileHandle, so
- * that it can reuse those freed pages without allocating new pages. The MemoryAllocator is
- * thread-safe, so that multiple threads can allocate/reclaim memory blocks with the same size class
- * at the same time.
+ * Internally, MM uses a MemoryAllocator for each size class. A MemoryAllocator holds a
+ * BMFileHandle backed by a temp in-mem file, and is responsible for allocating/reclaiming memory
+ * buffers of its size class from the buffer manager. Buffers smaller than PAGE_256KB_SIZE consist
+ * of 4KB pages, the others of 256KB pages. The MemoryAllocator keeps track of free buffers in the
+ * BMFileHandle, so that it can reuse those freed buffers without allocating new pages. Free
+ * buffers are cached by each thread, so that threads rarely contend on the free list shared by
+ * all threads. The MemoryAllocator is thread-safe, so that multiple threads can allocate/reclaim
+ * memory blocks with the same size class at the same time.
  *
  * MM will return a MemoryBuffer to the caller, which is a wrapper of the allocated memory block,
  * and it will automatically call its allocator to reclaim the memory block when it is destroyed.
+ * Pinned buffers are accounted to the MemoryTracker of the query which allocated them (see
+ * `MemoryTracker`), so buffers which are unpinned and can be spilled don't count towards the
+ * memory limit of the query.
+ *
+ * If a spill directory is given, the BMFileHandle of PAGE_256KB_SIZE buffers, which are used for
+ * factorized tables, is instead backed by a spill file in that directory. Consumers can then unpin
+ * memory buffers they are not accessing, and the BM writes them to the spill file when evicting
+ * them, so intermediate results can exceed the buffer pool size. At most maxSpillSize bytes are
+ * written to the spill file.
  */
 class MemoryManager {
 public:
-    explicit MemoryManager(BufferManager* bm, common::VirtualFileSystem* vfs) : bm{bm} {
-        allocator = std::make_unique<MemoryAllocator>(bm, vfs);
-    }
+    static constexpr uint64_t MIN_BUFFER_SIZE_LOG2 = 12;
+    static constexpr uint64_t MIN_BUFFER_SIZE = (uint64_t)1 << MIN_BUFFER_SIZE_LOG2;
+    static constexpr uint64_t MAX_BUFFER_SIZE_LOG2 = 23;
+    static constexpr uint64_t MAX_BUFFER_SIZE = (uint64_t)1 << MAX_BUFFER_SIZE_LOG2;
 
-    inline std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false) {
-        return allocator->allocateBuffer(initializeToZero);
-    }
+    MemoryManager(BufferManager* bm, common::VirtualFileSystem* vfs,
+        const std::string& spillDirectory = "", uint64_t maxSpillSize = 0);
+
+    // The size of the buffer is rounded up to the next size class.
+    std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false,
+        uint64_t size = common::BufferPoolConstants::PAGE_256KB_SIZE);
     inline BufferManager* getBufferManager() const { return bm; }
+    // The spill file of the 256KB buffers, the only ones which are spilled. Empty if spilling is
+    // disabled.
+    inline const std::string& getSpillFilePath() const {
+        return allocators[getSizeClassIdx(common::BufferPoolConstants::PAGE_256KB_SIZE)]
+            ->getSpillFilePath();
+    }
+
+    std::vector<MemoryAllocatorStats> getStats() const;
+
+    static uint64_t getSizeClassIdx(uint64_t size);
 
 private:
     BufferManager* bm;
-    std::unique_ptr<MemoryAllocator> allocator;
+    std::vector<std::unique_ptr<MemoryAllocator>> allocators;
 };
 } // namespace storage
 } // namespace kuzu
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace kuzu {
+namespace storage {
+
+// A MemoryTracker accounts the memory used by a query: the memory buffers it allocated from the MM
+// while they are pinned (unpinned buffers can be spilled to disk), and the pages it pinned in the
+// BM. If a limit is set, reserving memory beyond it throws a BufferManagerException.
+// The MM and BM account memory to the tracker of the calling thread, which is set for the threads
+// executing a query through a MemoryTrackerScope. The memory of a buffer is released to the tracker
+// which reserved it, so buffers can be freed by other threads or after the query finished.
+// The accounting of BM pages is per thread and approximate instead: a scope releases at most the
+// page memory reserved within it, and releases what is left when it ends. Pages pinned and unpinned
+// in different scopes are therefore only accounted while the scope which pinned them lasts.
+class MemoryTracker : public std::enable_shared_from_this<MemoryTracker> {
+public:
+    static constexpr uint64_t UNLIMITED = UINT64_MAX;
+
+    explicit MemoryTracker(uint64_t limit = UNLIMITED)
+        : limit{limit}, currentMemory{0}, peakMemory{0} {}
+
+    void reserve(uint64_t size);
+    void release(uint64_t size);
+
+    inline uint64_t getLimit() const { return limit; }
+    inline uint64_t getCurrentMemory() const { return currentMemory.load(); }
+    inline uint64_t getPeakMemory() const { return peakMemory.load(); }
+
+    // Returns nullptr if the calling thread doesn't execute a query.
+    static MemoryTracker* getThreadTracker();
+    // Account a page pinned or unpinned in the BM to the tracker of the calling thread, if any.
+    static void reservePage(uint64_t size);
+    static void releasePage(uint64_t size);
+
+private:
+    uint64_t limit;
+    std::atomic<uint64_t> currentMemory;
+    std::atomic<uint64_t> peakMemory;
+};
+
+// Sets the tracker of the calling thread until the scope ends. A nullptr tracker disables tracking.
+class MemoryTrackerScope {
+public:
+    explicit MemoryTrackerScope(MemoryTracker* tracker);
+    ~MemoryTrackerScope();
+
+    MemoryTrackerScope(const MemoryTrackerScope&) = delete;
+    MemoryTrackerScope& operator=(const MemoryTrackerScope&) = delete;
+
+private:
+    MemoryTracker* prevTracker;
+    uint64_t prevPageMemory;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace storage {
+
+class BMFileHandle;
+class BufferManager;
+
+struct PrefetchRequest {
+    BMFileHandle* fileHandle = nullptr;
+    common::page_idx_t startPageIdx = common::INVALID_PAGE_IDX;
+    common::page_idx_t numPages = 0;
+};
+
+// The PagePrefetcher caches pages into the BM on a small pool of I/O threads, so that scans can
+// request the pages they are about to access without waiting for them to be read (see
+// `BufferManager::prefetchPagesAsync`). The threads are started when the first request is
+// scheduled. Prefetching is only a hint: requests are dropped if too many of them are pending, and
+// pages which cannot be prefetched are read when they are pinned.
+class PagePrefetcher {
+public:
+    static constexpr uint64_t NUM_THREADS = 2;
+    static constexpr uint64_t MAX_NUM_PENDING_REQUESTS = 64;
+
+    explicit PagePrefetcher(BufferManager* bm) : bm{bm}, stopped{false} {}
+    ~PagePrefetcher();
+
+    // Returns false if the request is dropped.
+    bool schedule(const PrefetchRequest& request);
+    // Drops the pending requests of the file and waits for the ones being processed, so that the
+    // file handle can be destroyed.
+    void removeRequestsForFile(BMFileHandle* fileHandle);
+    // Waits until all scheduled requests have been processed.
+    void waitForAllRequests();
+
+private:
+    void runWorker();
+
+private:
+    BufferManager* bm;
+    std::mutex mtx;
+    std::condition_variable hasPendingRequestsCV;
+    std::condition_variable requestProcessedCV;
+    std::deque<PrefetchRequest> pendingRequests;
+    // File handles of the requests being processed by the threads.
+    std::vector<BMFileHandle*> activeFileHandles;
+    bool stopped;
+    std::vector<std::thread> threads;
+};
+
+} // namespace storage
+} // namespace kuzu
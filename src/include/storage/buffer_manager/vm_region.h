@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mutex>
+#include <string>
 
 #include "common/constants.h"
 #include "common/types/types.h"
@@ -8,16 +9,37 @@
 namespace kuzu {
 namespace storage {
 
+// Placement of the physical memory of frames on NUMA machines.
+// DEFAULT keeps the memory policy of the process (e.g. as set by numactl). LOCAL allocates the
+// memory of a frame on the node of the thread which first touches it. INTERLEAVE spreads the pages
+// of the frames round-robin across all nodes, which balances the memory bandwidth of the nodes when
+// all threads access the same frames, e.g. when probing a hash table.
+enum class NUMAPolicy : uint8_t { DEFAULT = 0, LOCAL = 1, INTERLEAVE = 2 };
+
+struct NUMAPolicyUtils {
+    static NUMAPolicy fromString(const std::string& str);
+    static std::string toString(NUMAPolicy policy);
+};
+
+struct VMRegionConfig {
+    // Whether to back the frames with transparent huge pages (`MADV_HUGEPAGE`).
+    bool useHugePages = false;
+    NUMAPolicy numaPolicy = NUMAPolicy::DEFAULT;
+};
+
 // A VMRegion holds a virtual memory region of a certain size allocated through mmap.
 // The region is divided into frame groups, each of which is a group of frames of the same size.
 // Each BMFileHandle should grab a frame group each time when they add a new file page group (see
 // `BMFileHandle::addNewPageGroupWithoutLock`). In this way, each file page group uniquely
 // corresponds to a frame group, thus, a page also uniquely corresponds to a frame in a VMRegion.
+// On Linux, the VMRegionConfig controls the use of huge pages and the NUMA placement of the region.
+// Both are hints: they are ignored if the kernel does not support them.
 class VMRegion {
     friend class BufferManager;
 
 public:
-    explicit VMRegion(common::PageSizeClass pageSizeClass, uint64_t maxRegionSize);
+    explicit VMRegion(common::PageSizeClass pageSizeClass, uint64_t maxRegionSize,
+        VMRegionConfig config = VMRegionConfig{});
     ~VMRegion();
 
     common::frame_group_idx_t addNewFrameGroup();
@@ -37,7 +59,14 @@ public:
     }
 #endif
 
+    inline const VMRegionConfig& getConfig() const { return config; }
+
+    // Returns the number of NUMA nodes of the machine, which is 1 if it is not a NUMA machine.
+    static uint64_t getNumNUMANodes();
+
 private:
+    void applyConfig();
+
     inline uint64_t getMaxRegionSize() const {
         return maxNumFrameGroups * frameSize * common::StorageConstants::PAGE_GROUP_SIZE;
     }
@@ -48,6 +77,7 @@ private:
     uint32_t frameSize;
     uint64_t numFrameGroups;
     uint64_t maxNumFrameGroups;
+    VMRegionConfig config;
 };
 
 } // namespace storage
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storage/compression/compression.h"
+
+namespace kuzu {
+namespace storage {
+
+enum class SIMDLevel : uint8_t {
+    SCALAR = 0,
+    AVX2 = 1,
+    AVX512 = 2,
+};
+
+// Bulk unpacking of chunks of 32 values produced by fastpfor's fastpack.
+//
+// Each chunk is stored as a little-endian stream of 32 * bitWidth bits, with the i-th value in bits
+// [i * bitWidth, (i + 1) * bitWidth), regardless of the width of the type being packed. This lets
+// the vectorized kernels unpack 8 (AVX2) or 16 (AVX-512) values at a time with a permute and a pair
+// of variable shifts, and then apply the sign extension and the offset from the BitpackHeader
+// before the values leave the register.
+//
+// The kernel is chosen once at runtime based on the features supported by the CPU. 32 and 64-bit
+// types with any bit width use the vectorized kernels; everything else falls back to fastpfor's
+// scalar unpacking.
+struct BitpackingUtils {
+    static constexpr uint64_t CHUNK_SIZE = 32;
+
+    // Returns the best kernel supported by the current CPU.
+    static SIMDLevel getSupportedSIMDLevel();
+    static const char* toString(SIMDLevel level);
+
+    // Unpacks numChunks consecutive chunks from src into dst, which must have space for
+    // numChunks * CHUNK_SIZE values. Never reads past the end of the last chunk.
+    template<typename T>
+    static void unpackChunks(const uint8_t* src, T* dst, uint64_t numChunks,
+        const BitpackHeader& header) {
+        unpackChunks(src, dst, numChunks, header, getSupportedSIMDLevel());
+    }
+    // Forces a specific kernel. The level must be supported by the CPU.
+    template<typename T>
+    static void unpackChunks(const uint8_t* src, T* dst, uint64_t numChunks,
+        const BitpackHeader& header, SIMDLevel level);
+};
+
+} // namespace storage
+} // namespace kuzu
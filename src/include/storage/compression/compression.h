@@ -1,11 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <cstring>
 #include <optional>
 
 #include "common/types/types.h"
+#include "storage/stats/column_chunk_stats.h"
 
 namespace kuzu {
 namespace common {
@@ -27,6 +29,15 @@ enum class CompressionType : uint8_t {
     INTEGER_BITPACKING = 1,
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
+    FRAME_OF_REFERENCE = 4,
+    DELTA_BITPACKING = 5,
+    ALP = 6,
+    // String data encoded with an FSST symbol table (see fsst.h). Pages store the encoded bytes as
+    // they are, so at the page level this behaves like UNCOMPRESSED; encoding and decoding is done
+    // by the DictionaryColumn.
+    FSST = 7,
+    // Runs of equal values (see run_length_encoding.h).
+    RLE = 8,
 };
 
 struct CompressionMetadata {
@@ -46,6 +57,9 @@ struct CompressionMetadata {
     bool canUpdateInPlace(
         const uint8_t* data, uint32_t pos, common::PhysicalTypeID physicalType) const;
     bool canAlwaysUpdateInPlace() const;
+    // Returns true if values can never be updated in place, so that any update requires the chunk
+    // to be rewritten out of place.
+    bool canNeverUpdateInPlace() const;
     inline bool isConstant() const { return compression == CompressionType::CONSTANT; }
 
     std::string toString() const;
@@ -55,6 +69,8 @@ class CompressionAlg {
 public:
     virtual ~CompressionAlg() = default;
 
+    virtual CompressionType getCompressionType() const = 0;
+
     // Takes a single uncompressed value from the srcBuffer and compresses it into the dstBuffer
     // Offsets refer to value offsets, not byte offsets
     virtual void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
@@ -92,6 +108,19 @@ public:
     virtual void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
         uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
         const CompressionMetadata& metadata) const = 0;
+
+    // Evaluates `value <predicate.comparison> predicate.value` for the numValues values starting
+    // at srcOffset in the page without decompressing them into a vector. The positions
+    // (posInResult + i) of the values which satisfy the predicate are written to
+    // selectedPositions, in ascending order.
+    // Returns the number of selected positions, or std::nullopt if the predicate can't be
+    // evaluated on the compressed data, in which case the values have to be decompressed first.
+    virtual std::optional<uint64_t> selectFromPage(const uint8_t* /*srcBuffer*/,
+        uint64_t /*srcOffset*/, uint64_t /*numValues*/, const ColumnPredicate& /*predicate*/,
+        const CompressionMetadata& /*metadata*/, common::sel_t /*posInResult*/,
+        common::sel_t* /*selectedPositions*/) const {
+        return std::nullopt;
+    }
 };
 
 class ConstantCompression final : public CompressionAlg {
@@ -100,6 +129,9 @@ public:
         : numBytesPerValue{static_cast<uint8_t>(getDataTypeSizeInChunk(logicalType))},
           dataType{logicalType.getPhysicalType()} {}
     static std::optional<CompressionMetadata> analyze(const ColumnChunk& chunk);
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::CONSTANT;
+    }
     template<typename T>
     static const T& getValue(const CompressionMetadata& metadata) {
         return *reinterpret_cast<const T*>(metadata.data.data());
@@ -129,6 +161,11 @@ public:
     void setValuesFromUncompressed(const uint8_t*, common::offset_t, uint8_t*, common::offset_t,
         common::offset_t, const CompressionMetadata&) const override{};
 
+    // The predicate is evaluated once, selecting either all or none of the values
+    std::optional<uint64_t> selectFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+        uint64_t numValues, const ColumnPredicate& predicate, const CompressionMetadata& metadata,
+        common::sel_t posInResult, common::sel_t* selectedPositions) const override;
+
 private:
     uint8_t numBytesPerValue;
     common::PhysicalTypeID dataType;
@@ -138,11 +175,17 @@ private:
 class Uncompressed : public CompressionAlg {
 public:
     explicit Uncompressed(const common::LogicalType& logicalType)
-        : numBytesPerValue{getDataTypeSizeInChunk(logicalType)} {}
-    explicit Uncompressed(uint8_t numBytesPerValue) : numBytesPerValue{numBytesPerValue} {}
+        : numBytesPerValue{getDataTypeSizeInChunk(logicalType)},
+          physicalType{logicalType.getPhysicalType()} {}
+    explicit Uncompressed(uint8_t numBytesPerValue)
+        : numBytesPerValue{numBytesPerValue}, physicalType{common::PhysicalTypeID::ANY} {}
 
     Uncompressed(const Uncompressed&) = default;
 
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::UNCOMPRESSED;
+    }
+
     inline void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
         uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
         const CompressionMetadata& /*metadata*/) const final {
@@ -181,8 +224,14 @@ public:
             srcBuffer + srcOffset * numBytesPerValue, numValues * numBytesPerValue);
     }
 
+    // Only supported for numeric physical types (and not when constructed from a size).
+    std::optional<uint64_t> selectFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+        uint64_t numValues, const ColumnPredicate& predicate, const CompressionMetadata& metadata,
+        common::sel_t posInResult, common::sel_t* selectedPositions) const override;
+
 protected:
     const uint32_t numBytesPerValue;
+    const common::PhysicalTypeID physicalType;
 };
 
 // Serialized as nine bytes.
@@ -219,6 +268,10 @@ public:
     IntegerBitpacking() = default;
     IntegerBitpacking(const IntegerBitpacking&) = default;
 
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::INTEGER_BITPACKING;
+    }
+
     void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
         uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
         const CompressionMetadata& metadata) const final;
@@ -258,6 +311,13 @@ public:
 
     static bool canUpdateInPlace(T value, const BitpackHeader& header);
 
+    // Without negative values the packed values are compared to the predicate shifted by the
+    // offset, so the offset is never applied, and chunks are not unpacked at all if the predicate
+    // selects all or none of the values which can be represented with the bit width.
+    std::optional<uint64_t> selectFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+        uint64_t numValues, const ColumnPredicate& predicate, const CompressionMetadata& metadata,
+        common::sel_t posInResult, common::sel_t* selectedPositions) const final;
+
 protected:
     // Read multiple values from within a chunk. Cannot span multiple chunks.
     void getValues(const uint8_t* chunkStart, uint8_t pos, uint8_t* dst, uint8_t numValuesToRead,
@@ -270,11 +330,115 @@ protected:
     }
 };
 
+// Bitpacking which always uses the minimum value of the chunk as the offset.
+// Unlike IntegerBitpacking, which only applies an offset if the values are all positive or all
+// negative, this never needs a sign bit, so values spanning zero or growing in the negative
+// direction are packed using the width of their range. The data layout is the same as for
+// IntegerBitpacking with hasNegative unset.
+template<typename T>
+class FrameOfReference final : public IntegerBitpacking<T> {
+    using U = std::make_unsigned_t<T>;
+
+public:
+    FrameOfReference() = default;
+    FrameOfReference(const FrameOfReference&) = default;
+
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::FRAME_OF_REFERENCE;
+    }
+
+    BitpackHeader getBitWidth(const uint8_t* srcBuffer, uint64_t numValues) const;
+
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override {
+        auto header = getBitWidth(srcBuffer, numValues);
+        if (header.bitWidth >= sizeof(T) * 8) {
+            return CompressionMetadata();
+        }
+        return CompressionMetadata(CompressionType::FRAME_OF_REFERENCE, header.getData());
+    }
+};
+
+// Stores the differences between consecutive values, bitpacked relative to the smallest
+// difference in the chunk (stored as the BitpackHeader offset). Storing deltas relative to the
+// minimum delta means that values with a fixed stride (e.g. sequential IDs or timestamps at a
+// fixed interval) compress to a bit width of zero, as they would with delta-of-delta encoding.
+//
+// Values are stored in blocks of BLOCK_SIZE values, each starting with the uncompressed first
+// value of the block, followed by the packed deltas for the block. This bounds the number of
+// values which need to be decoded for random access to a single block.
+//
+// Since changing a single value changes the deltas around it, values can never be updated in
+// place and updates to chunks using this compression are always done out of place.
+template<typename T>
+class DeltaBitpacking final : public CompressionAlg {
+    using U = std::make_unsigned_t<T>;
+    // This is an implementation detail of the fastpfor bitpacking algorithm
+    static constexpr uint64_t CHUNK_SIZE = 32;
+
+public:
+    static constexpr uint64_t BLOCK_SIZE = 4 * CHUNK_SIZE;
+    // Positions within a page are stored as uint16_t (see PageCursor). Fixed stride values have a
+    // bit width of zero, so without this limit a page could hold more values than it can address.
+    static constexpr uint64_t MAX_VALUES_PER_PAGE = UINT16_MAX + 1;
+
+    DeltaBitpacking() = default;
+    DeltaBitpacking(const DeltaBitpacking&) = default;
+
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::DELTA_BITPACKING;
+    }
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata) const final;
+
+    BitpackHeader getBitWidth(const uint8_t* srcBuffer, uint64_t numValues) const;
+
+    static inline uint64_t getBlockSize(uint8_t bitWidth) {
+        return sizeof(T) + BLOCK_SIZE * bitWidth / 8;
+    }
+
+    static inline uint64_t numValues(uint64_t dataSize, const BitpackHeader& header) {
+        return std::min(dataSize / getBlockSize(header.bitWidth) * BLOCK_SIZE, MAX_VALUES_PER_PAGE);
+    }
+
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override {
+        auto header = getBitWidth(srcBuffer, numValues);
+        if (header.bitWidth >= sizeof(T) * 8) {
+            return CompressionMetadata();
+        }
+        return CompressionMetadata(CompressionType::DELTA_BITPACKING, header.getData());
+    }
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    static inline bool canUpdateInPlace() { return false; }
+
+protected:
+    // Decodes the values of the block up to (but not including) endPos.
+    void decodeBlock(const uint8_t* blockStart, uint64_t endPos, U* values,
+        const BitpackHeader& header) const;
+    void encodeBlock(const U* values, uint64_t numValuesInBlock, uint8_t* blockStart,
+        const BitpackHeader& header) const;
+};
+
 class BooleanBitpacking : public CompressionAlg {
 public:
     BooleanBitpacking() = default;
     BooleanBitpacking(const BooleanBitpacking&) = default;
 
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::BOOLEAN_BITPACKING;
+    }
+
     void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
         uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
         const CompressionMetadata& metadata) const final;
@@ -302,12 +466,14 @@ public:
 
 protected:
     explicit CompressedFunctor(const common::LogicalType& logicalType)
-        : constant{logicalType}, uncompressed{logicalType}, physicalType{
-                                                                logicalType.getPhysicalType()} {}
+        : constant{logicalType}, uncompressed{logicalType},
+          physicalType{logicalType.getPhysicalType()}, numBytesPerValue{
+                                                           getDataTypeSizeInChunk(logicalType)} {}
     const ConstantCompression constant;
     const Uncompressed uncompressed;
     const BooleanBitpacking booleanBitpacking;
     const common::PhysicalTypeID physicalType;
+    const uint32_t numBytesPerValue;
 };
 
 class ReadCompressedValuesFromPageToVector : public CompressedFunctor {
@@ -330,6 +496,18 @@ public:
         uint32_t startPosInResult, uint64_t numValuesToRead, const CompressionMetadata& metadata);
 };
 
+class SelectCompressedValuesFromPage : public CompressedFunctor {
+public:
+    explicit SelectCompressedValuesFromPage(const common::LogicalType& logicalType)
+        : CompressedFunctor(logicalType) {}
+    SelectCompressedValuesFromPage(const SelectCompressedValuesFromPage&) = default;
+
+    // See CompressionAlg::selectFromPage
+    std::optional<uint64_t> operator()(const uint8_t* frame, PageCursor& pageCursor,
+        uint64_t numValues, const ColumnPredicate& predicate, const CompressionMetadata& metadata,
+        common::sel_t posInResult, common::sel_t* selectedPositions);
+};
+
 class WriteCompressedValuesToPage : public CompressedFunctor {
 public:
     explicit WriteCompressedValuesToPage(const common::LogicalType& logicalType)
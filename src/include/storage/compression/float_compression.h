@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "storage/compression/compression.h"
+
+namespace kuzu {
+namespace storage {
+
+// Serialized in the CompressionMetadata data field as:
+//  byte 0: bit width of the encoded integers
+//  byte 1: exponent
+//  byte 2: factor
+//  bytes 3-4: the number of exceptions which can be stored in each page
+struct ALPHeader {
+    uint8_t bitWidth;
+    uint8_t exponent;
+    uint8_t factor;
+    uint16_t exceptionCapacity;
+
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> getData() const;
+
+    static ALPHeader readHeader(const std::array<uint8_t, CompressionMetadata::DATA_SIZE>& data);
+};
+
+// Lossless floating point compression based on ALP (Afroozeh et al., "ALP: Adaptive Lossless
+// floating-Point Compression", SIGMOD 2024).
+//
+// Values which are decimals with a limited number of digits (e.g. prices, measurements or
+// coordinates) are multiplied by 10^exponent / 10^factor and stored as bitpacked integers with a
+// per-page frame of reference. The exponent and factor are chosen per chunk. Values which don't
+// survive the round trip exactly (including NaN, infinities and -0.0) are stored uncompressed as
+// exceptions and patched in after decoding.
+//
+// Each page is laid out as:
+//  [frame of reference][number of exceptions][exception values][exception positions][packed]
+// Since the exception area has a fixed size for every page in the chunk, the number of values per
+// page only depends on the CompressionMetadata.
+//
+// Decoding a value depends on both the bitpacked integer and the exceptions of its page, neither of
+// which is known to canUpdateInPlace, so updates to chunks using this compression are always done
+// out of place.
+template<typename T>
+class FloatCompression final : public CompressionAlg {
+    static_assert(std::is_floating_point_v<T>);
+
+public:
+    using EncodedType = std::conditional_t<sizeof(T) == sizeof(int64_t), int64_t, int32_t>;
+    using EncodedUType = std::make_unsigned_t<EncodedType>;
+    // This is an implementation detail of the fastpfor bitpacking algorithm
+    static constexpr uint64_t CHUNK_SIZE = 32;
+    // Exception positions are stored as uint16_t
+    static constexpr uint64_t MAX_VALUES_PER_PAGE = UINT16_MAX + 1;
+    static constexpr uint64_t PAGE_HEADER_SIZE = sizeof(EncodedType) + sizeof(uint32_t);
+
+    FloatCompression() = default;
+    FloatCompression(const FloatCompression&) = default;
+
+    inline CompressionType getCompressionType() const override { return CompressionType::ALP; }
+
+    // Shouldn't be used; values are never updated in place (see canUpdateInPlace)
+    void setValuesFromUncompressed(const uint8_t*, common::offset_t, uint8_t*, common::offset_t,
+        common::offset_t, const CompressionMetadata&) const override {
+        KU_UNREACHABLE;
+    }
+
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override;
+
+    static inline uint64_t getExceptionsSize(const ALPHeader& header) {
+        auto size = header.exceptionCapacity * (sizeof(T) + sizeof(uint16_t));
+        // Keep the packed data aligned for fastpfor
+        return (size + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+    }
+
+    static uint64_t numValues(uint64_t dataSize, const ALPHeader& header);
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const override;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const override;
+
+    static inline bool canUpdateInPlace() { return false; }
+
+    // Returns true if the value can be encoded with the given exponent and factor and decoded back
+    // to the exact same value.
+    static bool encode(T value, uint8_t exponent, uint8_t factor, EncodedType& encoded);
+    static T decode(EncodedType encoded, uint8_t exponent, uint8_t factor);
+
+private:
+    std::pair<uint8_t, uint8_t> chooseExponentAndFactor(const T* values, uint64_t numValues) const;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kuzu {
+namespace storage {
+
+// Symbol table for string compression based on FSST (Boncz et al., "FSST: Fast Random Access String
+// Compression", VLDB 2020).
+//
+// Strings are encoded as a sequence of 1-byte codes, each referring to a symbol of 1 to 8 bytes in
+// the table. Bytes which aren't covered by any symbol are written as an escape code followed by the
+// literal byte. Each string is encoded independently, so any string can be decoded on its own given
+// only the symbol table and its encoded bytes.
+class FSSTSymbolTable {
+public:
+    static constexpr uint64_t MAX_SYMBOL_LENGTH = 8;
+    static constexpr uint64_t MAX_NUM_SYMBOLS = 255;
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    // Number of symbols, symbol lengths and symbol data
+    static constexpr uint64_t MAX_SERIALIZED_SIZE =
+        1 + MAX_NUM_SYMBOLS + MAX_NUM_SYMBOLS * MAX_SYMBOL_LENGTH;
+    // Every byte is escaped in the worst case
+    static constexpr uint64_t MAX_ENCODED_SIZE_FACTOR = 2;
+
+    FSSTSymbolTable();
+
+    // Builds a symbol table from (a sample of) the given strings.
+    static FSSTSymbolTable build(const std::vector<std::string_view>& strings);
+
+    // Appends the encoded value to the result.
+    void encode(std::string_view value, std::string& result) const;
+    uint64_t getDecodedSize(const uint8_t* data, uint64_t size) const;
+    // Decodes the value into the result, which must have space for getDecodedSize(data, size)
+    // bytes.
+    void decode(const uint8_t* data, uint64_t size, uint8_t* result) const;
+
+    inline uint64_t getNumSymbols() const { return numSymbols; }
+
+    uint64_t getSerializedSize() const;
+    void serialize(uint8_t* buffer) const;
+    // The buffer must contain at least getSerializedSize() bytes of the serialized table.
+    static FSSTSymbolTable deserialize(const uint8_t* buffer);
+
+private:
+    void addSymbol(std::string_view symbol);
+    // Returns the code of the longest symbol matching the start of the value, or ESCAPE_CODE if
+    // there is none.
+    uint8_t findLongestSymbol(std::string_view value) const;
+
+private:
+    uint64_t numSymbols;
+    std::array<std::array<uint8_t, MAX_SYMBOL_LENGTH>, MAX_NUM_SYMBOLS> symbols;
+    std::array<uint8_t, MAX_NUM_SYMBOLS> lengths;
+    // Codes of the symbols starting with each byte, longest symbols first.
+    std::array<std::vector<uint8_t>, 256> codesByFirstByte;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storage/compression/compression.h"
+
+namespace kuzu {
+namespace storage {
+
+// Run-length encoding for fixed-size values. This is meant for columns which are sorted or
+// clustered (e.g. after copying sorted input), which have long runs of equal values but aren't
+// constant over the whole chunk.
+//
+// Each page stores the runs overlapping its values, laid out as:
+//  [number of runs (uint32_t)][run capacity (uint32_t)][last position of each run][run values]
+// where the last positions are uint16_t offsets within the page.
+//
+// Lookups need to find the page containing a value without reading any pages, so every page of a
+// chunk holds the same number of values. This number is chosen so that no page of the chunk
+// contains more runs than fit in a page. It is stored in the first four bytes of the
+// CompressionMetadata data field.
+//
+// Changing a single value splits or merges runs, so updates to chunks using this compression are
+// always done out of place.
+class RunLengthEncoding final : public CompressionAlg {
+public:
+    // Positions within a page are stored as uint16_t
+    static constexpr uint64_t MAX_VALUES_PER_PAGE = UINT16_MAX + 1;
+    static constexpr uint64_t PAGE_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+    explicit RunLengthEncoding(uint32_t numBytesPerValue) : numBytesPerValue{numBytesPerValue} {}
+    RunLengthEncoding(const RunLengthEncoding&) = default;
+
+    inline CompressionType getCompressionType() const override { return CompressionType::RLE; }
+
+    // Shouldn't be used; values are never updated in place (see canUpdateInPlace)
+    void setValuesFromUncompressed(const uint8_t*, common::offset_t, uint8_t*, common::offset_t,
+        common::offset_t, const CompressionMetadata&) const override {
+        KU_UNREACHABLE;
+    }
+
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override;
+
+    static uint64_t numValues(const CompressionMetadata& metadata);
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const override;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const override;
+
+    // Returns true if the values [srcOffset, srcOffset + numValues) of the page all belong to the
+    // same run.
+    bool isSingleRun(const uint8_t* srcBuffer, uint64_t srcOffset, uint64_t numValues) const;
+
+    static inline bool canUpdateInPlace() { return false; }
+
+private:
+    inline uint64_t getRunCapacity(uint64_t dataSize) const {
+        return (dataSize - PAGE_HEADER_SIZE) / (numBytesPerValue + sizeof(uint16_t));
+    }
+    // Returns the index of the run containing the value at the given position in the page.
+    uint32_t findRun(const uint8_t* page, uint64_t pos) const;
+    void fill(uint8_t* dst, const uint8_t* value, uint64_t numValues) const;
+
+private:
+    const uint32_t numBytesPerValue;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -30,6 +30,9 @@ public:
     constexpr static uint8_t O_PERSISTENT_FILE_NO_CREATE{0b0000'0000};
     constexpr static uint8_t O_PERSISTENT_FILE_CREATE_NOT_EXISTS{0b0000'0100};
     constexpr static uint8_t O_IN_MEM_TEMP_FILE{0b0000'0011};
+    constexpr static uint8_t O_IN_MEM_TEMP_FILE_4KB_PAGED{0b0000'0010};
+    // Large-paged file on disk that intermediate memory buffers are spilled to.
+    constexpr static uint8_t O_SPILL_FILE{0b0000'0101};
 
     FileHandle(const std::string& path, uint8_t flags, common::VirtualFileSystem* vfs);
     virtual ~FileHandle() = default;
@@ -11,6 +11,7 @@ class TableCatalogEntry;
 namespace storage {
 
 class MemoryManager;
+class TableStatistics;
 
 // Data structures in LocalStorage are not thread-safe.
 // For now, we only support single thread insertions and updates. Once we optimize them with
@@ -30,8 +31,17 @@ public:
     LocalTableData* getLocalTableData(common::table_id_t tableID, common::vector_idx_t dataIdx = 0);
     std::unordered_set<common::table_id_t> getTableIDsWithUpdates();
 
+    inline std::unordered_map<common::table_id_t, std::shared_ptr<TableStatistics>>&
+    getTableStatistics() {
+        return tableStatistics;
+    }
+
 private:
     std::unordered_map<common::table_id_t, std::unique_ptr<LocalTable>> tables;
+    // Statistics of the tables written by a concurrent write transaction, which are private to
+    // the transaction until it commits. See TablesStatistics. These are shared pointers so that
+    // the local storage can be destroyed where TableStatistics is an incomplete type.
+    std::unordered_map<common::table_id_t, std::shared_ptr<TableStatistics>> tableStatistics;
     storage::MemoryManager* mm;
 };
 
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <optional>
+
+#include "common/enums/expression_type.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Value;
+} // namespace common
+
+namespace storage {
+
+// Fixed-size storage for a single numeric value. Signed integers are widened to int64_t, unsigned
+// integers to uint64_t and floating point values to double, so that the union can be stored inside
+// the on-disk ColumnChunkMetadata.
+union StorageValue {
+    int64_t signedInt;
+    uint64_t unsignedInt;
+    double floatVal;
+
+    StorageValue() : unsignedInt{0} {}
+
+    template<typename T>
+    static StorageValue create(T value) {
+        StorageValue result;
+        if constexpr (std::is_floating_point_v<T>) {
+            result.floatVal = value;
+        } else if constexpr (std::is_signed_v<T>) {
+            result.signedInt = value;
+        } else {
+            result.unsignedInt = value;
+        }
+        return result;
+    }
+
+    // Returns std::nullopt if the value is null or its physical type has no zone map support.
+    static std::optional<StorageValue> fromValue(const common::Value& value);
+
+    double toDouble(common::PhysicalTypeID physicalType) const;
+};
+
+// A comparison between a column and a constant (e.g. `a.age > 30`), normalized so that the column
+// is on the left hand side.
+struct ColumnPredicate {
+    common::column_id_t columnID;
+    common::ExpressionType comparison;
+    StorageValue value;
+
+    ColumnPredicate(
+        common::column_id_t columnID, common::ExpressionType comparison, StorageValue value)
+        : columnID{columnID}, comparison{comparison}, value{value} {}
+};
+
+// Min/max statistics (zone map) of the non-null values in a column chunk.
+// Statistics are only maintained for fixed-sized numeric physical types. For other types, or for
+// chunks written before statistics were collected, `hasStats` is false and nothing can be skipped.
+struct ColumnChunkStats {
+    StorageValue min;
+    StorageValue max;
+    // Set if min/max are maintained for this chunk.
+    bool hasStats = false;
+    // Set if the chunk contains at least one non-null value. If false, min/max are meaningless.
+    bool hasValues = false;
+
+    static bool isSupported(common::PhysicalTypeID physicalType);
+    static inline ColumnChunkStats empty() {
+        ColumnChunkStats stats;
+        stats.hasStats = true;
+        return stats;
+    }
+
+    // Widens the range so that it includes the given non-null value. Returns true if the
+    // statistics changed and need to be written back.
+    bool update(StorageValue value, common::PhysicalTypeID physicalType);
+    bool update(const uint8_t* data, common::offset_t pos, common::PhysicalTypeID physicalType);
+
+    // Returns true if no value in the chunk can satisfy `value <comparison> predicate.value`.
+    // Null values never satisfy a comparison, so chunks without non-null values can always be
+    // skipped.
+    bool canSkip(const ColumnPredicate& predicate, common::PhysicalTypeID physicalType) const;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Equi-depth histogram over the non-null values of a numeric property. The NUM_BUCKETS + 1
+// boundaries split the values into buckets holding the same fraction of the values, which are
+// assumed to be uniformly distributed within each bucket. Buckets whose lower and upper boundaries
+// are equal hold a single value, so frequent values show up as runs of equal boundaries.
+//
+// Histograms are built from a sample of the values appended at once (e.g. a column chunk during
+// COPY) and merged into the histogram of the property. Merging combines the distributions of both
+// histograms weighted by their number of values and recomputes the boundaries from the result, so
+// the histogram never needs access to the original values.
+class EquiDepthHistogram {
+public:
+    static constexpr uint64_t NUM_BUCKETS = 32;
+
+    EquiDepthHistogram() = default;
+
+    // Builds a histogram from a sample of values, standing for numValues values.
+    static EquiDepthHistogram build(std::vector<double> sample, uint64_t numValues);
+
+    inline bool isEmpty() const { return numValues == 0; }
+    inline uint64_t getNumValues() const { return numValues; }
+    inline const std::vector<double>& getBoundaries() const { return boundaries; }
+
+    void merge(const EquiDepthHistogram& other);
+
+    // Estimated fraction of the values which are less than (or, if inclusive, equal to) value.
+    double estimateFractionBelow(double value, bool inclusive) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static EquiDepthHistogram deserialize(common::Deserializer& deserializer);
+
+private:
+    std::vector<double> boundaries;
+    uint64_t numValues = 0;
+};
+
+} // namespace storage
+} // namespace kuzu
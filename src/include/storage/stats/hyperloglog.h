@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// HyperLogLog sketch estimating the number of distinct values of a property (Flajolet et al.,
+// "HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm").
+// There are 2^PRECISION one-byte registers, giving a standard error of about 3%. Registers are
+// only allocated once the first value is added, so empty sketches don't take any space.
+class HyperLogLog {
+public:
+    static constexpr uint8_t PRECISION = 10;
+    static constexpr uint64_t NUM_REGISTERS = 1 << PRECISION;
+
+    inline bool isEmpty() const { return registers.empty(); }
+
+    // Values are added by their hash, which must be uniformly distributed (see hash()).
+    void add(uint64_t hash);
+    void merge(const HyperLogLog& other);
+    uint64_t estimate() const;
+
+    static uint64_t hash(uint64_t value);
+    static uint64_t hash(const uint8_t* value, uint32_t numBytes);
+    static uint64_t hash(std::string_view value);
+
+    void serialize(common::Serializer& serializer) const;
+    static HyperLogLog deserialize(common::Deserializer& deserializer);
+
+private:
+    std::vector<uint8_t> registers;
+};
+
+} // namespace storage
+} // namespace kuzu
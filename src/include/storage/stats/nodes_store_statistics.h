@@ -1,6 +1,7 @@
 #pragma once
 
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/cast.h"
 #include "storage/stats/node_table_statistics.h"
 #include "storage/stats/table_statistics_collection.h"
 #include "storage/storage_utils.h"
@@ -52,23 +53,16 @@ public:
         return readOnlyVersion->tableStatisticPerTable.size();
     }
 
-    // This function assumes that there is a single write transaction. That is why for now we
-    // keep the interface simple and no transaction is passed.
-    inline common::offset_t addNode(common::table_id_t tableID) {
+    inline common::offset_t addNode(
+        transaction::Transaction* transaction, common::table_id_t tableID) {
         lock_t lck{mtx};
-        initTableStatisticsForWriteTrxNoLock();
-        KU_ASSERT(readWriteVersion && readWriteVersion->tableStatisticPerTable.contains(tableID));
-        setToUpdated();
-        return getNodeTableStats(transaction::TransactionType::WRITE, tableID)->addNode();
+        return getNodeTableStatsForWriteNoLock(transaction, tableID)->addNode();
     }
 
-    // Refer to the comments for addNode.
-    inline void deleteNode(common::table_id_t tableID, common::offset_t nodeOffset) {
+    inline void deleteNode(transaction::Transaction* transaction, common::table_id_t tableID,
+        common::offset_t nodeOffset) {
         lock_t lck{mtx};
-        initTableStatisticsForWriteTrxNoLock();
-        KU_ASSERT(readWriteVersion && readWriteVersion->tableStatisticPerTable.contains(tableID));
-        setToUpdated();
-        getNodeTableStats(transaction::TransactionType::WRITE, tableID)->deleteNode(nodeOffset);
+        getNodeTableStatsForWriteNoLock(transaction, tableID)->deleteNode(nodeOffset);
     }
 
     // This function is only used by storageManager to construct relsStore during start-up, so
@@ -104,6 +98,12 @@ protected:
     }
 
 private:
+    inline NodeTableStatsAndDeletedIDs* getNodeTableStatsForWriteNoLock(
+        transaction::Transaction* transaction, common::table_id_t tableID) {
+        return common::ku_dynamic_cast<TableStatistics*, NodeTableStatsAndDeletedIDs*>(
+            getTableStatisticsForWriteNoLock(transaction, tableID));
+    }
+
     inline NodeTableStatsAndDeletedIDs* getNodeTableStats(
         transaction::TransactionType transactionType, common::table_id_t tableID) const {
         return transactionType == transaction::TransactionType::READ_ONLY ?
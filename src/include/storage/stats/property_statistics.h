@@ -1,19 +1,46 @@
 #pragma once
 
 #include "common/types/types.h"
+#include "storage/stats/column_chunk_stats.h"
+#include "storage/stats/histogram.h"
+#include "storage/stats/hyperloglog.h"
 
 namespace kuzu {
+namespace common {
+class ValueVector;
+} // namespace common
 namespace transaction {
 class Transaction;
 };
 namespace storage {
 
+class ColumnChunk;
+
+// Statistics of a property used for cardinality estimation. Besides whether the property may
+// contain nulls, they describe the distribution of its non-null values:
+//  - the number of non-null values,
+//  - the range of values (only for numeric physical types, see ColumnChunkStats),
+//  - a HyperLogLog sketch of the number of distinct values (fixed-size and string types),
+//  - an equi-depth histogram (numeric physical types).
+// They are collected when values are appended to a table (COPY and committed inserts/updates)
+// and are only ever widened: values which are overwritten or deleted are not removed, so the
+// statistics describe a superset of the current values.
 class PropertyStatistics {
 public:
     PropertyStatistics() = default;
     explicit PropertyStatistics(bool mayHaveNullValue) : mayHaveNullValue{mayHaveNullValue} {}
 
     inline bool mayHaveNull() const { return mayHaveNullValue; }
+    inline uint64_t getNumValues() const { return numValues; }
+    inline const ColumnChunkStats& getRange() const { return range; }
+    inline const EquiDepthHistogram& getHistogram() const { return histogram; }
+    // Estimated number of distinct non-null values, or 0 if unknown.
+    inline uint64_t estimateNumDistinctValues() const {
+        return std::min(distinctValues.estimate(), numValues);
+    }
+
+    // Merges the statistics of newly appended values.
+    void merge(const PropertyStatistics& other);
 
     void serialize(common::Serializer& serializer) const;
     static std::unique_ptr<PropertyStatistics> deserialize(common::Deserializer& deserializer);
@@ -21,9 +48,50 @@ public:
     inline void setHasNull() { mayHaveNullValue = true; }
 
 private:
+    friend class PropertyStatisticsCollector;
+
     // Stores whether or not the property is known to have contained a null value
     // If false, the property is guaranteed to not contain any nulls
     bool mayHaveNullValue = false;
+    uint64_t numValues = 0;
+    // Physical type of the values the range was collected from
+    common::PhysicalTypeID physicalType = common::PhysicalTypeID::ANY;
+    ColumnChunkStats range;
+    HyperLogLog distinctValues;
+    EquiDepthHistogram histogram;
+};
+
+// Computes the statistics of a batch of values being appended to a property (e.g. a column chunk
+// being copied), to be merged into the statistics of the property.
+class PropertyStatisticsCollector {
+public:
+    // Histograms are built from a uniform sample of at most this many values.
+    static constexpr uint64_t MAX_SAMPLE_SIZE = 4096;
+
+    explicit PropertyStatisticsCollector(common::PhysicalTypeID physicalType);
+
+    void add(const ColumnChunk& chunk, common::offset_t startOffset, common::offset_t numValues);
+    void add(const common::ValueVector& vector, common::sel_t pos, uint64_t numRepetitions = 1);
+
+    PropertyStatistics finalize();
+
+private:
+    void addNull();
+    void addFixedSizeValue(const uint8_t* value, uint64_t numRepetitions = 1);
+    inline void addString(std::string_view value, uint64_t numRepetitions = 1) {
+        stats.numValues += numRepetitions;
+        stats.distinctValues.add(HyperLogLog::hash(value));
+    }
+    void addToSample(double value);
+
+private:
+    common::PhysicalTypeID physicalType;
+    uint32_t numBytesPerValue;
+    bool hasHistogram;
+    PropertyStatistics stats;
+    std::vector<double> sample;
+    uint64_t numValuesSeenBySample;
+    uint64_t randomState;
 };
 
 class TablesStatistics;
@@ -41,6 +109,8 @@ public:
 
     bool mayHaveNull(const transaction::Transaction& transaction);
     void setHasNull(const transaction::Transaction& transaction);
+    // Merges the statistics of newly appended values into the write version of the statistics.
+    void update(const PropertyStatistics& newStats);
 
 private:
     TablesStatistics* tablesStatistics;
@@ -37,7 +37,8 @@ public:
 
     void setNumTuplesForTable(common::table_id_t relTableID, uint64_t numRels) override;
 
-    void updateNumRelsByValue(common::table_id_t relTableID, int64_t value);
+    void updateNumRelsByValue(
+        transaction::Transaction* transaction, common::table_id_t relTableID, int64_t value);
 
     common::offset_t getNextRelOffset(
         transaction::Transaction* transaction, common::table_id_t tableID);
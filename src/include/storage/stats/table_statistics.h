@@ -31,6 +31,9 @@ public:
         numTuples = numTuples_;
     }
 
+    inline bool hasPropertyStatistics(common::property_id_t propertyID) const {
+        return propertyStatistics.contains(propertyID);
+    }
     inline PropertyStatistics& getPropertyStatistics(common::property_id_t propertyID) {
         KU_ASSERT(propertyStatistics.contains(propertyID));
         return *(propertyStatistics.at(propertyID));
@@ -30,6 +30,10 @@ public:
 
     inline bool hasUpdates() const { return isUpdated; }
 
+    // Moves the statistics written by a concurrent write transaction into the write version, so
+    // that they are committed with the transaction.
+    void applyLocalTableStatistics(transaction::Transaction* transaction);
+
     inline void checkpointInMemoryIfNecessary() {
         std::unique_lock lck{mtx};
         readOnlyVersion = std::move(readWriteVersion);
@@ -63,6 +67,10 @@ public:
 
     void setPropertyStatisticsForTable(
         common::table_id_t tableID, common::property_id_t propertyID, PropertyStatistics stats);
+    // Merges the statistics of newly appended values into the write version of the statistics.
+    // This may be called concurrently, e.g. by multiple threads copying into the same table.
+    void mergePropertyStatisticsForTable(common::table_id_t tableID,
+        common::property_id_t propertyID, const PropertyStatistics& stats);
 
     static std::unique_ptr<MetadataDAHInfo> createMetadataDAHInfo(
         const common::LogicalType& dataType, BMFileHandle& metadataFH, BufferManager* bm, WAL* wal);
@@ -87,6 +95,17 @@ protected:
 
     void initTableStatisticsForWriteTrxNoLock();
 
+    // Returns the statistics of the table in the version read by the transaction. The caller must
+    // hold `mtx`.
+    TableStatistics* getTableStatisticsNoLock(
+        transaction::Transaction* transaction, common::table_id_t tableID);
+    // Returns the statistics of the table to be updated by the write transaction. A concurrent
+    // write transaction updates a private copy of them in its local storage, which is made when
+    // it first updates them, so that other transactions do not read its uncommitted changes. The
+    // caller must hold `mtx`.
+    TableStatistics* getTableStatisticsForWriteNoLock(
+        transaction::Transaction* transaction, common::table_id_t tableID);
+
     inline void setToUpdated() { isUpdated = true; }
     inline void resetToNotUpdated() { isUpdated = false; }
 
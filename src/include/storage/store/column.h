@@ -25,6 +25,10 @@ using read_values_to_page_func_t =
         uint32_t posInResult, uint64_t numValues, const CompressionMetadata& metadata)>;
 // This is a special usage for the `batchLookup` interface.
 using batch_lookup_func_t = read_values_to_page_func_t;
+using select_values_func_t = std::function<std::optional<uint64_t>(const uint8_t* frame,
+    PageCursor& pageCursor, uint64_t numValues, const ColumnPredicate& predicate,
+    const CompressionMetadata& metadata, common::sel_t posInResult,
+    common::sel_t* selectedPositions)>;
 
 class NullColumn;
 class StructColumn;
@@ -60,14 +64,29 @@ public:
     virtual void scan(transaction::Transaction* transaction, common::node_group_idx_t nodeGroupIdx,
         ColumnChunk* columnChunk, common::offset_t startOffset = 0,
         common::offset_t endOffset = common::INVALID_OFFSET);
+    // Scans the column, removing the nodes whose value doesn't satisfy the predicate from the
+    // selection vector of the node ID vector. The predicate is evaluated on the compressed pages
+    // where the compression supports it, and only the values of the remaining nodes are
+    // decompressed into the result vector.
+    // Only supported for the physical types with zone maps (see ColumnChunkStats::isSupported).
+    void scan(transaction::Transaction* transaction, common::ValueVector* nodeIDVector,
+        common::ValueVector* resultVector, const ColumnPredicate& predicate);
     virtual void lookup(transaction::Transaction* transaction, common::ValueVector* nodeIDVector,
         common::ValueVector* resultVector);
 
+    // Scans read ahead by windows of PREFETCH_WINDOW_SIZE values.
+    static constexpr uint64_t PREFETCH_WINDOW_SIZE = 16 * common::DEFAULT_VECTOR_CAPACITY;
+    // Prefetches the pages holding the values [startOffsetInGroup, endOffsetInGroup) of the node
+    // group and their nulls into the BM, see `BufferManager::prefetchPages`.
+    void prefetch(transaction::Transaction* transaction, common::node_group_idx_t nodeGroupIdx,
+        common::offset_t startOffsetInGroup, common::offset_t endOffsetInGroup, bool async);
+
     virtual void append(ColumnChunk* columnChunk, uint64_t nodeGroupIdx);
 
     inline common::LogicalType& getDataType() { return dataType; }
     inline const common::LogicalType& getDataType() const { return dataType; }
     inline uint32_t getNumBytesPerValue() const { return numBytesPerFixedSizedValue; }
+    inline RWPropertyStats& getPropertyStatistics() { return propertyStatistics; }
     inline uint64_t getNumNodeGroups(transaction::Transaction* transaction) const {
         return metadataDA->getNumElements(transaction->getType());
     }
@@ -119,9 +138,14 @@ public:
 protected:
     virtual void scanInternal(transaction::Transaction* transaction,
         common::ValueVector* nodeIDVector, common::ValueVector* resultVector);
+    // If isConstant is given, it is set to whether all scanned values are known to be equal
+    // without comparing them (i.e. they come from constant chunks or single runs).
     void scanUnfiltered(transaction::Transaction* transaction, PageCursor& pageCursor,
         uint64_t numValuesToScan, common::ValueVector* resultVector,
-        const ColumnChunkMetadata& chunkMeta, uint64_t startPosInVector = 0);
+        const ColumnChunkMetadata& chunkMeta, uint64_t startPosInVector = 0,
+        bool* isConstant = nullptr);
+    // Returns true if scanUnfiltered should check whether the scanned values are all equal.
+    bool canScanAsConstant(common::ValueVector* resultVector) const;
     void scanFiltered(transaction::Transaction* transaction, PageCursor& pageCursor,
         common::ValueVector* nodeIDVector, common::ValueVector* resultVector,
         const ColumnChunkMetadata& chunkMeta);
@@ -132,6 +156,24 @@ protected:
 
     void readFromPage(transaction::Transaction* transaction, common::page_idx_t pageIdx,
         const std::function<void(uint8_t*)>& func);
+    // Reads the pages in [startPageIdx, startPageIdx + numPages) in extents of consecutive pages,
+    // each of which is validated and, if evicted, cached as a whole (see
+    // `BufferManager::optimisticReadPages`). `func` is called with the frame and idx of each page.
+    void readFromPages(transaction::Transaction* transaction, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages, const std::function<void(uint8_t*, common::page_idx_t)>& func);
+    // Reads the pages holding numValuesToScan values from the cursor with `readFromPages`, and
+    // calls `func` for each page with a cursor to the first value to scan in it, the number of
+    // values scanned before the page and the number of values to scan in it. The cursor is moved to
+    // the page after the last scanned one.
+    void scanPages(transaction::Transaction* transaction, PageCursor& cursor,
+        uint64_t numValuesPerPage, uint64_t numValuesToScan,
+        const std::function<void(uint8_t*, PageCursor&, uint64_t, uint64_t)>& func);
+    // Only prefetches the pages of this column, not the ones of its null column.
+    void prefetchPages(const ColumnChunkMetadata& chunkMeta, common::offset_t startOffsetInGroup,
+        common::offset_t endOffsetInGroup, bool async);
+    // Called by node scans for each vector. The first window of a chunk is read when the scan
+    // starts, and the next window is read asynchronously whenever the scan reaches a new window.
+    void readAhead(const ColumnChunkMetadata& chunkMeta, common::offset_t offsetInChunk);
 
     virtual void writeValue(const ColumnChunkMetadata& chunkMeta,
         common::node_group_idx_t nodeGroupIdx, common::offset_t offsetInChunk,
@@ -213,6 +255,7 @@ protected:
     write_values_func_t writeFunc;
     read_values_to_page_func_t readToPageFunc;
     batch_lookup_func_t batchLookupFunc;
+    select_values_func_t selectFunc;
     RWPropertyStats propertyStatistics;
     bool enableCompression;
 };
@@ -8,6 +8,7 @@
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/bm_file_handle.h"
 #include "storage/compression/compression.h"
+#include "storage/stats/column_chunk_stats.h"
 
 namespace kuzu {
 namespace storage {
@@ -20,6 +21,8 @@ struct ColumnChunkMetadata {
     common::page_idx_t numPages;
     uint64_t numValues;
     CompressionMetadata compMeta;
+    // Zone map of the chunk, used to skip chunks during scans with pushed-down predicates.
+    ColumnChunkStats stats;
 
     ColumnChunkMetadata() : pageIdx{common::INVALID_PAGE_IDX}, numPages{0}, numValues{0} {}
     ColumnChunkMetadata(common::page_idx_t pageIdx, common::page_idx_t numPages,
@@ -54,6 +57,8 @@ public:
 
     // Note that the startPageIdx is not known, so it will always be common::INVALID_PAGE_IDX
     virtual ColumnChunkMetadata getMetadataToFlush() const;
+    // Computes min/max of the non-null values in the chunk.
+    ColumnChunkStats computeStats() const;
 
     virtual void append(common::ValueVector* vector, common::SelectionVector& selVector);
     virtual void append(
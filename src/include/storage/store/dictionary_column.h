@@ -1,11 +1,47 @@
 #pragma once
 
 #include "dictionary_chunk.h"
+#include "storage/compression/fsst.h"
 #include "storage/store/column.h"
 
 namespace kuzu {
 namespace storage {
 
+// A filter on a STRING column which only depends on the value of the string (`=`, `IN` and
+// `STARTS WITH` with literals). It can be evaluated once per dictionary entry instead of once per
+// row.
+struct StringColumnPredicate {
+    enum class Type : uint8_t {
+        EQUALS = 0,
+        IN = 1,
+        STARTS_WITH = 2,
+    };
+
+    common::column_id_t columnID;
+    Type type;
+    // The literal for EQUALS and STARTS_WITH, or the list elements for IN.
+    std::vector<std::string> values;
+
+    StringColumnPredicate(
+        common::column_id_t columnID, Type type, std::vector<std::string> values)
+        : columnID{columnID}, type{type}, values{std::move(values)} {}
+
+    bool evaluate(std::string_view value) const;
+};
+
+// Scan state of a StringColumnPredicate. Which dictionary indices satisfy the predicate is
+// computed once per node group and re-used for every vector scanned from it.
+struct DictionaryFilter {
+    StringColumnPredicate predicate;
+    common::node_group_idx_t nodeGroupIdx = common::INVALID_NODE_GROUP_IDX;
+    // Set if the dictionary of the node group is small enough for filtering on its indices to be
+    // worthwhile.
+    bool useDictionary = false;
+    std::vector<bool> matchingIndices;
+
+    explicit DictionaryFilter(StringColumnPredicate predicate) : predicate{std::move(predicate)} {}
+};
+
 class DictionaryColumn {
 public:
     DictionaryColumn(const std::string& name, const MetadataDAHInfo& metaDAHeaderInfo,
@@ -22,6 +58,11 @@ public:
         std::vector<std::pair<DictionaryChunk::string_index_t, uint64_t>>& offsetsToScan,
         common::ValueVector* resultVector, const ColumnChunkMetadata& indexMeta);
 
+    // Evaluates the predicate on every string in the dictionary of the node group. The result is
+    // indexed by the dictionary index of the string.
+    void evaluate(transaction::Transaction* transaction, common::node_group_idx_t nodeGroupIdx,
+        const StringColumnPredicate& predicate, std::vector<bool>& result);
+
     DictionaryChunk::string_index_t append(
         common::node_group_idx_t nodeGroupIdx, std::string_view val);
 
@@ -39,12 +80,23 @@ public:
     inline Column* getOffsetColumn() const { return offsetColumn.get(); }
 
 private:
+    // Returns the symbol table if the string data of the node group is FSST-encoded.
+    std::optional<FSSTSymbolTable> readSymbolTable(
+        transaction::Transaction* transaction, const Column::ReadState& dataState);
+    // Encodes the strings of the chunk with a new symbol table, which is written at the start of
+    // the string data. Returns false if that would not make the data smaller.
+    bool compressData(const DictionaryChunk& dictChunk, ColumnChunk& dataChunk,
+        ColumnChunk& offsetChunk) const;
+    // Decodes the string data scanned into the chunk, keeping the dictionary indices intact.
+    static void decompressData(DictionaryChunk& dictChunk);
+
     void scanOffsets(transaction::Transaction* transaction, const Column::ReadState& state,
         DictionaryChunk::string_offset_t* offsets, uint64_t index, uint64_t numValues,
         uint64_t dataSize);
     void scanValueToVector(transaction::Transaction* transaction,
         const Column::ReadState& dataState, uint64_t startOffset, uint64_t endOffset,
-        common::ValueVector* resultVector, uint64_t offsetInVector);
+        common::ValueVector* resultVector, uint64_t offsetInVector,
+        const FSSTSymbolTable* symbolTable);
 
     bool canDataCommitInPlace(transaction::Transaction* transaction,
         common::node_group_idx_t nodeGroupIdx, uint64_t totalStringLengthToAdd);
@@ -56,8 +108,12 @@ private:
     // The offset column stores the offsets for each index, and the data column stores the data in
     // order. Values are never removed from the dictionary during in-place updates, only appended to
     // the end.
+    // If compression is enabled, the data of a node group may be FSST-encoded, in which case the
+    // data starts with the serialized symbol table, followed by the encoded strings. The offsets
+    // then refer to the encoded strings.
     std::unique_ptr<Column> dataColumn;
     std::unique_ptr<Column> offsetColumn;
+    bool enableCompression;
 };
 
 } // namespace storage
@@ -47,6 +47,10 @@ public:
     void read(transaction::Transaction* transaction, TableReadState& readState,
         common::ValueVector* nodeIDVector,
         const std::vector<common::ValueVector*>& outputVectors) override;
+    // Returns true if, according to the zone maps, no node in the nodeIDVector can satisfy all
+    // predicates, so the vector doesn't need to be scanned.
+    bool canSkipScan(transaction::Transaction* transaction, common::ValueVector* nodeIDVector,
+        const std::vector<ColumnPredicate>& predicates);
 
     // Return the max node offset during insertions.
     common::offset_t validateUniquenessConstraint(
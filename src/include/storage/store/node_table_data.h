@@ -27,6 +27,11 @@ public:
         common::ValueVector* nodeIDVector,
         const std::vector<common::ValueVector*>& outputVectors) override;
 
+    // Returns true if the zone maps of the node group prove that no node in it can satisfy all
+    // predicates.
+    bool canSkipNodeGroup(transaction::Transaction* transaction,
+        common::node_group_idx_t nodeGroupIdx, const std::vector<ColumnPredicate>& predicates);
+
     // These two interfaces are node table specific, as rel table requires also relIDVector.
     void insert(transaction::Transaction* transaction, common::ValueVector* nodeIDVector,
         const std::vector<common::ValueVector*>& propertyVectors);
@@ -43,6 +48,11 @@ public:
         transaction::Transaction* transaction) const override {
         return columns[0]->getNumNodeGroups(transaction);
     }
+
+private:
+    // Returns true if columns of the type can be read with Column::lookup for a whole vector.
+    static bool canLookup(const common::LogicalType& dataType);
+    static bool hasPropertyStatistics(const Column& column);
 };
 
 } // namespace storage
@@ -101,6 +101,8 @@ private:
         RelDetachDeleteState* deleteState);
 
 private:
+    common::table_id_t srcTableID;
+    common::table_id_t dstTableID;
     std::unique_ptr<RelTableData> fwdRelTableData;
     std::unique_ptr<RelTableData> bwdRelTableData;
 };
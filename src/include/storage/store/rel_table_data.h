@@ -17,6 +17,9 @@ struct RelDataReadState : public TableReadState {
     common::offset_t currentNodeOffset;
     common::offset_t posInCurrentCSR;
     std::vector<common::list_entry_t> csrListEntries;
+    // End of the CSR offsets prefetched in the current node group, see
+    // `RelTableData::prefetchCSRList`.
+    common::offset_t prefetchedCSROffset;
     // Temp auxiliary data structure to scan the offset of each CSR node in the offset column chunk.
     CSRHeaderChunks csrHeaderChunks = CSRHeaderChunks(false /*enableCompression*/);
 
@@ -177,6 +180,11 @@ public:
     }
 
 private:
+    // Prefetches the CSR list of the current node of the read state from the scanned columns.
+    // Lists spanning several vectors are read with as few reads as possible, and if the lists are
+    // scanned in order, the next window of CSR offsets is read ahead asynchronously.
+    void prefetchCSRList(transaction::Transaction* transaction, RelDataReadState& readState);
+
     std::vector<PackedCSRRegion> findRegions(
         const CSRHeaderChunks& headerChunks, LocalState& localState);
     common::length_t getNewRegionSize(const CSRHeaderChunks& header,
@@ -187,6 +195,8 @@ private:
 
     void prepareCommitNodeGroup(transaction::Transaction* transaction,
         common::node_group_idx_t nodeGroupIdx, LocalRelNG* localRelNG);
+    static void updatePropertyStatistics(
+        Column& column, const ColumnChunk& columnChunk, const CSRHeaderChunks& header);
 
     void updateCSRHeader(transaction::Transaction* transaction,
         common::node_group_idx_t nodeGroupIdx, PersistentState& persistentState,
@@ -12,6 +12,12 @@ public:
         BufferManager* bufferManager, WAL* wal, transaction::Transaction* transaction,
         RWPropertyStats propertyStatistics, bool enableCompression);
 
+    // Scans a sequential vector of nodes and removes the positions whose value is null or doesn't
+    // satisfy the filter from the selection vector of the nodeIDVector. For node groups with a
+    // small dictionary, the filter is evaluated on the dictionary indices, so strings are only
+    // read for the nodes which satisfy it.
+    void scan(transaction::Transaction* transaction, common::ValueVector* nodeIDVector,
+        common::ValueVector* resultVector, DictionaryFilter& filter);
     void scan(transaction::Transaction* transaction, common::node_group_idx_t nodeGroupIdx,
         common::offset_t startOffsetInGroup, common::offset_t endOffsetInGroup,
         common::ValueVector* resultVector, uint64_t offsetInVector = 0) override;
@@ -43,6 +49,10 @@ protected:
     void scanFiltered(transaction::Transaction* transaction, common::node_group_idx_t nodeGroupIdx,
         common::offset_t startOffsetInGroup, common::ValueVector* nodeIDVector,
         common::ValueVector* resultVector);
+    void scanMatchingIndices(transaction::Transaction* transaction,
+        common::node_group_idx_t nodeGroupIdx, common::offset_t startOffsetInGroup,
+        common::ValueVector* nodeIDVector, common::ValueVector* resultVector,
+        const std::vector<bool>& matchingIndices);
 
     void lookupInternal(transaction::Transaction* transaction, common::ValueVector* nodeIDVector,
         common::ValueVector* resultVector) override;
@@ -41,6 +41,11 @@ public:
     virtual void checkpointInMemory() = 0;
     virtual void rollbackInMemory() = 0;
 
+protected:
+    // Statistics of a new property whose value is defaultValueVector for every existing tuple.
+    PropertyStatistics getDefaultValueStatistics(
+        const catalog::Property& property, common::ValueVector* defaultValueVector);
+
 protected:
     common::TableType tableType;
     common::table_id_t tableID;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storage/store/column.h"
+#include "storage/store/dictionary_column.h"
 #include "storage/store/node_group.h"
 
 namespace kuzu {
@@ -10,6 +11,15 @@ struct TableReadState {
     virtual ~TableReadState() = default;
 
     std::vector<common::column_id_t> columnIDs;
+    // Filters on scanned STRING columns. Nodes which don't satisfy them are removed from the
+    // selection vector of the node ID vector before the other columns are scanned.
+    std::vector<DictionaryFilter> dictionaryFilters;
+    // Comparisons with a constant on scanned numeric columns, applied in the same way. They are
+    // evaluated on the compressed values where possible.
+    std::vector<ColumnPredicate> columnPredicates;
+    // Set if the planner expects the input selection to be sparse. Values of the selected nodes
+    // are then looked up one at a time instead of decompressing every page containing one.
+    bool lateMaterialization = false;
 };
 
 class LocalTableData;
@@ -18,6 +18,8 @@ constexpr uint64_t WAL_HEADER_PAGE_NUM_RECORDS_FIELD_SIZE = sizeof(uint64_t);
 constexpr uint64_t WAL_HEADER_PAGE_NEXT_HEADER_PAGE_IDX_FIELD_SIZE = sizeof(common::page_idx_t);
 constexpr uint64_t WAL_HEADER_PAGE_PREFIX_FIELD_SIZES =
     WAL_HEADER_PAGE_NUM_RECORDS_FIELD_SIZE + WAL_HEADER_PAGE_NEXT_HEADER_PAGE_IDX_FIELD_SIZE;
+// Page deltas are written to the WAL file in chunks of up to this size.
+constexpr uint64_t WAL_PAGE_DELTA_BUFFER_SIZE = 64 * common::BufferPoolConstants::PAGE_4KB_SIZE;
 
 class WALIterator;
 
@@ -90,12 +92,16 @@ public:
         return make_unique<WALIterator>(fileHandle, mtx);
     }
 
-    common::page_idx_t logPageUpdateRecord(
-        DBFileID dbFileID, common::page_idx_t pageIdxInOriginalFile);
+    // `isNewPage` is true if the original page was added to the file by the write transaction,
+    // in which case its original version is not read when logging the page delta of the update.
+    common::page_idx_t logPageUpdateRecord(BMFileHandle& originalFileHandle, DBFileID dbFileID,
+        common::page_idx_t pageIdxInOriginalFile, bool isNewPage);
 
-    common::page_idx_t logPageInsertRecord(
-        DBFileID dbFileID, common::page_idx_t pageIdxInOriginalFile);
+    common::page_idx_t logPageInsertRecord(BMFileHandle& originalFileHandle, DBFileID dbFileID,
+        common::page_idx_t pageIdxInOriginalFile);
 
+    // Logs a page delta record for each page updated by the write transaction, followed by the
+    // commit record. The WAL versions of the pages are not written to the WAL file.
     void logCommit(uint64_t transactionID);
 
     void logTableStatisticsRecord(bool isNodeTable);
@@ -128,8 +134,20 @@ public:
         return isLastLoggedRecordCommit_;
     }
 
+    // Writes the header pages to the WAL file. The WAL versions of pages are only written to the
+    // WAL file when they are evicted from the buffer pool, since recovery replays the page delta
+    // records logged at commit instead of them.
     void flushAllPages();
 
+    // Returns false if the WAL has records, e.g. of DDL statements or COPY, whose changes are only
+    // applied to the in-memory structures of the database by checkpointing. Otherwise, read-only
+    // transactions can read the changes of the committed write transaction before it is
+    // checkpointed.
+    inline bool canDeferCheckpoint() {
+        lock_t lck{mtx};
+        return !hasRecordAppliedByCheckpoint;
+    }
+
     inline bool isEmptyWAL() {
         return currentHeaderPageIdx == 0 && (getNumRecordsInCurrentHeaderPage() == 0);
     }
@@ -149,6 +167,25 @@ private:
         }
     }
 
+    // A page with a WAL version that was created by the write transaction.
+    struct WALPageVersion {
+        BMFileHandle* originalFileHandle;
+        DBFileID dbFileID;
+        common::page_idx_t pageIdxInOriginalFile;
+        common::page_idx_t pageIdxInWAL;
+        bool isNewPage;
+    };
+    // The bytes of a page delta at offsetInBuffer of the buffer of pending page deltas.
+    struct PendingPageDelta {
+        const WALPageVersion* pageVersion;
+        uint64_t offsetInBuffer;
+        uint16_t offsetInPage;
+        uint16_t numBytes;
+    };
+
+    void logPageDeltasNoLock();
+    void writePageDeltasNoLock(
+        std::vector<uint8_t>& buffer, std::vector<PendingPageDelta>& pendingDeltas);
     void initCurrentPage();
     void addNewWALRecordNoLock(WALRecord& walRecord);
     void setIsLastRecordCommit();
@@ -157,11 +194,13 @@ private:
     // Node/Rel tables that might have changes to their in-memory data structures that need to be
     // committed/rolled back accordingly during the wal replaying.
     std::unordered_set<common::table_id_t> updatedTables;
+    std::vector<WALPageVersion> pageVersions;
     std::shared_ptr<spdlog::logger> logger;
     std::string directory;
     std::mutex mtx;
     BufferManager& bufferManager;
     bool isLastLoggedRecordCommit_;
+    bool hasRecordAppliedByCheckpoint;
 };
 
 class WALIterator : public BaseWALAndWALIterator {
@@ -51,6 +51,7 @@ enum class WALRecordType : uint8_t {
     CREATE_TABLE_RECORD = 6,
     CREATE_REL_TABLE_GROUP_RECORD = 7,
     CREATE_RDF_GRAPH_RECORD = 8,
+    PAGE_DELTA_RECORD = 9,
     COPY_TABLE_RECORD = 19,
     DROP_TABLE_RECORD = 20,
     DROP_PROPERTY_RECORD = 21,
@@ -79,6 +80,31 @@ struct PageUpdateOrInsertRecord {
     }
 };
 
+// The bytes of a page in [offsetInPage, offsetInPage + numBytes) that differ between its original
+// and WAL versions when the write transaction commits. The bytes are written to the WAL file at
+// offsetInWAL. Page delta records are only replayed when recovering, since the WAL version of a
+// page is only written to the WAL file when it is evicted from the buffer pool.
+struct PageDeltaRecord {
+    DBFileID dbFileID;
+    uint64_t pageIdxInOriginalFile;
+    uint64_t offsetInWAL;
+    uint16_t offsetInPage;
+    uint16_t numBytes;
+
+    PageDeltaRecord() = default;
+
+    PageDeltaRecord(DBFileID dbFileID, uint64_t pageIdxInOriginalFile, uint64_t offsetInWAL,
+        uint16_t offsetInPage, uint16_t numBytes)
+        : dbFileID{dbFileID}, pageIdxInOriginalFile{pageIdxInOriginalFile},
+          offsetInWAL{offsetInWAL}, offsetInPage{offsetInPage}, numBytes{numBytes} {}
+
+    inline bool operator==(const PageDeltaRecord& rhs) const {
+        return dbFileID == rhs.dbFileID && pageIdxInOriginalFile == rhs.pageIdxInOriginalFile &&
+               offsetInWAL == rhs.offsetInWAL && offsetInPage == rhs.offsetInPage &&
+               numBytes == rhs.numBytes;
+    }
+};
+
 struct CommitRecord {
     uint64_t transactionID;
 
@@ -193,6 +219,7 @@ struct WALRecord {
     WALRecordType recordType;
     union {
         PageUpdateOrInsertRecord pageInsertOrUpdateRecord;
+        PageDeltaRecord pageDeltaRecord;
         CommitRecord commitRecord;
         CreateTableRecord createTableRecord;
         RdfGraphRecord rdfGraphRecord;
@@ -209,6 +236,8 @@ struct WALRecord {
         DBFileID dbFileID, uint64_t pageIdxInOriginalFile, uint64_t pageIdxInWAL);
     static WALRecord newPageInsertRecord(
         DBFileID dbFileID, uint64_t pageIdxInOriginalFile, uint64_t pageIdxInWAL);
+    static WALRecord newPageDeltaRecord(DBFileID dbFileID, uint64_t pageIdxInOriginalFile,
+        uint64_t offsetInWAL, uint16_t offsetInPage, uint16_t numBytes);
     static WALRecord newCommitRecord(uint64_t transactionID);
     static WALRecord newTableStatisticsRecord(bool isNodeTable);
     static WALRecord newCatalogRecord();
@@ -11,6 +11,10 @@ class logger;
 }
 
 namespace kuzu {
+namespace common {
+class TaskScheduler;
+} // namespace common
+
 namespace storage {
 
 class StorageManager;
@@ -18,10 +22,42 @@ class StorageManager;
 enum class WALReplayMode : uint8_t { COMMIT_CHECKPOINT, ROLLBACK, RECOVERY_CHECKPOINT };
 
 // Note: This class is not thread-safe.
+// When recovering, the page delta records between two records of other types are replayed in
+// parallel by the task scheduler, if there is one. The deltas are partitioned by database file and
+// by ranges of 2^PAGE_DELTA_PARTITION_NUM_PAGES_LOG2 pages, and the deltas of a partition are
+// replayed in page order by a single thread. Records of other types are replayed one at a time,
+// after all page deltas before them.
 class WALReplayer {
+    // Pages copied from the WAL to the database files are written in batches of up to
+    // MAX_NUM_PENDING_PAGE_WRITES pages.
+    static constexpr uint64_t MAX_NUM_PENDING_PAGE_WRITES = 64;
+    static constexpr uint64_t PAGE_DELTA_PARTITION_NUM_PAGES_LOG2 =
+        common::StorageConstants::PAGE_GROUP_SIZE_LOG2;
+
+    struct PendingPageWrite {
+        std::unique_ptr<common::FileInfo> fileInfo;
+        uint64_t offset;
+    };
+
+    // The pending page deltas of a database file, sorted by page.
+    struct FilePageDeltas {
+        DBFileID dbFileID;
+        std::unique_ptr<common::FileInfo> fileInfo;
+        std::vector<PageDeltaRecord> pageDeltas;
+    };
+
+    // The page deltas in [startIdx, endIdx) of the pending page deltas of a database file.
+    struct PageDeltaPartition {
+        const FilePageDeltas* filePageDeltas;
+        uint64_t startIdx;
+        uint64_t endIdx;
+    };
+
 public:
+    // If `taskScheduler` is null, the page deltas are replayed on the calling thread.
     WALReplayer(WAL* wal, StorageManager* storageManager, BufferManager* bufferManager,
-        catalog::Catalog* catalog, WALReplayMode replayMode, common::VirtualFileSystem* vfs);
+        catalog::Catalog* catalog, WALReplayMode replayMode, common::VirtualFileSystem* vfs,
+        common::TaskScheduler* taskScheduler);
 
     void replay();
 
@@ -29,6 +65,7 @@ private:
     void init();
     void replayWALRecord(WALRecord& walRecord);
     void replayPageUpdateOrInsertRecord(const WALRecord& walRecord);
+    void replayPageDeltaRecord(const WALRecord& walRecord);
     void replayTableStatisticsRecord(const WALRecord& walRecord);
     void replayCatalogRecord();
     void replayCreateTableRecord(const WALRecord& walRecord);
@@ -38,8 +75,15 @@ private:
     void replayDropPropertyRecord(const WALRecord& walRecord);
     void replayAddPropertyRecord(const WALRecord& walRecord);
 
+    // Returns the buffer of a pending write of the page at `offset` of the database file.
+    uint8_t* addPendingPageWrite(const DBFileID& dbFileID, uint64_t offset);
+    void flushPendingPageWrites();
+    void replayPendingPageDeltas();
+    // Can be called concurrently for different partitions.
+    void replayPageDeltaPartition(const PageDeltaPartition& partition) const;
+
     void checkpointOrRollbackVersionedFileHandleAndBufferManager(
-        const WALRecord& walRecord, const DBFileID& dbFileID);
+        const WALRecord& walRecord, const DBFileID& dbFileID, uint8_t* walPage);
     void truncateFileIfInsertion(
         BMFileHandle* fileHandle, const PageUpdateOrInsertRecord& pageInsertOrUpdateRecord);
     BMFileHandle* getVersionedFileHandleIfWALVersionAndBMShouldBeCleared(const DBFileID& dbFileID);
@@ -54,7 +98,11 @@ private:
     BufferManager* bufferManager;
     common::VirtualFileSystem* vfs;
     std::shared_ptr<BMFileHandle> walFileHandle;
+    // Holds the WAL pages of the pending page writes.
     std::unique_ptr<uint8_t[]> pageBuffer;
+    std::vector<PendingPageWrite> pendingPageWrites;
+    std::vector<PageDeltaRecord> pendingPageDeltas;
+    common::TaskScheduler* taskScheduler;
     WAL* wal;
     catalog::Catalog* catalog;
 };
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <unordered_set>
 
 #include "storage/local_storage/local_storage.h"
 
@@ -19,21 +21,46 @@ class Transaction {
     friend class TransactionManager;
 
 public:
-    Transaction(TransactionType transactionType, uint64_t transactionID, storage::MemoryManager* mm)
-        : type{transactionType}, ID{transactionID} {
+    Transaction(TransactionType transactionType, uint64_t transactionID, storage::MemoryManager* mm,
+        bool readsWriteVersion = false)
+        : type{transactionType}, ID{transactionID}, readsWriteVersion{readsWriteVersion},
+          transactionManager{nullptr}, startCommitID{0} {
         localStorage = std::make_unique<storage::LocalStorage>(mm);
     }
 
-    constexpr explicit Transaction(TransactionType transactionType) noexcept
-        : type{transactionType}, ID{INVALID_TRANSACTION_ID} {}
+    explicit Transaction(TransactionType transactionType) noexcept
+        : type{transactionType}, ID{INVALID_TRANSACTION_ID}, readsWriteVersion{false},
+          transactionManager{nullptr}, startCommitID{0} {}
 
 public:
-    inline TransactionType getType() const { return type; }
+    // Returns the version of the storage structures read by the transaction. A read-only
+    // transaction which starts after a write transaction is committed, but before the write
+    // transaction is checkpointed, reads the version of the write transaction. Use isReadOnly()
+    // and isWriteTransaction() to check whether the transaction may write.
+    inline TransactionType getType() const {
+        return readsWriteVersion ? TransactionType::WRITE : type;
+    }
     inline bool isReadOnly() const { return TransactionType::READ_ONLY == type; }
     inline bool isWriteTransaction() const { return TransactionType::WRITE == type; }
     inline uint64_t getID() const { return ID; }
     inline storage::LocalStorage* getLocalStorage() { return localStorage.get(); }
 
+    // Returns whether the transaction is a write transaction which runs concurrently with other
+    // write transactions, see TransactionManager::beginWriteTransaction().
+    inline bool isConcurrentWriteTransaction() const { return transactionManager != nullptr; }
+    // Must be called before the transaction writes to the table. Does nothing unless the
+    // transaction is a concurrent write transaction, which takes the write lock of the table, and
+    // throws if another concurrent write transaction wrote to the table first.
+    void lockTableForWrite(common::table_id_t tableID);
+    // Must be called before the transaction reads the table to check one of its writes, e.g.,
+    // whether a deleted node has rels. Does nothing unless the transaction is a concurrent write
+    // transaction, which takes a shared lock of the table so that no other concurrent write
+    // transaction can write to it until the transaction ends.
+    void lockTableForRead(common::table_id_t tableID);
+    // Returns whether the uncommitted changes to the table, if any, are made by the transaction.
+    // This holds for all tables if the transaction is not a concurrent write transaction.
+    bool ownsTable(common::table_id_t tableID);
+
     static inline std::unique_ptr<Transaction> getDummyWriteTrx() {
         return std::make_unique<Transaction>(TransactionType::WRITE);
     }
@@ -45,7 +72,17 @@ private:
     TransactionType type;
     // TODO(Guodong): add type transaction_id_t.
     uint64_t ID;
+    bool readsWriteVersion;
     std::unique_ptr<storage::LocalStorage> localStorage;
+    // Only set for concurrent write transactions.
+    TransactionManager* transactionManager;
+    // ID of the last write transaction committed before the transaction started.
+    uint64_t startCommitID;
+    // Protects lockedTableIDs and readLockedTableIDs, which are written by the threads executing
+    // the statements.
+    std::mutex mtx;
+    std::unordered_set<common::table_id_t> lockedTableIDs;
+    std::unordered_set<common::table_id_t> readLockedTableIDs;
 };
 
 static Transaction DUMMY_READ_TRANSACTION = Transaction(TransactionType::READ_ONLY);
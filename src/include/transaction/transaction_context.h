@@ -1,5 +1,7 @@
 #pragma once
 
+#include <shared_mutex>
+
 #include "transaction.h"
 
 namespace kuzu {
@@ -36,8 +38,16 @@ public:
 
     void beginReadTransaction();
     void beginWriteTransaction();
-    void beginAutoTransaction(bool readOnlyStatement);
-    void validateManualTransaction(bool allowActiveTransaction, bool readOnlyStatement);
+    // A statement that can run in a concurrent write transaction, i.e., a query, starts a
+    // non-exclusive write transaction, see TransactionManager::beginWriteTransaction().
+    void beginAutoTransaction(bool readOnlyStatement, bool allowConcurrentWriteTransaction);
+    void validateManualTransaction(bool allowActiveTransaction, bool readOnlyStatement,
+        bool allowConcurrentWriteTransaction);
+    // Must be called before compiling or executing a statement in the active transaction, and
+    // unlockStatement() after. Only locks if the active transaction is a concurrent write
+    // transaction, see TransactionManager::lockStatement(). Committing or rolling back unlocks.
+    void lockStatement();
+    void unlockStatement();
 
     void commit();
     void rollback();
@@ -53,13 +63,14 @@ private:
     void rollbackInternal(bool skipCheckPointing);
 
 private:
-    void beginTransactionInternal(TransactionType transactionType);
+    void beginTransactionInternal(TransactionType transactionType, bool exclusive);
 
 private:
     std::mutex mtx;
     main::Database* database;
     TransactionMode mode;
     std::unique_ptr<Transaction> activeTransaction;
+    std::shared_lock<std::shared_mutex> statementLck;
 };
 
 } // namespace transaction
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "storage/wal/wal.h"
@@ -16,10 +22,38 @@ class TransactionManager {
 
 public:
     explicit TransactionManager(storage::WAL& wal, storage::MemoryManager* mm)
-        : wal{wal}, mm{mm}, activeWriteTransactionID{INT64_MAX}, lastTransactionID{0}, lastCommitID{
-                                                                                           0} {};
-    std::unique_ptr<Transaction> beginWriteTransaction();
+        : wal{wal}, mm{mm}, activeWriteTransactionID{INT64_MAX}, lastTransactionID{0},
+          lastCommitID{0}, hasDeferredCheckpoint_{false}, numDeferredCheckpoints{0},
+          stopCheckpointThread_{false} {};
+    ~TransactionManager();
+
+    // An exclusive write transaction is the only active write transaction until it ends. If
+    // concurrent write transactions are enabled, other write transactions run concurrently with
+    // each other, which is only possible because their changes are kept in their local storage
+    // until they commit. Each table is written by at most one of them at a time, see
+    // lockTableForWrite(). They commit or roll back one at a time, like exclusive ones, after
+    // calling startCommitOrRollback(). Concurrent write transactions have read committed
+    // semantics, not snapshots: besides their own changes, they read the latest committed version
+    // of the tables, including changes committed by other transactions after they started.
+    std::unique_ptr<Transaction> beginWriteTransaction(bool exclusive = true);
     std::unique_ptr<Transaction> beginReadOnlyTransaction();
+    // Waits until the concurrent write transaction can become the active write transaction, which
+    // is needed to commit or roll it back, and until no statement of any other concurrent write
+    // transaction runs. Throws if the deferred checkpoint, if any, cannot be run.
+    void startCommitOrRollback(Transaction* transaction);
+    // Locks the table for writing by the concurrent write transaction. The first concurrent write
+    // transaction to write to a table wins: a transaction fails to lock a table that is locked by
+    // another one, or that was written by a transaction committed after it started.
+    void lockTableForWrite(Transaction* transaction, common::table_id_t tableID);
+    // Locks the table for reading by the concurrent write transaction, which depends on the table
+    // not being changed by others until it ends. Several transactions can lock a table for reading,
+    // but a transaction fails to lock a table that is locked for writing by another one, or that
+    // was written by a transaction committed after it started.
+    void lockTableForRead(Transaction* transaction, common::table_id_t tableID);
+    // Returns a lock which concurrent write transactions hold while compiling or executing a
+    // statement, since the storage structures they read change while another write transaction
+    // commits or is checkpointed.
+    std::shared_lock<std::shared_mutex> lockStatement();
     void commit(Transaction* transaction);
     void commitButKeepActiveWriteTransaction(Transaction* transaction);
     void manuallyClearActiveWriteTransaction(Transaction* transaction);
@@ -30,6 +64,27 @@ public:
     void stopNewTransactionsAndWaitUntilAllReadTransactionsLeave();
     void allowReceivingNewTransactions();
 
+    // A committed write transaction can be checkpointed later, instead of as part of its commit,
+    // so that committing does not wait for read-only transactions to leave. Until it is
+    // checkpointed, new read-only transactions read the WAL version of the database, i.e., the
+    // version of the committed write transaction, and new write transactions first checkpoint
+    // it. The checkpoint is run by a background thread as soon as no transaction is active. A
+    // write transaction running it waits for read-only transactions to leave and stops new ones
+    // until it is done, so readers are still stalled when write transactions follow each other.
+    // `checkpointFunc` checkpoints and clears the WAL.
+    void startCheckpointThread(std::function<void()> checkpointFunc);
+    void stopCheckpointThread();
+    // Ends the committed write transaction, whose commit record has been logged, and defers its
+    // checkpoint.
+    void deferCheckpoint(Transaction* transaction);
+    // Checkpoints the deferred write transaction, if any. Throws if read-only transactions do not
+    // leave within the checkpoint wait timeout.
+    void checkpointDeferredTransaction();
+    inline bool hasDeferredCheckpoint() {
+        lock_t lck{mtxForSerializingPublicFunctionCalls};
+        return hasDeferredCheckpoint_;
+    }
+
     // Warning: Below public functions are for tests only
     inline std::unordered_set<uint64_t>& getActiveReadOnlyTransactionIDs() {
         lock_t lck{mtxForSerializingPublicFunctionCalls};
@@ -46,18 +101,52 @@ public:
     inline void setCheckPointWaitTimeoutForTransactionsToLeaveInMicros(uint64_t waitTimeInMicros) {
         checkPointWaitTimeoutForTransactionsToLeaveInMicros = waitTimeInMicros;
     }
+    // Sets how long beginWriteTransaction() waits for the active write transaction to end before
+    // throwing. Write transactions waiting at the same time are started in the order in which
+    // they called beginWriteTransaction().
+    inline void setWriteTransactionWaitTimeoutInMicros(uint64_t waitTimeInMicros) {
+        lock_t lck{mtxForSerializingPublicFunctionCalls};
+        writeTransactionWaitTimeoutInMicros = waitTimeInMicros;
+    }
+    inline uint64_t getNumWaitingWriteTransactions() {
+        lock_t lck{mtxForSerializingPublicFunctionCalls};
+        return waitingWriteTransactions.size();
+    }
+    inline void setEnableConcurrentWriteTransactions(bool enable) {
+        lock_t lck{mtxForSerializingPublicFunctionCalls};
+        enableConcurrentWriteTransactions = enable;
+    }
+    inline uint64_t getNumActiveConcurrentWriteTransactions() {
+        lock_t lck{mtxForSerializingPublicFunctionCalls};
+        return activeConcurrentWriteTransactionIDs.size();
+    }
 
 private:
     inline bool hasActiveWriteTransactionNoLock() const {
         return activeWriteTransactionID != INT64_MAX;
     }
+    inline bool hasActiveExclusiveWriteTransactionNoLock() const {
+        return hasActiveWriteTransactionNoLock() &&
+               !activeConcurrentWriteTransactionIDs.contains(activeWriteTransactionID);
+    }
     inline void clearActiveWriteTransactionIfWriteTransactionNoLock(Transaction* transaction) {
         if (transaction->isWriteTransaction()) {
             activeWriteTransactionID = INT64_MAX;
+            if (transaction->isConcurrentWriteTransaction()) {
+                endConcurrentWriteTransactionNoLock(transaction);
+                mtxForStatements.unlock();
+            }
+            transactionsChanged.notify_all();
         }
     }
+    std::unique_ptr<Transaction> beginConcurrentWriteTransaction();
+    void endConcurrentWriteTransactionNoLock(Transaction* transaction);
     void commitOrRollbackNoLock(Transaction* transaction, bool isCommit);
     void assertActiveWriteTransactionIsCorrectNoLock(Transaction* transaction) const;
+    // Returns false if the checkpoint was not run because there are active read-only transactions.
+    bool tryCheckpointDeferredTransaction(bool waitForReadTransactions);
+    void runCheckpointThread();
+    void leaveWriteTransactionQueueNoLock(uint64_t ticket);
 
 private:
     storage::WAL& wal;
@@ -74,7 +163,8 @@ private:
     // In particular, transactions do not use this to perform reads. Our current transaction design
     // supports a concurrency model that requires on 2 versions, one for the read-only transactions
     // and the for the writer transaction, so we can read correct version by looking at the type of
-    // the transaction.
+    // the transaction. It is also used to detect write-write conflicts between concurrent write
+    // transactions.
     uint64_t lastCommitID;
     // This mutex is used to ensure thread safety and letting only one public function to be called
     // at any time except the stopNewTransactionsAndWaitUntilAllReadTransactionsLeave
@@ -83,6 +173,35 @@ private:
     std::mutex mtxForStartingNewTransactions;
     uint64_t checkPointWaitTimeoutForTransactionsToLeaveInMicros =
         common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_FOR_TRANSACTIONS_TO_LEAVE_IN_MICROS;
+    // Notified when a transaction leaves the system or a checkpoint is deferred.
+    std::condition_variable transactionsChanged;
+    uint64_t writeTransactionWaitTimeoutInMicros = 0;
+    // Tickets of the calls to beginWriteTransaction() waiting for their turn, in arrival order.
+    std::deque<uint64_t> waitingWriteTransactions;
+    uint64_t nextWriteTransactionTicket = 0;
+
+    bool enableConcurrentWriteTransactions = false;
+    std::unordered_set<uint64_t> activeConcurrentWriteTransactionIDs;
+    // ID of the concurrent write transaction holding the write lock of each locked table.
+    std::unordered_map<common::table_id_t, uint64_t> tableWriteLocks;
+    // IDs of the concurrent write transactions holding the read lock of each locked table.
+    std::unordered_map<common::table_id_t, std::unordered_set<uint64_t>> tableReadLocks;
+    // ID of the last commit of a concurrent write transaction which wrote to each table.
+    std::unordered_map<common::table_id_t, uint64_t> lastCommitIDPerTable;
+    // Held in shared mode by the statements of concurrent write transactions, and in exclusive
+    // mode by a committing or rolling back concurrent write transaction and by the checkpoint of
+    // a deferred transaction.
+    std::shared_mutex mtxForStatements;
+
+    bool hasDeferredCheckpoint_;
+    // Tells apart the deferred checkpoints, so that the checkpoint thread only skips the one which
+    // failed.
+    uint64_t numDeferredCheckpoints;
+    std::function<void()> checkpointFunc;
+    // Serializes the checkpoints of the checkpoint thread and of new write transactions.
+    std::mutex mtxForCheckpointing;
+    bool stopCheckpointThread_;
+    std::thread checkpointThread;
 };
 } // namespace transaction
 } // namespace kuzu
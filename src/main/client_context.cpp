@@ -55,6 +55,7 @@ ClientContext::ClientContext(Database* database) : database{database} {
     config.numThreads = database->systemConfig.maxNumThreads;
     config.timeoutInMS = ClientConfigDefault::TIMEOUT_IN_MS;
     config.varLengthMaxDepth = ClientConfigDefault::VAR_LENGTH_MAX_DEPTH;
+    config.queryMemoryLimit = ClientConfigDefault::QUERY_MEMORY_LIMIT;
 }
 
 uint64_t ClientContext::getTimeoutRemainingInMS() const {
@@ -78,6 +79,15 @@ uint64_t ClientContext::getQueryTimeOut() const {
     return config.timeoutInMS;
 }
 
+void ClientContext::setQueryMemoryLimit(uint64_t numBytes) {
+    lock_t lck{mtx};
+    config.queryMemoryLimit = numBytes;
+}
+
+uint64_t ClientContext::getQueryMemoryLimit() const {
+    return config.queryMemoryLimit;
+}
+
 void ClientContext::setMaxNumThreadForExec(uint64_t numThreads) {
     lock_t lck{mtx};
     config.numThreads = numThreads;
@@ -136,6 +146,10 @@ storage::MemoryManager* ClientContext::getMemoryManager() {
     return database->memoryManager.get();
 }
 
+storage::BufferPoolWarmUp* ClientContext::getBufferPoolWarmUp() {
+    return database->bufferPoolWarmUp.get();
+}
+
 catalog::Catalog* ClientContext::getCatalog() {
     return database->catalog.get();
 }
@@ -255,16 +269,19 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
     try {
         // parsing
         if (parsedStatement->getStatementType() != StatementType::TRANSACTION) {
+            auto allowConcurrentWriteTransaction =
+                StatementTypeUtils::allowConcurrentWriteTransaction(
+                    preparedStatement->preparedSummary.statementType);
             if (transactionContext->isAutoTransaction()) {
-                transactionContext->beginAutoTransaction(preparedStatement->readOnly);
+                transactionContext->beginAutoTransaction(
+                    preparedStatement->readOnly, allowConcurrentWriteTransaction);
             } else {
                 transactionContext->validateManualTransaction(
-                    preparedStatement->allowActiveTransaction(), preparedStatement->readOnly);
-            }
-            if (!this->getTx()->isReadOnly()) {
-                database->catalog->initCatalogContentForWriteTrxIfNecessary();
-                database->storageManager->initStatistics();
+                    preparedStatement->allowActiveTransaction(), preparedStatement->readOnly,
+                    allowConcurrentWriteTransaction);
             }
+            transactionContext->lockStatement();
+            initWriteTransactionIfNecessaryNoLock();
         }
         // binding
         auto binder = Binder(this);
@@ -304,11 +321,22 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
         preparedStatement->errMsg = exception.what();
         this->transactionContext->rollback();
     }
+    transactionContext->unlockStatement();
     compilingTimer.stop();
     preparedStatement->preparedSummary.compilingTime = compilingTimer.getElapsedTimeMS();
     return preparedStatement;
 }
 
+void ClientContext::initWriteTransactionIfNecessaryNoLock() {
+    auto transaction = getTx();
+    // Concurrent write transactions do not write the catalog, and keep the statistics they write
+    // in their local storage.
+    if (!transaction->isReadOnly() && !transaction->isConcurrentWriteTransaction()) {
+        database->catalog->initCatalogContentForWriteTrxIfNecessary();
+        database->storageManager->initStatistics();
+    }
+}
+
 std::vector<std::unique_ptr<Statement>> ClientContext::parseQuery(std::string_view query) {
     std::vector<std::unique_ptr<Statement>> statements;
     if (query.empty()) {
@@ -362,11 +390,13 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     }
     if (preparedStatement->preparedSummary.statementType != common::StatementType::TRANSACTION &&
         this->getTx() == nullptr) {
-        this->transactionContext->beginAutoTransaction(preparedStatement->isReadOnly());
-        if (!preparedStatement->readOnly) {
-            database->catalog->initCatalogContentForWriteTrxIfNecessary();
-            database->storageManager->initStatistics();
-        }
+        this->transactionContext->beginAutoTransaction(preparedStatement->isReadOnly(),
+            StatementTypeUtils::allowConcurrentWriteTransaction(
+                preparedStatement->preparedSummary.statementType));
+        initWriteTransactionIfNecessaryNoLock();
+    }
+    if (!preparedStatement->isTransactionStatement()) {
+        this->transactionContext->lockStatement();
     }
     this->resetActiveQuery();
     this->startTimer();
@@ -385,7 +415,11 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     }
     auto queryResult = std::make_unique<QueryResult>(preparedStatement->preparedSummary);
     auto profiler = std::make_unique<Profiler>();
-    auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this);
+    auto memoryLimit =
+        config.queryMemoryLimit == 0 ? storage::MemoryTracker::UNLIMITED : config.queryMemoryLimit;
+    auto memoryTracker = std::make_shared<storage::MemoryTracker>(memoryLimit);
+    auto executionContext =
+        std::make_unique<ExecutionContext>(profiler.get(), this, memoryTracker);
     profiler->enabled = preparedStatement->isProfile();
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
@@ -408,8 +442,10 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
         this->transactionContext->rollback();
         return queryResultWithError(std::string(exception.what()));
     }
+    this->transactionContext->unlockStatement();
     executingTimer.stop();
     queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
+    queryResult->querySummary->peakMemory = memoryTracker->getPeakMemory();
     queryResult->initResultTableAndIterator(
         std::move(resultFT), preparedStatement->statementResult->getColumns());
     return queryResult;
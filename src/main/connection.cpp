@@ -73,6 +73,14 @@ uint64_t Connection::getQueryTimeOut() {
     return clientContext->getQueryTimeOut();
 }
 
+void Connection::setQueryMemoryLimit(uint64_t numBytes) {
+    clientContext->setQueryMemoryLimit(numBytes);
+}
+
+uint64_t Connection::getQueryMemoryLimit() {
+    return clientContext->getQueryMemoryLimit();
+}
+
 std::unique_ptr<QueryResult> Connection::executeWithParams(PreparedStatement* preparedStatement,
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams) {
     return clientContext->executeWithParams(preparedStatement, std::move(inputParams));
@@ -15,6 +15,7 @@
 #include "main/db_config.h"
 #include "processor/processor.h"
 #include "spdlog/spdlog.h"
+#include "storage/buffer_manager/buffer_pool_warm_up.h"
 #include "storage/storage_manager.h"
 #include "storage/wal_replayer.h"
 #include "transaction/transaction_action.h"
@@ -73,9 +74,18 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     initLoggers();
     logger = LoggerUtils::getLogger(LoggerConstants::LoggerEnum::DATABASE);
     vfs = std::make_unique<VirtualFileSystem>();
-    bufferManager = std::make_unique<BufferManager>(
-        this->systemConfig.bufferPoolSize, this->systemConfig.maxDBSize);
-    memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get());
+    if (this->systemConfig.spillDirectory.empty()) {
+        this->systemConfig.maxSpillSize = 0;
+    } else if (this->systemConfig.maxSpillSize == -1u) {
+        this->systemConfig.maxSpillSize = BufferPoolConstants::DEFAULT_VM_REGION_MAX_SIZE;
+    }
+    bufferManager = std::make_unique<BufferManager>(this->systemConfig.bufferPoolSize,
+        this->systemConfig.maxDBSize, this->systemConfig.maxSpillSize,
+        EvictionPolicyTypeUtils::fromString(this->systemConfig.evictionPolicy),
+        VMRegionConfig{this->systemConfig.useHugePages,
+            NUMAPolicyUtils::fromString(this->systemConfig.numaPolicy)});
+    memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get(),
+        this->systemConfig.spillDirectory, this->systemConfig.maxSpillSize);
     queryProcessor = std::make_unique<processor::QueryProcessor>(this->systemConfig.maxNumThreads);
     initDBDirAndCoreFilesIfNecessary();
     wal =
@@ -86,10 +96,37 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
         *memoryManager, wal.get(), systemConfig.enableCompression, vfs.get());
     transactionManager =
         std::make_unique<transaction::TransactionManager>(*wal, memoryManager.get());
+    transactionManager->setWriteTransactionWaitTimeoutInMicros(
+        systemConfig.writeTransactionWaitTimeoutInMicros);
+    transactionManager->setEnableConcurrentWriteTransactions(
+        systemConfig.enableConcurrentWriteTransactions);
     extensionOptions = std::make_unique<extension::ExtensionOptions>();
+    bufferPoolWarmUp = std::make_unique<BufferPoolWarmUp>(
+        *bufferManager, vfs.get(), this->databasePath, systemConfig.readOnly);
+    if (systemConfig.warmUpBufferPool) {
+        bufferPoolWarmUp->start(transactionManager.get());
+    }
+    if (systemConfig.checkpointInBackground && !systemConfig.readOnly) {
+        transactionManager->startCheckpointThread(
+            [this]() { checkpointAndClearWAL(WALReplayMode::COMMIT_CHECKPOINT); });
+    }
 }
 
 Database::~Database() {
+    bufferPoolWarmUp->stop();
+    transactionManager->stopCheckpointThread();
+    try {
+        transactionManager->checkpointDeferredTransaction();
+    } catch (std::exception&) { // LCOV_EXCL_START
+        // The committed transaction is checkpointed when recovering from the WAL.
+    } // LCOV_EXCL_STOP
+    if (systemConfig.warmUpBufferPool && !systemConfig.readOnly) {
+        try {
+            bufferPoolWarmUp->dumpCachedPages();
+        } catch (std::exception&) { // LCOV_EXCL_START
+            // Failing to dump the cached pages only slows down the next start.
+        } // LCOV_EXCL_STOP
+    }
     dropLoggers();
     bufferManager->clearEvictionQueue();
 }
@@ -184,8 +221,20 @@ void Database::commit(Transaction* transaction, bool skipCheckpointForTestingRec
         return;
     }
     KU_ASSERT(transaction->isWriteTransaction());
+    if (transaction->isConcurrentWriteTransaction()) {
+        transactionManager->startCommitOrRollback(transaction);
+    }
     catalog->prepareCommitOrRollback(TransactionAction::COMMIT);
     storageManager->prepareCommit(transaction);
+    if (systemConfig.checkpointInBackground && !skipCheckpointForTestingRecovery &&
+        wal->canDeferCheckpoint()) {
+        // Read-only transactions do not need to leave, since the checkpoint is deferred until
+        // they have.
+        transactionManager->commitButKeepActiveWriteTransaction(transaction);
+        wal->flushAllPages();
+        transactionManager->deferCheckpoint(transaction);
+        return;
+    }
     // Note: It is enough to stop and wait transactions to leave the system instead of
     // for example checking on the query processor's task scheduler. This is because the
     // first and last steps that a connection performs when executing a query is to
@@ -214,6 +263,9 @@ void Database::rollback(
         return;
     }
     KU_ASSERT(transaction->isWriteTransaction());
+    if (transaction->isConcurrentWriteTransaction()) {
+        transactionManager->startCommitOrRollback(transaction);
+    }
     catalog->prepareCommitOrRollback(TransactionAction::ROLLBACK);
     storageManager->prepareRollback(transaction);
     if (skipCheckpointForTestingRecovery) {
@@ -227,15 +279,17 @@ void Database::rollback(
 void Database::checkpointAndClearWAL(WALReplayMode replayMode) {
     KU_ASSERT(replayMode == WALReplayMode::COMMIT_CHECKPOINT ||
               replayMode == WALReplayMode::RECOVERY_CHECKPOINT);
-    auto walReplayer = std::make_unique<WALReplayer>(
-        wal.get(), storageManager.get(), bufferManager.get(), catalog.get(), replayMode, vfs.get());
+    auto walReplayer = std::make_unique<WALReplayer>(wal.get(), storageManager.get(),
+        bufferManager.get(), catalog.get(), replayMode, vfs.get(),
+        queryProcessor->getTaskScheduler());
     walReplayer->replay();
     wal->clearWAL();
 }
 
 void Database::rollbackAndClearWAL() {
     auto walReplayer = std::make_unique<WALReplayer>(wal.get(), storageManager.get(),
-        bufferManager.get(), catalog.get(), WALReplayMode::ROLLBACK, vfs.get());
+        bufferManager.get(), catalog.get(), WALReplayMode::ROLLBACK, vfs.get(),
+        queryProcessor->getTaskScheduler());
     walReplayer->replay();
     wal->clearWAL();
 }
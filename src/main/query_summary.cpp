@@ -15,6 +15,10 @@ double QuerySummary::getExecutionTime() const {
     return executionTime;
 }
 
+uint64_t QuerySummary::getPeakMemory() const {
+    return peakMemory;
+}
+
 void QuerySummary::setPreparedSummary(PreparedSummary preparedSummary_) {
     preparedSummary = preparedSummary_;
 }
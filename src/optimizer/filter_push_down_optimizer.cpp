@@ -1,9 +1,11 @@
 #include "optimizer/filter_push_down_optimizer.h"
 
+#include "binder/expression/function_expression.h"
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression_visitor.h"
 #include "common/cast.h"
+#include "planner/join_order/cardinality_estimator.h"
 #include "planner/operator/logical_empty_result.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_hash_join.h"
@@ -37,7 +39,7 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitOperator
     default: { // Stop current push down for unhandled operator.
         for (auto i = 0u; i < op->getNumChildren(); ++i) {
             // Start new push down for child.
-            auto optimizer = FilterPushDownOptimizer();
+            auto optimizer = FilterPushDownOptimizer(cardinalityEstimator);
             op->setChild(i, optimizer.visitOperator(op->getChild(i)));
         }
         op->computeFlatSchema();
@@ -65,7 +67,7 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitFilterReplace(
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductReplace(
     const std::shared_ptr<LogicalOperator>& op) {
     for (auto i = 0u; i < op->getNumChildren(); ++i) {
-        auto optimizer = FilterPushDownOptimizer();
+        auto optimizer = FilterPushDownOptimizer(cardinalityEstimator);
         op->setChild(i, optimizer.visitOperator(op->getChild(i)));
     }
     auto probeSchema = op->getChild(0)->getSchema();
@@ -122,11 +124,14 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitScanNode
     }
     // Perform filter push down.
     auto currentRoot = scan->getChild(0);
+    auto selectivity = 1.0;
     for (auto& predicate : predicateSet->equalityPredicates) {
         currentRoot = pushDownToScanNode(nodeID, tableIDs, predicate, currentRoot);
+        selectivity *= cardinalityEstimator->estimateSelectivity(*predicate);
     }
     for (auto& predicate : predicateSet->nonEqualityPredicates) {
         currentRoot = pushDownToScanNode(nodeID, tableIDs, predicate, currentRoot);
+        selectivity *= cardinalityEstimator->estimateSelectivity(*predicate);
     }
     // Scan remaining properties.
     expression_vector properties;
@@ -136,7 +141,65 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::visitScanNode
         }
         properties.push_back(property);
     }
-    return appendScanNodeProperty(nodeID, tableIDs, properties, currentRoot);
+    auto child = currentRoot;
+    currentRoot = appendScanNodeProperty(nodeID, tableIDs, properties, currentRoot);
+    if (currentRoot != child && tableIDs.size() == 1 &&
+        selectivity <= PlannerKnobs::LATE_MATERIALIZATION_SELECTIVITY) {
+        // Only the nodes which passed the pushed-down filters need to be read.
+        auto remainingScan =
+            ku_dynamic_cast<LogicalOperator*, LogicalScanNodeProperty*>(currentRoot.get());
+        remainingScan->setLateMaterialization(true);
+    }
+    return currentRoot;
+}
+
+// Returns true for comparisons between a property and a non-null literal of the same data type,
+// e.g. `a.age > 30`.
+static bool isPropertyLiteralComparison(const Expression& predicate) {
+    if (!isExpressionComparison(predicate.expressionType)) {
+        return false;
+    }
+    auto left = predicate.getChild(0);
+    auto right = predicate.getChild(1);
+    if (left->expressionType == ExpressionType::LITERAL) {
+        std::swap(left, right);
+    }
+    if (left->expressionType != ExpressionType::PROPERTY ||
+        right->expressionType != ExpressionType::LITERAL) {
+        return false;
+    }
+    auto literal = ku_dynamic_cast<Expression*, LiteralExpression*>(right.get());
+    return !literal->isNull() && left->dataType == right->dataType;
+}
+
+// Returns true for `STARTS WITH` and `IN` between a STRING property and a non-null literal, e.g.
+// `a.name STARTS WITH 'A'` or `a.name IN ['Alice', 'Bob']`.
+static bool isStringPropertyFilter(const Expression& predicate) {
+    if (predicate.expressionType != ExpressionType::FUNCTION) {
+        return false;
+    }
+    auto& function = ku_dynamic_cast<const Expression&, const FunctionExpression&>(predicate);
+    std::shared_ptr<Expression> property, literal;
+    if (function.getFunctionName() == STARTS_WITH_FUNC_NAME) {
+        property = predicate.getChild(0);
+        literal = predicate.getChild(1);
+    } else if (function.getFunctionName() == LIST_CONTAINS_FUNC_NAME) {
+        property = predicate.getChild(1);
+        literal = predicate.getChild(0);
+    } else {
+        return false;
+    }
+    if (property->expressionType != ExpressionType::PROPERTY ||
+        property->dataType.getLogicalTypeID() != LogicalTypeID::STRING ||
+        literal->expressionType != ExpressionType::LITERAL ||
+        ku_dynamic_cast<Expression*, LiteralExpression*>(literal.get())->isNull()) {
+        return false;
+    }
+    if (literal->dataType.getLogicalTypeID() == LogicalTypeID::VAR_LIST) {
+        return VarListType::getChildType(&literal->dataType)->getLogicalTypeID() ==
+               LogicalTypeID::STRING;
+    }
+    return literal->dataType.getLogicalTypeID() == LogicalTypeID::STRING;
 }
 
 std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::pushDownToScanNode(
@@ -155,8 +218,18 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::pushDownToSca
                   ((PropertyExpression&)*nodeID).getVariableName());
         propertiesSet.insert(expression);
     }
+    auto isSingleTable = tableIDs.size() == 1;
     auto scanNodeProperty = appendScanNodeProperty(std::move(nodeID), std::move(tableIDs),
-        expression_vector{propertiesSet.begin(), propertiesSet.end()}, std::move(child));
+        expression_vector{propertiesSet.begin(), propertiesSet.end()}, child);
+    if (isSingleTable && scanNodeProperty != child &&
+        (isPropertyLiteralComparison(*predicate) || isStringPropertyFilter(*predicate))) {
+        // Let the scan skip node groups whose zone maps can't satisfy the predicate, filter
+        // numeric columns on their compressed values and STRING columns on their dictionary
+        // indices.
+        auto scan = ku_dynamic_cast<LogicalOperator*, LogicalScanNodeProperty*>(
+            scanNodeProperty.get());
+        scan->setPropertyPredicates(expression_vector{predicate});
+    }
     return appendFilter(std::move(predicate), scanNodeProperty);
 }
 
@@ -10,6 +10,8 @@
 #include "optimizer/remove_factorization_rewriter.h"
 #include "optimizer/remove_unnecessary_join_optimizer.h"
 #include "optimizer/top_k_optimizer.h"
+#include "planner/join_order/cardinality_estimator.h"
+#include "storage/storage_manager.h"
 
 namespace kuzu {
 namespace optimizer {
@@ -25,7 +27,10 @@ void Optimizer::optimize(planner::LogicalPlan* plan, main::ClientContext* client
     auto removeUnnecessaryJoinOptimizer = RemoveUnnecessaryJoinOptimizer();
     removeUnnecessaryJoinOptimizer.rewrite(plan);
 
-    auto filterPushDownOptimizer = FilterPushDownOptimizer();
+    auto storageManager = client->getStorageManager();
+    auto cardinalityEstimator = planner::CardinalityEstimator(
+        storageManager->getNodesStatisticsAndDeletedIDs(), storageManager->getRelsStatistics());
+    auto filterPushDownOptimizer = FilterPushDownOptimizer(&cardinalityEstimator);
     filterPushDownOptimizer.rewrite(plan);
 
     auto projectionPushDownOptimizer = ProjectionPushDownOptimizer();
@@ -1,5 +1,6 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "planner/join_order/join_order_util.h"
 #include "planner/operator/scan/logical_scan_internal_id.h"
@@ -39,11 +40,15 @@ uint64_t CardinalityEstimator::estimateScanNode(LogicalOperator* op) {
 
 uint64_t CardinalityEstimator::estimateHashJoin(
     const expression_vector& joinKeys, const LogicalPlan& probePlan, const LogicalPlan& buildPlan) {
-    auto denominator = 1u;
+    uint64_t denominator = 1;
     for (auto& joinKey : joinKeys) {
-        // TODO(Xiyang): we should be able to estimate non-ID-based joins as well.
         if (nodeIDName2dom.contains(joinKey->getUniqueName())) {
             denominator *= getNodeIDDom(joinKey->getUniqueName());
+        } else if (joinKey->expressionType == ExpressionType::PROPERTY) {
+            // The domain of a property is its number of distinct values.
+            auto& property =
+                ku_dynamic_cast<const Expression&, const PropertyExpression&>(*joinKey);
+            denominator *= atLeastOne(estimateNumDistinctValues(property));
         }
     }
     return atLeastOne(probePlan.estCardinality *
@@ -89,17 +94,164 @@ static bool isPrimaryKey(const Expression& expression) {
 
 uint64_t CardinalityEstimator::estimateFilter(
     const LogicalPlan& childPlan, const Expression& predicate) {
-    if (predicate.expressionType == ExpressionType::EQUALS) {
-        if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
-            return 1;
+    if (predicate.expressionType == ExpressionType::EQUALS &&
+        (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1)))) {
+        return 1;
+    }
+    return atLeastOne(childPlan.estCardinality * estimateSelectivity(predicate));
+}
+
+// Returns the estimated fraction of the tuples of a table satisfying `property <comparison>
+// literal`, or std::nullopt if the statistics of the property can't tell.
+static std::optional<double> estimateComparisonSelectivity(const storage::PropertyStatistics& stats,
+    uint64_t numTuples, ExpressionType comparison, const Value& literal,
+    PhysicalTypeID physicalType) {
+    if (numTuples == 0 || stats.getNumValues() == 0) {
+        return std::nullopt;
+    }
+    // Nulls never satisfy a comparison
+    auto nonNullFraction = std::min(1.0, (double)stats.getNumValues() / (double)numTuples);
+    auto value = storage::StorageValue::fromValue(literal);
+    auto& range = stats.getRange();
+    if (value && range.hasStats &&
+        range.canSkip(storage::ColumnPredicate(INVALID_COLUMN_ID, comparison, *value),
+            physicalType)) {
+        return 0;
+    }
+    auto& histogram = stats.getHistogram();
+    switch (comparison) {
+    case ExpressionType::EQUALS:
+    case ExpressionType::NOT_EQUALS: {
+        auto numDistinctValues = stats.estimateNumDistinctValues();
+        if (numDistinctValues == 0) {
+            return std::nullopt;
+        }
+        auto equalFraction = 1.0 / (double)numDistinctValues;
+        if (value && !histogram.isEmpty()) {
+            // Frequent values fill whole buckets of the histogram
+            auto doubleValue = value->toDouble(physicalType);
+            equalFraction = std::max(equalFraction,
+                histogram.estimateFractionBelow(doubleValue, true /* inclusive */) -
+                    histogram.estimateFractionBelow(doubleValue, false /* inclusive */));
+        }
+        return nonNullFraction *
+               (comparison == ExpressionType::EQUALS ? equalFraction : 1 - equalFraction);
+    }
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        if (!value || histogram.isEmpty()) {
+            return std::nullopt;
+        }
+        auto doubleValue = value->toDouble(physicalType);
+        double fraction;
+        if (comparison == ExpressionType::LESS_THAN) {
+            fraction = histogram.estimateFractionBelow(doubleValue, false /* inclusive */);
+        } else if (comparison == ExpressionType::LESS_THAN_EQUALS) {
+            fraction = histogram.estimateFractionBelow(doubleValue, true /* inclusive */);
+        } else if (comparison == ExpressionType::GREATER_THAN) {
+            fraction = 1 - histogram.estimateFractionBelow(doubleValue, true /* inclusive */);
         } else {
-            return atLeastOne(
-                childPlan.estCardinality * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
+            fraction = 1 - histogram.estimateFractionBelow(doubleValue, false /* inclusive */);
+        }
+        return nonNullFraction * fraction;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+static std::optional<double> estimateNullCheckSelectivity(
+    const storage::PropertyStatistics& stats, uint64_t numTuples, ExpressionType nullCheck) {
+    double nullFraction;
+    if (!stats.mayHaveNull()) {
+        nullFraction = 0;
+    } else if (numTuples > 0 && stats.getNumValues() > 0) {
+        nullFraction = 1 - std::min(1.0, (double)stats.getNumValues() / (double)numTuples);
+    } else {
+        return std::nullopt;
+    }
+    return nullCheck == ExpressionType::IS_NULL ? nullFraction : 1 - nullFraction;
+}
+
+double CardinalityEstimator::estimateSelectivity(const Expression& predicate) const {
+    auto defaultSelectivity = predicate.expressionType == ExpressionType::EQUALS ?
+                                  PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY :
+                                  PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+    auto expressionType = predicate.expressionType;
+    std::shared_ptr<Expression> property, literal;
+    if (isExpressionComparison(expressionType)) {
+        property = predicate.getChild(0);
+        literal = predicate.getChild(1);
+        if (property->expressionType == ExpressionType::LITERAL) {
+            std::swap(property, literal);
+            expressionType = reverseComparison(expressionType);
         }
+        if (literal->expressionType != ExpressionType::LITERAL ||
+            ku_dynamic_cast<Expression*, LiteralExpression*>(literal.get())->isNull() ||
+            property->dataType != literal->dataType) {
+            return defaultSelectivity;
+        }
+    } else if (isExpressionNullOperator(expressionType)) {
+        property = predicate.getChild(0);
     } else {
-        return atLeastOne(
-            childPlan.estCardinality * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
+        return defaultSelectivity;
+    }
+    if (property->expressionType != ExpressionType::PROPERTY) {
+        return defaultSelectivity;
+    }
+    auto& propertyExpression =
+        ku_dynamic_cast<const Expression&, const PropertyExpression&>(*property);
+    // Average the selectivity over the tables of the property, weighted by their size
+    double numSelectedTuples = 0, numTuples = 0;
+    for (auto& [stats, numTuplesInTable] : getPropertyStatistics(propertyExpression)) {
+        auto selectivity =
+            literal ? estimateComparisonSelectivity(*stats, numTuplesInTable, expressionType,
+                          *ku_dynamic_cast<Expression*, LiteralExpression*>(literal.get())
+                               ->getValue(),
+                          property->dataType.getPhysicalType()) :
+                      estimateNullCheckSelectivity(*stats, numTuplesInTable, expressionType);
+        numSelectedTuples += selectivity.value_or(defaultSelectivity) * (double)numTuplesInTable;
+        numTuples += (double)numTuplesInTable;
+    }
+    if (numTuples == 0) {
+        return defaultSelectivity;
+    }
+    return numSelectedTuples / numTuples;
+}
+
+std::vector<std::pair<const storage::PropertyStatistics*, uint64_t>>
+CardinalityEstimator::getPropertyStatistics(const PropertyExpression& property) const {
+    std::vector<std::pair<const storage::PropertyStatistics*, uint64_t>> result;
+    if (!nodesStatistics || !relsStatistics) {
+        return result;
+    }
+    for (auto tablesStatistics : std::initializer_list<const storage::TablesStatistics*>{
+             nodesStatistics, relsStatistics}) {
+        for (auto& [tableID, tableStatistics] :
+            tablesStatistics->getReadOnlyVersion()->tableStatisticPerTable) {
+            if (!property.hasPropertyID(tableID)) {
+                continue;
+            }
+            auto propertyID = property.getPropertyID(tableID);
+            // Internal properties (e.g. _id) don't have statistics
+            if (tableStatistics->hasPropertyStatistics(propertyID)) {
+                result.emplace_back(&tableStatistics->getPropertyStatistics(propertyID),
+                    tableStatistics->getNumTuples());
+            }
+        }
+    }
+    return result;
+}
+
+uint64_t CardinalityEstimator::estimateNumDistinctValues(const PropertyExpression& property) const {
+    // Tables may share values, so this is an upper bound
+    uint64_t numDistinctValues = 0;
+    for (auto& [stats, numTuples] : getPropertyStatistics(property)) {
+        numDistinctValues += stats->estimateNumDistinctValues();
     }
+    return numDistinctValues;
 }
 
 uint64_t CardinalityEstimator::getNumNodes(const std::vector<common::table_id_t>& tableIDs) {
@@ -359,6 +359,22 @@ populateIntersectRelCandidates(const QueryGraph& queryGraph, const SubqueryGraph
     return intersectNodePosToRelsMap;
 }
 
+// Intersect merges adjacency lists by node offset, so each list must be sorted and come from a
+// single node table. Lists of multi-labeled or undirected rels are concatenated from several
+// scans and are not sorted.
+static bool canIntersect(const NodeExpression& intersectNode,
+    const std::vector<std::shared_ptr<RelExpression>>& rels) {
+    if (intersectNode.isMultiLabeled()) {
+        return false;
+    }
+    for (auto& rel : rels) {
+        if (rel->isMultiLabeled() || rel->getDirectionType() == RelDirectionType::BOTH) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Planner::planWCOJoin(uint32_t leftLevel, uint32_t rightLevel) {
     KU_ASSERT(leftLevel <= rightLevel);
     auto queryGraph = context.getQueryGraph();
@@ -367,6 +383,9 @@ void Planner::planWCOJoin(uint32_t leftLevel, uint32_t rightLevel) {
         for (auto& [intersectNodePos, rels] : candidates) {
             if (rels.size() == leftLevel) {
                 auto intersectNode = queryGraph->getQueryNode(intersectNodePos);
+                if (!canIntersect(*intersectNode, rels)) {
+                    continue;
+                }
                 planWCOJoin(rightSubgraph, rels, intersectNode);
             }
         }
@@ -1,4 +1,9 @@
+#include "binder/expression/function_expression.h"
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/cast.h"
+#include "common/types/value/nested.h"
 #include "planner/operator/scan/logical_scan_node_property.h"
 #include "processor/operator/scan/scan_multi_node_tables.h"
 #include "processor/plan_mapper.h"
@@ -11,6 +16,94 @@ using namespace kuzu::planner;
 namespace kuzu {
 namespace processor {
 
+static std::vector<storage::ColumnPredicate> getColumnPredicates(
+    const expression_vector& predicates, table_id_t tableID, catalog::TableCatalogEntry* entry) {
+    std::vector<storage::ColumnPredicate> columnPredicates;
+    for (auto& predicate : predicates) {
+        auto comparison = predicate->expressionType;
+        if (!isExpressionComparison(comparison)) {
+            continue;
+        }
+        auto property = predicate->getChild(0);
+        auto literal = predicate->getChild(1);
+        if (property->expressionType == ExpressionType::LITERAL) {
+            // Normalize the property to the left hand side.
+            std::swap(property, literal);
+            comparison = reverseComparison(comparison);
+        }
+        auto propertyExpr = ku_dynamic_cast<Expression*, PropertyExpression*>(property.get());
+        if (!propertyExpr->hasPropertyID(tableID)) {
+            continue;
+        }
+        auto literalExpr = ku_dynamic_cast<Expression*, LiteralExpression*>(literal.get());
+        auto value = storage::StorageValue::fromValue(*literalExpr->getValue());
+        if (!value.has_value() ||
+            !storage::ColumnChunkStats::isSupported(property->dataType.getPhysicalType())) {
+            continue;
+        }
+        columnPredicates.emplace_back(
+            entry->getColumnID(propertyExpr->getPropertyID(tableID)), comparison, *value);
+    }
+    return columnPredicates;
+}
+
+static std::vector<storage::StringColumnPredicate> getStringColumnPredicates(
+    const expression_vector& predicates, table_id_t tableID, catalog::TableCatalogEntry* entry) {
+    std::vector<storage::StringColumnPredicate> stringPredicates;
+    for (auto& predicate : predicates) {
+        std::shared_ptr<Expression> property, literal;
+        storage::StringColumnPredicate::Type type;
+        if (predicate->expressionType == ExpressionType::EQUALS) {
+            type = storage::StringColumnPredicate::Type::EQUALS;
+            property = predicate->getChild(0);
+            literal = predicate->getChild(1);
+            if (property->expressionType == ExpressionType::LITERAL) {
+                std::swap(property, literal);
+            }
+        } else if (predicate->expressionType == ExpressionType::FUNCTION) {
+            auto functionName =
+                ku_dynamic_cast<Expression*, FunctionExpression*>(predicate.get())
+                    ->getFunctionName();
+            if (functionName == STARTS_WITH_FUNC_NAME) {
+                type = storage::StringColumnPredicate::Type::STARTS_WITH;
+                property = predicate->getChild(0);
+                literal = predicate->getChild(1);
+            } else if (functionName == LIST_CONTAINS_FUNC_NAME) {
+                type = storage::StringColumnPredicate::Type::IN;
+                property = predicate->getChild(1);
+                literal = predicate->getChild(0);
+            } else {
+                continue;
+            }
+        } else {
+            continue;
+        }
+        if (property->dataType.getLogicalTypeID() != LogicalTypeID::STRING) {
+            continue;
+        }
+        auto propertyExpr = ku_dynamic_cast<Expression*, PropertyExpression*>(property.get());
+        if (!propertyExpr->hasPropertyID(tableID)) {
+            continue;
+        }
+        auto value = ku_dynamic_cast<Expression*, LiteralExpression*>(literal.get())->getValue();
+        std::vector<std::string> values;
+        if (type == storage::StringColumnPredicate::Type::IN) {
+            for (auto i = 0u; i < NestedVal::getChildrenSize(value); i++) {
+                auto child = NestedVal::getChildVal(value, i);
+                // Null elements never compare equal to a string
+                if (!child->isNull()) {
+                    values.push_back(child->getValue<std::string>());
+                }
+            }
+        } else {
+            values.push_back(value->getValue<std::string>());
+        }
+        stringPredicates.emplace_back(entry->getColumnID(propertyExpr->getPropertyID(tableID)),
+            type, std::move(values));
+    }
+    return stringPredicates;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeProperty(
     LogicalOperator* logicalOperator) {
     auto& scanProperty = (const LogicalScanNodeProperty&)*logicalOperator;
@@ -56,8 +149,11 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeProperty(
                 columnIDs.push_back(UINT32_MAX);
             }
         }
-        auto info = std::make_unique<ScanNodeTableInfo>(
-            storageManager.getNodeTable(tableID), std::move(columnIDs));
+        auto info = std::make_unique<ScanNodeTableInfo>(storageManager.getNodeTable(tableID),
+            std::move(columnIDs),
+            getColumnPredicates(scanProperty.getPropertyPredicates(), tableID, tableSchema),
+            getStringColumnPredicates(scanProperty.getPropertyPredicates(), tableID, tableSchema));
+        info->lateMaterialization = scanProperty.isLateMaterialization();
         return std::make_unique<ScanSingleNodeTable>(std::move(info), inputNodeIDVectorPos,
             std::move(outVectorsPos), std::move(prevOperator), getOperatorID(),
             scanProperty.getExpressionsForPrinting());
@@ -223,6 +223,24 @@ void AggregateHashTable::resize(uint64_t newSize) {
     }
 }
 
+void AggregateHashTable::pinBlocks() {
+    BaseHashTable::pinBlocks();
+    for (auto& distinctHT : distinctHashTables) {
+        if (distinctHT != nullptr) {
+            distinctHT->pinBlocks();
+        }
+    }
+}
+
+void AggregateHashTable::unpinBlocks() {
+    BaseHashTable::unpinBlocks();
+    for (auto& distinctHT : distinctHashTables) {
+        if (distinctHT != nullptr) {
+            distinctHT->unpinBlocks();
+        }
+    }
+}
+
 void AggregateHashTable::initializeFTEntryWithFlatVec(
     ValueVector* flatVector, uint64_t numEntriesToInitialize, uint32_t colIdx) {
     KU_ASSERT(flatVector->state->isFlat());
@@ -859,7 +877,15 @@ void AggregateHashTable::updateFlatKeyUnFlatAggVectorState(
     uint64_t multiplicity, uint32_t aggStateOffset) {
     auto groupByKeyPos = flatKeyVectors[0]->state->selVector->selectedPositions[0];
     auto aggVecSelectedSize = aggVector->state->selVector->selectedSize;
-    if (aggVector->hasNoNullsGuarantee()) {
+    if (aggVector->isConstant()) {
+        // All positions hold the same value, so aggregate it once for the whole vector.
+        if (aggVecSelectedSize > 0) {
+            aggregateFunction->updatePosState(
+                hashSlotsToUpdateAggState[groupByKeyPos]->entry + aggStateOffset, aggVector,
+                multiplicity * aggVecSelectedSize, aggVector->state->selVector->selectedPositions[0],
+                &memoryManager);
+        }
+    } else if (aggVector->hasNoNullsGuarantee()) {
         if (aggVector->state->selVector->isUnfiltered()) {
             for (auto i = 0u; i < aggVecSelectedSize; i++) {
                 aggregateFunction->updatePosState(
@@ -9,12 +9,16 @@ namespace processor {
 
 void HashAggregateSharedState::appendAggregateHashTable(
     std::unique_ptr<AggregateHashTable> aggregateHashTable) {
+    // The table isn't accessed until it is combined in finalize, so it can be spilled while the
+    // other threads are still aggregating.
+    aggregateHashTable->unpinBlocks();
     std::unique_lock lck{mtx};
     localAggregateHashTables.push_back(std::move(aggregateHashTable));
 }
 
 void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memoryManager*/) {
     std::unique_lock lck{mtx};
+    localAggregateHashTables[0]->pinBlocks();
     if (localAggregateHashTables.size() == 1) {
         globalAggregateHashTable = std::move(localAggregateHashTables[0]);
     } else {
@@ -25,7 +29,10 @@ void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memory
         localAggregateHashTables[0]->resize(nextPowerOfTwo(numEntries));
         globalAggregateHashTable = std::move(localAggregateHashTables[0]);
         for (auto i = 1u; i < localAggregateHashTables.size(); i++) {
+            localAggregateHashTables[i]->pinBlocks();
             globalAggregateHashTable->merge(*localAggregateHashTables[i]);
+            // The merged table is not read again.
+            localAggregateHashTables[i]->unpinBlocks();
         }
     }
 }
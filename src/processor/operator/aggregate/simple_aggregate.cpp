@@ -95,6 +95,14 @@ void SimpleAggregate::computeAggregate(function::AggregateFunction* function, Ag
             function->updatePosState(
                 (uint8_t*)state, input->aggregateVector, multiplicity, pos, memoryManager);
         }
+    } else if (input->aggregateVector && input->aggregateVector->isConstant()) {
+        // All positions hold the same value, so aggregate it once for the whole vector.
+        auto selVector = input->aggregateVector->state->selVector.get();
+        if (selVector->selectedSize > 0) {
+            function->updatePosState((uint8_t*)state, input->aggregateVector,
+                multiplicity * selVector->selectedSize, selVector->selectedPositions[0],
+                memoryManager);
+        }
     } else {
         function->updateAllState(
             (uint8_t*)state, input->aggregateVector, multiplicity, memoryManager);
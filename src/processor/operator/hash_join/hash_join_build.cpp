@@ -7,6 +7,9 @@ namespace kuzu {
 namespace processor {
 
 void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
+    // The tuples aren't accessed until the hash slots are built in finalize, so they can be
+    // spilled while the other threads are still building.
+    localHashTable.unpinBlocks();
     std::unique_lock lck(mtx);
     hashTable->merge(localHashTable);
 }
@@ -40,6 +43,7 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
 }
 
 void HashJoinBuild::finalize(ExecutionContext* /*context*/) {
+    sharedState->getHashTable()->pinBlocks();
     auto numTuples = sharedState->getHashTable()->getNumTuples();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
@@ -36,6 +36,18 @@ uint8_t* MergedKeyBlocks::getBlockEndTuplePtr(
                                           getKeyBlockBuffer(blockIdx) + endTupleOffset;
 }
 
+void MergedKeyBlocks::pin() {
+    for (auto& keyBlock : keyBlocks) {
+        keyBlock->pin();
+    }
+}
+
+void MergedKeyBlocks::unpin() {
+    for (auto& keyBlock : keyBlocks) {
+        keyBlock->unpin();
+    }
+}
+
 BlockPtrInfo::BlockPtrInfo(uint64_t startTupleIdx, uint64_t endTupleIdx, MergedKeyBlocks* keyBlocks)
     : keyBlocks{keyBlocks}, curBlockIdx{startTupleIdx / keyBlocks->getNumTuplesPerBlock()},
       endBlockIdx{endTupleIdx == 0 ? 0 : (endTupleIdx - 1) / keyBlocks->getNumTuplesPerBlock()},
@@ -245,9 +257,10 @@ bool KeyBlockMerger::compareTuplePtrWithStringCol(
         }
         return result > 0;
     }
-    // The string tie can't be solved, just add the tuple in the leftMemBlock to
-    // resultMemBlock.
-    return false;
+    // The string columns are tied, so compare the key columns after the last string column. If
+    // they are tied as well, the tuple in the leftMemBlock is added to resultMemBlock first.
+    return memcmp(leftTuplePtr + lastComparedBytes, rightTuplePtr + lastComparedBytes,
+               numBytesToCompare - lastComparedBytes) > 0;
 }
 
 void KeyBlockMerger::copyRemainingBlockDataToResult(
@@ -282,6 +295,8 @@ std::unique_ptr<KeyBlockMergeMorsel> KeyBlockMergeTaskDispatcher::getMorsel() {
         sortedKeyBlocks->pop();
         auto rightKeyBlock = sortedKeyBlocks->front();
         sortedKeyBlocks->pop();
+        leftKeyBlock->pin();
+        rightKeyBlock->pin();
         auto resultKeyBlock = std::make_shared<MergedKeyBlocks>(leftKeyBlock->getNumBytesPerTuple(),
             leftKeyBlock->getNumTuples() + rightKeyBlock->getNumTuples(), memoryManager);
         auto newMergeTask = std::make_shared<KeyBlockMergeTask>(
@@ -304,6 +319,7 @@ void KeyBlockMergeTaskDispatcher::doneMorsel(std::unique_ptr<KeyBlockMergeMorsel
     if ((--morsel->keyBlockMergeTask->activeMorsels) == 0 &&
         !morsel->keyBlockMergeTask->hasMorselLeft()) {
         erase(activeKeyBlockMergeTasks, morsel->keyBlockMergeTask);
+        morsel->keyBlockMergeTask->resultKeyBlock->unpin();
         sortedKeyBlocks->emplace(morsel->keyBlockMergeTask->resultKeyBlock);
     }
 }
@@ -55,9 +55,9 @@ void RadixSort::sortSingleKeyBlock(const DataBlock& keyBlock) {
 void RadixSort::radixSort(uint8_t* keyBlockPtr, uint32_t numTuplesToSort, uint32_t numBytesSorted,
     uint32_t numBytesToSort) {
     // We use radixSortLSD which sorts from the least significant byte to the most significant byte.
+    // Tuples are copied as a whole from their start, so the pointers are not advanced by
+    // numBytesSorted, which would make the last tuple's copy run past the end of the block.
     auto tmpKeyBlockPtr = tmpSortingResultBlock->getData();
-    keyBlockPtr += numBytesSorted;
-    tmpKeyBlockPtr += numBytesSorted;
     constexpr uint16_t countingArraySize = 256;
     uint32_t count[countingArraySize];
     auto isInTmpBlock = false;
@@ -65,7 +65,7 @@ void RadixSort::radixSort(uint8_t* keyBlockPtr, uint32_t numTuplesToSort, uint32
         memset(count, 0, countingArraySize * sizeof(uint32_t));
         auto sourcePtr = isInTmpBlock ? tmpKeyBlockPtr : keyBlockPtr;
         auto targetPtr = isInTmpBlock ? keyBlockPtr : tmpKeyBlockPtr;
-        auto curByteOffset = numBytesToSort - curByteIdx;
+        auto curByteOffset = numBytesSorted + numBytesToSort - curByteIdx;
         auto sortBytePtr = sourcePtr + curByteOffset;
         // counting sort
         for (auto j = 0ul; j < numTuplesToSort; j++) {
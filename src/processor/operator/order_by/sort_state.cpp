@@ -34,6 +34,7 @@ std::pair<uint64_t, FactorizedTable*> SortSharedState::getLocalPayloadTable(
 void SortSharedState::appendLocalSortedKeyBlock(
     const std::shared_ptr<MergedKeyBlocks>& mergedDataBlocks) {
     std::unique_lock lck{mtx};
+    mergedDataBlocks->unpin();
     sortedKeyBlocks->emplace(mergedDataBlocks);
 }
 
@@ -43,6 +44,15 @@ void SortSharedState::combineFTHasNoNullGuarantee() {
     }
 }
 
+void SortSharedState::pinMergedKeyBlockAndPayloadTables() {
+    if (!sortedKeyBlocks->empty()) {
+        sortedKeyBlocks->front()->pin();
+    }
+    for (auto& payloadTable : payloadTables) {
+        payloadTable->pinBlocks();
+    }
+}
+
 std::vector<FactorizedTable*> SortSharedState::getPayloadTables() const {
     std::vector<FactorizedTable*> payloadTablesToReturn;
     payloadTablesToReturn.reserve(payloadTables.size());
@@ -79,6 +89,11 @@ void SortLocalState::finalize(kuzu::processor::SortSharedState& sharedState) {
         }
     }
     orderByKeyEncoder->clear();
+    // Merging only reads the payload table to break ties between string keys, so otherwise the
+    // payload table can be spilled until it is scanned.
+    if (sharedState.getStrKeyColInfo().empty()) {
+        payloadTable->unpinBlocks();
+    }
 }
 
 PayloadScanner::PayloadScanner(MergedKeyBlocks* keyBlockToScan,
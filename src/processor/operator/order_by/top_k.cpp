@@ -40,6 +40,7 @@ void TopKSortState::finalize() {
         merger->mergeKeyBlocks(*keyBlockMergeMorsel);
         dispatcher->doneMorsel(std::move(keyBlockMergeMorsel));
     }
+    orderBySharedState->pinMergedKeyBlockAndPayloadTables();
 }
 
 void TopKBuffer::init(
@@ -19,6 +19,11 @@ bool Profile::getNextTuplesInternal(ExecutionContext* context) {
     ku_string_t profileStr;
     auto planPrinter = std::make_unique<main::PlanPrinter>(info.physicalPlan, context->profiler);
     auto planInString = planPrinter->printPlanToOstream().str();
+    if (context->memoryTracker != nullptr) {
+        // All other pipelines of the plan have been executed at this point.
+        planInString += "Peak memory: " +
+                        std::to_string(context->memoryTracker->getPeakMemory()) + " bytes\n";
+    }
     StringVector::addString(outputVector, profileStr, planInString.c_str(), planInString.length());
     auto selVector = outputVector->state->selVector;
     selVector->selectedSize = 1;
@@ -6,16 +6,24 @@ namespace kuzu {
 namespace processor {
 
 bool ScanSingleNodeTable::getNextTuplesInternal(ExecutionContext* context) {
-    if (!children[0]->getNextTuple(context)) {
-        return false;
+    auto transaction = context->clientContext->getTx();
+    while (true) {
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        if (info->table->canSkipScan(transaction, inVector, info->columnPredicates)) {
+            continue;
+        }
+        for (auto& outputVector : outVectors) {
+            outputVector->resetAuxiliaryBuffer();
+        }
+        info->table->initializeReadState(transaction, info->columnIDs, inVector, readState.get());
+        info->table->read(transaction, *readState, inVector, outVectors);
+        // Dictionary filters may have removed every node in the vector.
+        if (inVector->state->selVector->selectedSize > 0) {
+            return true;
+        }
     }
-    for (auto& outputVector : outVectors) {
-        outputVector->resetAuxiliaryBuffer();
-    }
-    info->table->initializeReadState(
-        context->clientContext->getTx(), info->columnIDs, inVector, readState.get());
-    info->table->read(context->clientContext->getTx(), *readState, inVector, outVectors);
-    return true;
 }
 
 } // namespace processor
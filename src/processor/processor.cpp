@@ -22,6 +22,7 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(
     // expect to have linear plans. For binary operators, e.g., HashJoin, we  keep probe and its
     // prevOperator in the same pipeline, and decompose build and its prevOperator into another
     // one.
+    MemoryTrackerScope memoryTrackerScope{context->memoryTracker.get()};
     auto task = std::make_shared<ProcessorTask>(resultCollector, context);
     decomposePlanIntoTask(lastOperator->getChild(0), task.get(), context);
     initTask(task.get());
@@ -13,6 +13,7 @@ ProcessorTask::ProcessorTask(Sink* sink, ExecutionContext* executionContext)
       sharedStateInitialized{false}, sink{sink}, executionContext{executionContext} {}
 
 void ProcessorTask::run() {
+    storage::MemoryTrackerScope memoryTrackerScope{executionContext->memoryTracker.get()};
     // We need the lock when cloning because multiple threads can be accessing to clone,
     // which is not thread safe
     lock_t lck{mtx};
@@ -29,6 +30,7 @@ void ProcessorTask::run() {
 }
 
 void ProcessorTask::finalizeIfNecessary() {
+    storage::MemoryTrackerScope memoryTrackerScope{executionContext->memoryTracker.get()};
     auto resultSet = populateResultSet(sink, executionContext->clientContext->getMemoryManager());
     sink->initLocalState(resultSet.get(), executionContext);
     sink->finalize(executionContext);
@@ -88,8 +88,11 @@ void DataBlockCollection::merge(DataBlockCollection& other) {
     auto oldLastBlock = std::move(blocks.back());
     blocks.pop_back();
     append(std::move(other.blocks));
-    // Insert back tuples in the old last block to the new last block.
+    // Insert back tuples in the old last block to the new last block. Either table may have been
+    // unpinned while it waited to be merged.
     auto newLastBlock = blocks.back().get();
+    oldLastBlock->pin();
+    newLastBlock->pin();
     auto numTuplesToAppendIntoNewLastBlock =
         std::min(numTuplesPerBlock - newLastBlock->numTuples, oldLastBlock->numTuples);
     DataBlock::copyTuples(oldLastBlock.get(), 0, newLastBlock, newLastBlock->numTuples,
@@ -106,6 +109,18 @@ void DataBlockCollection::merge(DataBlockCollection& other) {
     }
 }
 
+void DataBlockCollection::pin() {
+    for (auto& block : blocks) {
+        block->pin();
+    }
+}
+
+void DataBlockCollection::unpin() {
+    for (auto& block : blocks) {
+        block->unpin();
+    }
+}
+
 FactorizedTable::FactorizedTable(
     MemoryManager* memoryManager, std::unique_ptr<FactorizedTableSchema> tableSchema)
     : memoryManager{memoryManager}, tableSchema{std::move(tableSchema)}, numTuples{0} {
@@ -225,6 +240,18 @@ void FactorizedTable::merge(FactorizedTable& other) {
     numTuples += other.numTuples;
 }
 
+void FactorizedTable::pinBlocks() {
+    flatTupleBlockCollection->pin();
+    unflatTupleBlockCollection->pin();
+    inMemOverflowBuffer->pinBlocks();
+}
+
+void FactorizedTable::unpinBlocks() {
+    flatTupleBlockCollection->unpin();
+    unflatTupleBlockCollection->unpin();
+    inMemOverflowBuffer->unpinBlocks();
+}
+
 bool FactorizedTable::hasUnflatCol() const {
     std::vector<ft_col_idx_t> colIdxes(tableSchema->getNumColumns());
     iota(colIdxes.begin(), colIdxes.end(), 0);
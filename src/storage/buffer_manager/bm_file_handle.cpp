@@ -20,23 +20,23 @@ BMFileHandle::BMFileHandle(const std::string& path, uint8_t flags, BufferManager
     PageSizeClass pageSizeClass, FileVersionedType fileVersionedType,
     common::VirtualFileSystem* vfs)
     : FileHandle{path, flags, vfs}, fileVersionedType{fileVersionedType}, bm{bm},
-      pageSizeClass{pageSizeClass} {
+      pageSizeClass{pageSizeClass}, pageGroupDirectory{nullptr}, pageGroupDirectoryCapacity{0},
+      numCacheHits{0}, numCacheMisses{0}, numEvictions{0},
+      numPrefetchedPages{0} {
     initPageStatesAndGroups();
+    bm->registerFileHandle(this);
 }
 
 BMFileHandle::~BMFileHandle() {
     bm->removeFilePagesFromFrames(*this);
+    bm->unregisterFileHandle(this);
 }
 
 void BMFileHandle::initPageStatesAndGroups() {
-    pageStates.resize(pageCapacity);
-    for (auto i = 0ull; i < numPages; i++) {
-        pageStates[i] = std::make_unique<PageState>();
-    }
-    auto numPageGroups = getNumPageGroups();
-    frameGroupIdxes.resize(numPageGroups);
+    auto numPageGroups = pageCapacity >> StorageConstants::PAGE_GROUP_SIZE_LOG2;
+    pageCapacity = 0;
     for (auto i = 0u; i < numPageGroups; i++) {
-        frameGroupIdxes[i] = bm->addNewFrameGroup(pageSizeClass);
+        addNewPageGroupWithoutLock();
     }
 }
 
@@ -44,14 +44,33 @@ page_idx_t BMFileHandle::addNewPageWithoutLock() {
     if (numPages == pageCapacity) {
         addNewPageGroupWithoutLock();
     }
-    pageStates[numPages] = std::make_unique<PageState>();
+    // The page may have been truncated before, in which case its state is stale.
+    getPageGroup(numPages)
+        ->pageStates[numPages & StorageConstants::PAGE_IDX_IN_GROUP_MASK]
+        .resetToEvicted();
     return numPages++;
 }
 
 void BMFileHandle::addNewPageGroupWithoutLock() {
+    auto pageGroupIdx = pageCapacity >> StorageConstants::PAGE_GROUP_SIZE_LOG2;
     pageCapacity += StorageConstants::PAGE_GROUP_SIZE;
-    pageStates.resize(pageCapacity);
-    frameGroupIdxes.push_back(bm->addNewFrameGroup(pageSizeClass));
+    if (pageGroupIdx < pageGroups.size()) {
+        return;
+    }
+    if (pageGroupIdx == pageGroupDirectoryCapacity) {
+        auto newCapacity = std::max<uint64_t>(16, 2 * pageGroupDirectoryCapacity);
+        auto newDirectory = std::make_unique<std::atomic<PageGroup*>[]>(newCapacity);
+        for (auto i = 0u; i < newCapacity; i++) {
+            newDirectory[i].store(i < pageGroups.size() ? pageGroups[i].get() : nullptr,
+                std::memory_order_relaxed);
+        }
+        pageGroupDirectory.store(newDirectory.get(), std::memory_order_release);
+        pageGroupDirectoryCapacity = newCapacity;
+        pageGroupDirectories.push_back(std::move(newDirectory));
+    }
+    pageGroups.push_back(std::make_unique<PageGroup>(bm->addNewFrameGroup(pageSizeClass)));
+    pageGroupDirectory.load(std::memory_order_relaxed)[pageGroupIdx].store(
+        pageGroups.back().get(), std::memory_order_release);
 }
 
 page_group_idx_t BMFileHandle::addWALPageIdxGroupIfNecessary(page_idx_t originalPageIdx) {
@@ -80,17 +99,17 @@ void BMFileHandle::removePageIdxAndTruncateIfNecessary(page_idx_t pageIdx) {
         return;
     }
     numPages = pageIdx;
-    pageStates.resize(numPages);
-    auto numPageGroups = getNumPageGroups();
-    if (numPageGroups == frameGroupIdxes.size()) {
+    auto numPageGroups = (numPages + StorageConstants::PAGE_GROUP_SIZE - 1) >>
+                         StorageConstants::PAGE_GROUP_SIZE_LOG2;
+    auto oldNumPageGroups = pageCapacity >> StorageConstants::PAGE_GROUP_SIZE_LOG2;
+    if (numPageGroups == oldNumPageGroups) {
         return;
     }
-    KU_ASSERT(numPageGroups < frameGroupIdxes.size());
-    frameGroupIdxes.resize(numPageGroups);
+    KU_ASSERT(numPageGroups < oldNumPageGroups);
     if (numPageGroups == 0) {
         walPageIdxGroups.clear();
     } else {
-        for (auto groupIdx = numPageGroups; groupIdx < frameGroupIdxes.size(); groupIdx++) {
+        for (auto groupIdx = numPageGroups; groupIdx < oldNumPageGroups; groupIdx++) {
             walPageIdxGroups.erase(groupIdx);
         }
     }
@@ -1,9 +1,12 @@
 #include "storage/buffer_manager/buffer_manager.h"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 
 #include "common/constants.h"
 #include "common/exception/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 #if defined(_WIN32)
 #include <exception>
@@ -17,61 +20,25 @@ using namespace kuzu::common;
 
 namespace kuzu {
 namespace storage {
-// In this function, we try to remove as many as possible candidates that are not evictable from the
-// eviction queue until we hit a candidate that is evictable.
-// 1) If the candidate page's version has changed, which means the page was pinned and unpinned, we
-// remove the candidate from the queue.
-// 2) If the candidate page's state is UNLOCKED, and its page version hasn't changed, which means
-// the page was optimistically read, we give a second chance to evict the page by marking the page
-// as MARKED, and moving the candidate to the back of the queue.
-// 3) If the candidate page's state is LOCKED, we remove the candidate from the queue.
-void EvictionQueue::removeNonEvictableCandidates() {
-    std::shared_lock sLck{mtx};
-    while (true) {
-        EvictionCandidate evictionCandidate;
-        if (!queue->try_dequeue(evictionCandidate)) {
-            break;
-        }
-        auto pageStateAndVersion = evictionCandidate.pageState->getStateAndVersion();
-        if (evictionCandidate.isEvictable(pageStateAndVersion)) {
-            queue->enqueue(evictionCandidate);
-            break;
-        } else if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
-            // The page was optimistically read, mark it as MARKED, and enqueue to be evicted later.
-            evictionCandidate.pageState->tryMark(pageStateAndVersion);
-            queue->enqueue(evictionCandidate);
-            continue;
-        } else {
-            // Cases to remove the candidate from the queue:
-            // 1) The page is currently LOCKED (it is currently pinned), remove the candidate from
-            // the queue.
-            // 2) The page's version number has changed (it was pinned and unpinned), another
-            // candidate exists for this page in the queue. remove the candidate from the queue.
-            continue;
-        }
-    }
-}
-
-void EvictionQueue::removeCandidatesForFile(kuzu::storage::BMFileHandle& fileHandle) {
-    std::unique_lock xLck{mtx};
-    EvictionCandidate candidate;
-    uint64_t loopedCandidateIdx = 0;
-    auto numCandidatesInQueue = queue->size();
-    while (loopedCandidateIdx < numCandidatesInQueue && queue->try_dequeue(candidate)) {
-        if (candidate.fileHandle != &fileHandle) {
-            queue->enqueue(candidate);
-        }
-        loopedCandidateIdx++;
-    }
-}
-
-BufferManager::BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize)
-    : usedMemory{0}, bufferPoolSize{bufferPoolSize}, numEvictionQueueInsertions{0} {
+BufferManager::BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize, uint64_t maxSpillSize,
+    EvictionPolicyType evictionPolicyType, VMRegionConfig vmRegionConfig)
+    : usedMemory{0}, bufferPoolSize{bufferPoolSize}, evictionPolicyType{evictionPolicyType} {
     verifySizeParams(bufferPoolSize, maxDBSize);
     vmRegions.resize(2);
-    vmRegions[0] = std::make_unique<VMRegion>(PageSizeClass::PAGE_4KB, maxDBSize);
-    vmRegions[1] = std::make_unique<VMRegion>(PageSizeClass::PAGE_256KB, bufferPoolSize);
-    evictionQueue = std::make_unique<EvictionQueue>();
+    vmRegions[0] = std::make_unique<VMRegion>(PageSizeClass::PAGE_4KB, maxDBSize,
+        VMRegionConfig{false /* useHugePages */, vmRegionConfig.numaPolicy});
+    // The MM holds a file handle of PAGE_256KB pages for each size class from PAGE_256KB_SIZE, and
+    // each file handle may leave the frames at the end of its last frame group unused.
+    auto numMMFileHandles = MemoryManager::MAX_BUFFER_SIZE_LOG2 -
+                            BufferPoolConstants::PAGE_256KB_SIZE_LOG2 + 1;
+    vmRegions[1] = std::make_unique<VMRegion>(PageSizeClass::PAGE_256KB,
+        bufferPoolSize + maxSpillSize +
+            numMMFileHandles * BufferPoolConstants::PAGE_256KB_SIZE *
+                StorageConstants::PAGE_GROUP_SIZE,
+        vmRegionConfig);
+    evictionQueue = std::make_unique<EvictionQueue>(
+        EvictionPolicy::createEvictionPolicy(evictionPolicyType, bufferPoolSize));
+    prefetcher = std::make_unique<PagePrefetcher>(this);
 }
 
 void BufferManager::verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize) {
@@ -99,6 +66,17 @@ void BufferManager::verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize
 // (3) If multiple threads are writing to the page, they should coordinate separately because they
 // both get access to the same piece of memory.
 uint8_t* BufferManager::pin(
+    BMFileHandle& fileHandle, page_idx_t pageIdx, PageReadPolicy pageReadPolicy) {
+    MemoryTracker::reservePage(fileHandle.getPageSize());
+    try {
+        return pinWithoutTracking(fileHandle, pageIdx, pageReadPolicy);
+    } catch (...) {
+        MemoryTracker::releasePage(fileHandle.getPageSize());
+        throw;
+    }
+}
+
+uint8_t* BufferManager::pinWithoutTracking(
     BMFileHandle& fileHandle, page_idx_t pageIdx, PageReadPolicy pageReadPolicy) {
     auto pageState = fileHandle.getPageState(pageIdx);
     while (true) {
@@ -110,12 +88,14 @@ uint8_t* BufferManager::pin(
                     pageState->unlock();
                     throw BufferManagerException("Failed to claim a frame.");
                 }
+                fileHandle.numCacheMisses.fetch_add(1, std::memory_order_relaxed);
                 return getFrame(fileHandle, pageIdx);
             }
         } break;
         case PageState::UNLOCKED:
         case PageState::MARKED: {
             if (pageState->tryLock(currStateAndVersion)) {
+                fileHandle.numCacheHits.fetch_add(1, std::memory_order_relaxed);
                 return getFrame(fileHandle, pageIdx);
             }
         } break;
@@ -192,6 +172,8 @@ void BufferManager::optimisticRead(
     // Change the Structured Exception handling just for the scope of this function
     auto translator = ScopedTranslator(handleAccessViolation);
 #endif
+    // A page cached by this read is counted as a miss, but not as a hit.
+    auto cached = false;
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
         switch (PageState::getState(currStateAndVersion)) {
@@ -201,6 +183,9 @@ void BufferManager::optimisticRead(
                 continue;
             }
             if (pageState->getStateAndVersion() == currStateAndVersion) {
+                if (!cached) {
+                    fileHandle.numCacheHits.fetch_add(1, std::memory_order_relaxed);
+                }
                 return;
             }
         } break;
@@ -209,6 +194,9 @@ void BufferManager::optimisticRead(
             if (pageState->tryClearMark(currStateAndVersion)) {
                 if (try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
                         fileHandle.getPageSizeClass())) {
+                    if (!cached) {
+                        fileHandle.numCacheHits.fetch_add(1, std::memory_order_relaxed);
+                    }
                     return;
                 }
             }
@@ -216,6 +204,7 @@ void BufferManager::optimisticRead(
         case PageState::EVICTED: {
             pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
             unpin(fileHandle, pageIdx);
+            cached = true;
         } break;
         default: {
             // When locked, continue the spinning.
@@ -225,12 +214,196 @@ void BufferManager::optimisticRead(
     }
 }
 
+void BufferManager::optimisticReadPages(BMFileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages,
+    const std::function<void(uint8_t*, page_idx_t, page_idx_t)>& func) {
+    KU_ASSERT(numPages > 0 && numPages <= MAX_NUM_PAGES_PER_IO_REQUEST);
+    KU_ASSERT(startPageIdx / StorageConstants::PAGE_GROUP_SIZE ==
+              (startPageIdx + numPages - 1) / StorageConstants::PAGE_GROUP_SIZE);
+#if defined(_WIN32)
+    auto translator = ScopedTranslator(handleAccessViolation);
+#endif
+    std::array<uint64_t, MAX_NUM_PAGES_PER_IO_REQUEST> stateAndVersions;
+    auto hasCachedPages = false;
+    while (true) {
+        auto canRead = true;
+        auto hasEvictedPages = false;
+        for (auto i = 0u; i < numPages && canRead; i++) {
+            auto pageState = fileHandle.getPageState(startPageIdx + i);
+            auto currStateAndVersion = pageState->getStateAndVersion();
+            switch (PageState::getState(currStateAndVersion)) {
+            case PageState::UNLOCKED: {
+                stateAndVersions[i] = currStateAndVersion;
+            } break;
+            case PageState::MARKED: {
+                canRead = pageState->tryClearMark(currStateAndVersion);
+                stateAndVersions[i] =
+                    PageState::updateStateWithSameVersion(currStateAndVersion, PageState::UNLOCKED);
+            } break;
+            case PageState::EVICTED: {
+                hasEvictedPages = true;
+                canRead = false;
+            } break;
+            default: {
+                // When locked, spin until the page is readable.
+                canRead = false;
+            }
+            }
+        }
+        if (hasEvictedPages) {
+            if (hasCachedPages) {
+                // Some pages were evicted again or could not be cached, so the extent doesn't fit
+                // into the free frames. Fall back to reading one page at a time.
+                for (auto i = 0u; i < numPages; i++) {
+                    optimisticRead(fileHandle, startPageIdx + i,
+                        [&](uint8_t* frame) { func(frame, startPageIdx + i, 1); });
+                }
+                return;
+            }
+            prefetchPages(fileHandle, startPageIdx, numPages);
+            hasCachedPages = true;
+            continue;
+        }
+        if (!canRead) {
+            continue;
+        }
+        auto frame = getFrame(fileHandle, startPageIdx);
+        for (auto i = 1u; i < numPages; i++) {
+            // Getting the frame of each page also commits its memory on Windows.
+            [[maybe_unused]] auto pageFrame = getFrame(fileHandle, startPageIdx + i);
+            KU_ASSERT(pageFrame == frame + i * fileHandle.getPageSize());
+        }
+        if (!try_func([&](uint8_t* frame) { func(frame, startPageIdx, numPages); }, frame,
+                vmRegions, fileHandle.getPageSizeClass())) {
+            continue;
+        }
+        auto isValid = true;
+        for (auto i = 0u; i < numPages && isValid; i++) {
+            isValid = fileHandle.getPageState(startPageIdx + i)->getStateAndVersion() ==
+                      stateAndVersions[i];
+        }
+        if (isValid) {
+            fileHandle.numCacheHits.fetch_add(numPages, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
 void BufferManager::unpin(BMFileHandle& fileHandle, page_idx_t pageIdx) {
+    MemoryTracker::releasePage(fileHandle.getPageSize());
+    unpinWithoutTracking(fileHandle, pageIdx);
+}
+
+void BufferManager::unpinWithoutTracking(BMFileHandle& fileHandle, page_idx_t pageIdx) {
     auto pageState = fileHandle.getPageState(pageIdx);
     pageState->unlock();
     addToEvictionQueue(&fileHandle, pageIdx, pageState);
 }
 
+void BufferManager::prefetchPages(
+    BMFileHandle& fileHandle, page_idx_t startPageIdx, page_idx_t numPages) {
+    auto pageRun = PageRun{startPageIdx, numPages};
+    prefetchPageRuns(fileHandle, std::span<const PageRun>{&pageRun, 1});
+}
+
+bool BufferManager::prefetchPageRuns(BMFileHandle& fileHandle, std::span<const PageRun> pageRuns) {
+    if (fileHandle.isNewTmpFile()) {
+        return true;
+    }
+    // Evicted pages are locked and claim their frames. Each run of them is read with one request,
+    // and the requests of all runs are executed as one batch.
+    std::vector<PageRun> runs;
+    auto claimedAllFrames = true;
+    for (auto& pageRun : pageRuns) {
+        auto endPageIdx = std::min<page_idx_t>(pageRun.endPageIdx(), fileHandle.getNumPages());
+        for (auto pageIdx = pageRun.startPageIdx; pageIdx < endPageIdx && claimedAllFrames;
+             pageIdx++) {
+            auto pageState = fileHandle.getPageState(pageIdx);
+            auto currStateAndVersion = pageState->getStateAndVersion();
+            if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+                !pageState->tryLock(currStateAndVersion)) {
+                // The page is cached or being cached by another thread.
+                continue;
+            }
+            if (!claimAFrame(fileHandle, pageIdx, PageReadPolicy::DONT_READ_PAGE)) {
+                pageState->resetToEvicted();
+                claimedAllFrames = false;
+                break;
+            }
+            if (runs.empty() || !runs.back().canAppend(pageIdx, MAX_NUM_PAGES_PER_IO_REQUEST)) {
+                runs.push_back(PageRun{pageIdx, 0});
+            }
+            runs.back().numPages++;
+        }
+    }
+    if (!runs.empty()) {
+        readPagesIntoFrames(fileHandle, runs);
+    }
+    return claimedAllFrames;
+}
+
+std::vector<page_idx_t> BufferManager::getCachedPageIdxes(BMFileHandle& fileHandle) {
+    std::vector<page_idx_t> pageIdxes;
+    for (auto pageIdx = 0u; pageIdx < fileHandle.getNumPages(); pageIdx++) {
+        if (fileHandle.getPageState(pageIdx)->getState() != PageState::EVICTED) {
+            pageIdxes.push_back(pageIdx);
+        }
+    }
+    return pageIdxes;
+}
+
+void BufferManager::prefetchPagesAsync(
+    BMFileHandle& fileHandle, page_idx_t startPageIdx, page_idx_t numPages) {
+    if (fileHandle.isNewTmpFile() || numPages == 0) {
+        return;
+    }
+    prefetcher->schedule(PrefetchRequest{&fileHandle, startPageIdx, numPages});
+}
+
+FileIORequest BufferManager::getIORequestForRun(
+    FileIOType type, BMFileHandle& fileHandle, const PageRun& run) {
+    auto pageSize = fileHandle.getPageSize();
+    auto frame = getFrame(fileHandle, run.startPageIdx);
+    for (auto i = 1u; i < run.numPages; i++) {
+        // Consecutive pages of a page group are mapped to consecutive frames. Getting the frame
+        // of each page also commits its memory on Windows.
+        [[maybe_unused]] auto pageFrame = getFrame(fileHandle, run.startPageIdx + i);
+        KU_ASSERT(pageFrame == frame + i * pageSize);
+    }
+    return FileIORequest{type, fileHandle.getFileInfo(), frame, (uint64_t)run.numPages * pageSize,
+        (uint64_t)run.startPageIdx * pageSize};
+}
+
+void BufferManager::readPagesIntoFrames(
+    BMFileHandle& fileHandle, const std::vector<PageRun>& runs) {
+    std::vector<FileIORequest> requests;
+    requests.reserve(runs.size());
+    for (auto& run : runs) {
+        requests.push_back(getIORequestForRun(FileIOType::READ, fileHandle, run));
+    }
+    try {
+        auto fileInfo = fileHandle.getFileInfo();
+        fileInfo->fileSystem->executeIORequests(requests);
+    } catch (...) {
+        for (auto& run : runs) {
+            for (auto pageIdx = run.startPageIdx; pageIdx < run.endPageIdx(); pageIdx++) {
+                releaseFrameForPage(fileHandle, pageIdx);
+                fileHandle.getPageState(pageIdx)->resetToEvicted();
+                freeUsedMemory(fileHandle.getPageSize());
+            }
+        }
+        return;
+    }
+    uint64_t numPages = 0;
+    for (auto& run : runs) {
+        for (auto pageIdx = run.startPageIdx; pageIdx < run.endPageIdx(); pageIdx++) {
+            unpinWithoutTracking(fileHandle, pageIdx);
+        }
+        numPages += run.numPages;
+    }
+    fileHandle.numPrefetchedPages.fetch_add(numPages, std::memory_order_relaxed);
+}
+
 // This function tries to load the given page into a frame. Due to our design of mmap, each page is
 // uniquely mapped to a frame. Thus, claiming a frame is equivalent to ensuring enough physical
 // memory is available.
@@ -274,6 +447,9 @@ bool BufferManager::claimAFrame(
     }
     // Have enough memory available now, load the page into its corresponding frame.
     cachePageIntoFrame(fileHandle, pageIdx, pageReadPolicy);
+    if (evictionQueue->getPolicy().wasRecentlyEvicted(&fileHandle, pageIdx)) {
+        fileHandle.getPageState(pageIdx)->setReferenced();
+    }
     freeUsedMemory(claimedMemory);
     return true;
 }
@@ -281,13 +457,9 @@ bool BufferManager::claimAFrame(
 void BufferManager::addToEvictionQueue(
     BMFileHandle* fileHandle, page_idx_t pageIdx, PageState* pageState) {
     auto currStateAndVersion = pageState->getStateAndVersion();
-    if (++numEvictionQueueInsertions == BufferPoolConstants::EVICTION_QUEUE_PURGING_INTERVAL) {
-        evictionQueue->removeNonEvictableCandidates();
-        numEvictionQueueInsertions = 0;
-    }
     pageState->tryMark(currStateAndVersion);
-    evictionQueue->enqueue(
-        fileHandle, pageIdx, pageState, PageState::getVersion(currStateAndVersion));
+    evictionQueue->enqueue(EvictionCandidate{
+        fileHandle, pageIdx, pageState, PageState::getVersion(currStateAndVersion)});
 }
 
 uint64_t BufferManager::tryEvictPage(EvictionCandidate& candidate) {
@@ -304,6 +476,8 @@ uint64_t BufferManager::tryEvictPage(EvictionCandidate& candidate) {
     auto numBytesFreed = candidate.fileHandle->getPageSize();
     releaseFrameForPage(*candidate.fileHandle, candidate.pageIdx);
     pageState.resetToEvicted();
+    candidate.fileHandle->numEvictions.fetch_add(1, std::memory_order_relaxed);
+    evictionQueue->getPolicy().notifyEvicted(candidate);
     return numBytesFreed;
 }
 
@@ -326,6 +500,7 @@ void BufferManager::flushIfDirtyWithoutLock(BMFileHandle& fileHandle, page_idx_t
 }
 
 void BufferManager::removeFilePagesFromFrames(BMFileHandle& fileHandle) {
+    prefetcher->removeRequestsForFile(&fileHandle);
     evictionQueue->removeCandidatesForFile(fileHandle);
     for (auto pageIdx = 0u; pageIdx < fileHandle.getNumPages(); ++pageIdx) {
         removePageFromFrame(fileHandle, pageIdx, false /* do not flush */);
@@ -333,8 +508,36 @@ void BufferManager::removeFilePagesFromFrames(BMFileHandle& fileHandle) {
 }
 
 void BufferManager::flushAllDirtyPagesInFrames(BMFileHandle& fileHandle) {
-    for (auto pageIdx = 0u; pageIdx < fileHandle.getNumPages(); ++pageIdx) {
-        removePageFromFrame(fileHandle, pageIdx, true /* flush */);
+    // The pages are flushed one page group at a time. The dirty pages of a group are coalesced
+    // into runs, which are written as one batch.
+    auto numPages = fileHandle.getNumPages();
+    std::vector<PageRun> runs;
+    std::vector<FileIORequest> requests;
+    for (auto groupStartPageIdx = 0u; groupStartPageIdx < numPages;
+         groupStartPageIdx += StorageConstants::PAGE_GROUP_SIZE) {
+        auto groupEndPageIdx =
+            std::min<page_idx_t>(groupStartPageIdx + StorageConstants::PAGE_GROUP_SIZE, numPages);
+        runs.clear();
+        requests.clear();
+        for (auto pageIdx = groupStartPageIdx; pageIdx < groupEndPageIdx; pageIdx++) {
+            auto pageState = fileHandle.getPageState(pageIdx);
+            pageState->spinLock(pageState->getStateAndVersion());
+            if (!pageState->isDirty()) {
+                continue;
+            }
+            if (runs.empty() || !runs.back().canAppend(pageIdx, MAX_NUM_PAGES_PER_IO_REQUEST)) {
+                runs.push_back(PageRun{pageIdx, 0});
+            }
+            runs.back().numPages++;
+        }
+        for (auto& run : runs) {
+            requests.push_back(getIORequestForRun(FileIOType::WRITE, fileHandle, run));
+        }
+        fileHandle.getFileInfo()->fileSystem->executeIORequests(requests);
+        for (auto pageIdx = groupStartPageIdx; pageIdx < groupEndPageIdx; pageIdx++) {
+            releaseFrameForPage(fileHandle, pageIdx);
+            fileHandle.getPageState(pageIdx)->resetToEvicted();
+        }
     }
 }
 
@@ -353,6 +556,41 @@ void BufferManager::removePageFromFrameIfNecessary(BMFileHandle& fileHandle, pag
     removePageFromFrame(fileHandle, pageIdx, false /* do not flush */);
 }
 
+void BufferManager::registerFileHandle(BMFileHandle* fileHandle) {
+    std::unique_lock lck{fileHandlesMtx};
+    fileHandles.insert(fileHandle);
+}
+
+void BufferManager::unregisterFileHandle(BMFileHandle* fileHandle) {
+    std::unique_lock lck{fileHandlesMtx};
+    fileHandles.erase(fileHandle);
+}
+
+BMFileHandle* BufferManager::getFileHandle(const std::string& filePath) {
+    std::unique_lock lck{fileHandlesMtx};
+    for (auto fileHandle : fileHandles) {
+        if (fileHandle->getFileInfo()->path == filePath) {
+            return fileHandle;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<FileCacheStats> BufferManager::getFileCacheStats() {
+    std::vector<FileCacheStats> stats;
+    {
+        std::unique_lock lck{fileHandlesMtx};
+        for (auto fileHandle : fileHandles) {
+            stats.push_back(FileCacheStats{fileHandle->getFileInfo()->path,
+                fileHandle->getPageSize(), fileHandle->getNumPages(),
+                fileHandle->getCacheStats()});
+        }
+    }
+    std::sort(stats.begin(), stats.end(),
+        [](const auto& a, const auto& b) { return a.filePath < b.filePath; });
+    return stats;
+}
+
 // NOTE: We assume the page is not pinned (locked) here.
 void BufferManager::removePageFromFrame(
     BMFileHandle& fileHandle, page_idx_t pageIdx, bool shouldFlush) {
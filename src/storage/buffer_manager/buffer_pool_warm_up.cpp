@@ -0,0 +1,203 @@
+#include "storage/buffer_manager/buffer_pool_warm_up.h"
+
+#include <fcntl.h>
+
+#include <filesystem>
+
+#include "common/assert.h"
+#include "common/file_system/virtual_file_system.h"
+#include "common/serializer/buffered_file.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/storage_info.h"
+#include "storage/storage_utils.h"
+#include "transaction/transaction_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+std::string BufferPoolWarmUpStateUtils::toString(BufferPoolWarmUpState state) {
+    switch (state) {
+    case BufferPoolWarmUpState::NOT_STARTED:
+        return "NOT_STARTED";
+    case BufferPoolWarmUpState::LOADING:
+        return "LOADING";
+    case BufferPoolWarmUpState::DONE:
+        return "DONE";
+    case BufferPoolWarmUpState::STOPPED:
+        return "STOPPED";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+BufferPoolWarmUp::BufferPoolWarmUp(BufferManager& bufferManager, VirtualFileSystem* vfs,
+    std::string databasePath, bool readOnly)
+    : bufferManager{bufferManager}, vfs{vfs}, databasePath{std::move(databasePath)},
+      readOnly{readOnly}, state{BufferPoolWarmUpState::NOT_STARTED}, numPagesToLoad{0},
+      numLoadedPages{0}, stopRequested{false} {}
+
+BufferPoolWarmUp::~BufferPoolWarmUp() {
+    stop();
+}
+
+// Returns the name of the file if it is a database file whose pages are dumped. The WAL is
+// excluded, since its pages are only read during checkpoints and recovery.
+static std::string getDumpedFileName(
+    const FileCacheStats& fileStats, const std::string& databasePath) {
+    if (fileStats.pageSize != BufferPoolConstants::PAGE_4KB_SIZE ||
+        fileStats.filePath.ends_with(StorageConstants::WAL_FILE_SUFFIX)) {
+        return "";
+    }
+    auto relativePath =
+        std::filesystem::path{fileStats.filePath}.lexically_relative(databasePath);
+    if (relativePath.empty() || relativePath.has_parent_path() || relativePath == "..") {
+        return "";
+    }
+    return relativePath.string();
+}
+
+void BufferPoolWarmUp::dumpCachedPages() {
+    std::vector<CachedFilePages> filePages;
+    for (auto& fileStats : bufferManager.getFileCacheStats()) {
+        auto fileName = getDumpedFileName(fileStats, databasePath);
+        auto fileHandle = bufferManager.getFileHandle(fileStats.filePath);
+        if (fileName.empty() || fileHandle == nullptr) {
+            continue;
+        }
+        auto pageIdxes = bufferManager.getCachedPageIdxes(*fileHandle);
+        if (!pageIdxes.empty()) {
+            filePages.push_back(CachedFilePages{std::move(fileName), std::move(pageIdxes)});
+        }
+    }
+    auto dumpPath = StorageUtils::getBufferPoolDumpFilePath(vfs, databasePath);
+    vfs->removeFileIfExists(dumpPath);
+    Serializer serializer(
+        std::make_unique<BufferedFileWriter>(vfs->openFile(dumpPath, O_WRONLY | O_CREAT)));
+    serializer.serializeValue(StorageVersionInfo::getStorageVersion());
+    serializer.serializeValue<uint64_t>(filePages.size());
+    for (auto& cachedFilePages : filePages) {
+        serializer.serializeValue(cachedFilePages.fileName);
+        serializer.serializeVector(cachedFilePages.pageIdxes);
+    }
+}
+
+std::vector<CachedFilePages> BufferPoolWarmUp::readDump() {
+    std::vector<CachedFilePages> filePages;
+    auto dumpPath = StorageUtils::getBufferPoolDumpFilePath(vfs, databasePath);
+    if (!vfs->fileOrPathExists(dumpPath)) {
+        return filePages;
+    }
+    try {
+        Deserializer deserializer(
+            std::make_unique<BufferedFileReader>(vfs->openFile(dumpPath, O_RDONLY)));
+        storage_version_t storageVersion;
+        deserializer.deserializeValue(storageVersion);
+        if (storageVersion == StorageVersionInfo::getStorageVersion()) {
+            uint64_t numFiles;
+            deserializer.deserializeValue(numFiles);
+            filePages.resize(numFiles);
+            for (auto& cachedFilePages : filePages) {
+                deserializer.deserializeValue(cachedFilePages.fileName);
+                deserializer.deserializeVector(cachedFilePages.pageIdxes);
+            }
+        }
+    } catch (std::exception&) { // LCOV_EXCL_START
+        // A dump which cannot be read is ignored, since it only affects performance.
+        filePages.clear();
+    } // LCOV_EXCL_STOP
+    // The dump is removed, so that it is not loaded again after a crash, when the cached pages
+    // have not been dumped.
+    if (!readOnly) {
+        vfs->removeFileIfExists(dumpPath);
+    }
+    return filePages;
+}
+
+void BufferPoolWarmUp::start(TransactionManager* transactionManager) {
+    KU_ASSERT(!thread.joinable());
+    auto filePages = readDump();
+    if (filePages.empty()) {
+        state.store(BufferPoolWarmUpState::DONE);
+        return;
+    }
+    uint64_t numPages = 0;
+    for (auto& cachedFilePages : filePages) {
+        numPages += cachedFilePages.pageIdxes.size();
+    }
+    numPagesToLoad.store(numPages);
+    state.store(BufferPoolWarmUpState::LOADING);
+    thread = std::thread([this, transactionManager, filePages = std::move(filePages)]() mutable {
+        loadPages(transactionManager, std::move(filePages));
+    });
+}
+
+void BufferPoolWarmUp::stop() {
+    stopRequested.store(true);
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+BufferPoolWarmUpProgress BufferPoolWarmUp::getProgress() const {
+    return BufferPoolWarmUpProgress{state.load(), numPagesToLoad.load(), numLoadedPages.load()};
+}
+
+void BufferPoolWarmUp::loadPages(
+    TransactionManager* transactionManager, std::vector<CachedFilePages> filePages) {
+    try {
+        for (auto& cachedFilePages : filePages) {
+            auto filePath = vfs->joinPath(databasePath, cachedFilePages.fileName);
+            auto& pageIdxes = cachedFilePages.pageIdxes;
+            for (auto i = 0u; i < pageIdxes.size(); i += NUM_PAGES_PER_BATCH) {
+                if (stopRequested.load()) {
+                    state.store(BufferPoolWarmUpState::STOPPED);
+                    return;
+                }
+                auto numPages = std::min<uint64_t>(NUM_PAGES_PER_BATCH, pageIdxes.size() - i);
+                if (!loadBatch(transactionManager, filePath, pageIdxes.data() + i, numPages)) {
+                    state.store(BufferPoolWarmUpState::DONE);
+                    return;
+                }
+            }
+        }
+    } catch (std::exception&) { // LCOV_EXCL_START
+        state.store(BufferPoolWarmUpState::STOPPED);
+        return;
+    } // LCOV_EXCL_STOP
+    state.store(BufferPoolWarmUpState::DONE);
+}
+
+bool BufferPoolWarmUp::loadBatch(TransactionManager* transactionManager,
+    const std::string& filePath, const page_idx_t* pageIdxes, uint64_t numPages) {
+    if (bufferManager.getUsedMemory() + numPages * BufferPoolConstants::PAGE_4KB_SIZE >
+        bufferManager.getBufferPoolSize()) {
+        return false;
+    }
+    auto transaction = transactionManager->beginReadOnlyTransaction();
+    // Files are only removed by checkpoints, so the file handle stays valid until the transaction
+    // is committed.
+    auto fileHandle = bufferManager.getFileHandle(filePath);
+    auto bufferPoolIsFull = false;
+    if (fileHandle != nullptr) {
+        std::vector<PageRun> runs;
+        for (auto i = 0u; i < numPages; i++) {
+            if (runs.empty() || !runs.back().canAppend(
+                                    pageIdxes[i], BufferManager::MAX_NUM_PAGES_PER_IO_REQUEST)) {
+                runs.push_back(PageRun{pageIdxes[i], 0});
+            }
+            runs.back().numPages++;
+        }
+        bufferPoolIsFull = !bufferManager.prefetchPageRuns(*fileHandle, runs);
+    }
+    transactionManager->commit(transaction.get());
+    numLoadedPages.fetch_add(numPages);
+    return !bufferPoolIsFull;
+}
+
+} // namespace storage
+} // namespace kuzu
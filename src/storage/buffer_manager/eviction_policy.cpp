@@ -0,0 +1,219 @@
+#include "storage/buffer_manager/eviction_policy.h"
+
+#include "common/exception/buffer_manager.h"
+#include "common/string_utils.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+EvictionPolicyType EvictionPolicyTypeUtils::fromString(const std::string& str) {
+    auto upperStr = StringUtils::getUpper(str);
+    if (upperStr == "FIFO") {
+        return EvictionPolicyType::FIFO;
+    } else if (upperStr == "2Q") {
+        return EvictionPolicyType::TWO_QUEUE;
+    }
+    throw BufferManagerException(
+        "Unknown eviction policy " + str + ". Supported policies are 2Q and FIFO.");
+}
+
+std::string EvictionPolicyTypeUtils::toString(EvictionPolicyType type) {
+    switch (type) {
+    case EvictionPolicyType::FIFO:
+        return "FIFO";
+    case EvictionPolicyType::TWO_QUEUE:
+        return "2Q";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+std::unique_ptr<EvictionPolicy> EvictionPolicy::createEvictionPolicy(
+    EvictionPolicyType type, uint64_t bufferPoolSize) {
+    switch (type) {
+    case EvictionPolicyType::FIFO:
+        return std::make_unique<FIFOEvictionPolicy>();
+    case EvictionPolicyType::TWO_QUEUE:
+        return std::make_unique<TwoQueueEvictionPolicy>(bufferPoolSize);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+void FIFOEvictionPolicy::enqueue(const EvictionCandidate& candidate) {
+    std::unique_lock lck{mtx};
+    queue.push_back(candidate);
+}
+
+void FIFOEvictionPolicy::enqueueBatch(
+    const EvictionCandidate* candidates, uint64_t numCandidates) {
+    std::unique_lock lck{mtx};
+    queue.insert(queue.end(), candidates, candidates + numCandidates);
+}
+
+bool FIFOEvictionPolicy::dequeue(EvictionCandidate& candidate) {
+    std::unique_lock lck{mtx};
+    if (queue.empty()) {
+        return false;
+    }
+    candidate = queue.front();
+    queue.pop_front();
+    return true;
+}
+
+// In this function, we try to remove as many as possible candidates that are not evictable from the
+// eviction queue until we hit a candidate that is evictable.
+// 1) If the candidate page's version has changed, which means the page was pinned and unpinned, we
+// remove the candidate from the queue.
+// 2) If the candidate page's state is UNLOCKED, and its page version hasn't changed, which means
+// the page was optimistically read, we give a second chance to evict the page by marking the page
+// as MARKED, and moving the candidate to the back of the queue.
+// 3) If the candidate page's state is LOCKED, we remove the candidate from the queue.
+void FIFOEvictionPolicy::removeNonEvictableCandidates() {
+    std::unique_lock lck{mtx};
+    while (!queue.empty()) {
+        auto evictionCandidate = queue.front();
+        auto pageStateAndVersion = evictionCandidate.pageState->getStateAndVersion();
+        if (evictionCandidate.isEvictable(pageStateAndVersion)) {
+            break;
+        }
+        queue.pop_front();
+        if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
+            // The page was optimistically read, mark it as MARKED, and enqueue to be evicted later.
+            evictionCandidate.pageState->tryMark(pageStateAndVersion);
+            queue.push_back(evictionCandidate);
+        }
+        // Otherwise, the candidate is removed from the queue:
+        // 1) The page is currently LOCKED (it is currently pinned), remove the candidate from
+        // the queue.
+        // 2) The page's version number has changed (it was pinned and unpinned), another
+        // candidate exists for this page in the queue. remove the candidate from the queue.
+    }
+}
+
+void FIFOEvictionPolicy::removeCandidatesForFile(BMFileHandle& fileHandle) {
+    std::unique_lock lck{mtx};
+    std::erase_if(queue,
+        [&](const EvictionCandidate& candidate) { return candidate.fileHandle == &fileHandle; });
+}
+
+TwoQueueEvictionPolicy::TwoQueueEvictionPolicy(uint64_t bufferPoolSize)
+    : probationQueueSize{0}, protectedQueueSize{0} {
+    probationQueueCapacity = bufferPoolSize * PROBATION_QUEUE_RATIO;
+    maxNumGhostPages = std::min<uint64_t>(
+        bufferPoolSize / BufferPoolConstants::PAGE_4KB_SIZE * GHOST_QUEUE_RATIO,
+        MAX_NUM_GHOST_PAGES);
+}
+
+void TwoQueueEvictionPolicy::enqueue(const EvictionCandidate& candidate) {
+    std::unique_lock lck{mtx};
+    enqueueNoLock(candidate);
+}
+
+void TwoQueueEvictionPolicy::enqueueBatch(
+    const EvictionCandidate* candidates, uint64_t numCandidates) {
+    std::unique_lock lck{mtx};
+    for (auto i = 0u; i < numCandidates; i++) {
+        enqueueNoLock(candidates[i]);
+    }
+}
+
+void TwoQueueEvictionPolicy::enqueueNoLock(const EvictionCandidate& candidate) {
+    if (candidate.isReferenced()) {
+        protectedQueue.push_back(candidate);
+        protectedQueueSize += candidate.fileHandle->getPageSize();
+    } else {
+        probationQueue.push_back(candidate);
+        probationQueueSize += candidate.fileHandle->getPageSize();
+    }
+}
+
+bool TwoQueueEvictionPolicy::dequeue(EvictionCandidate& candidate) {
+    std::unique_lock lck{mtx};
+    auto evictFromProbation =
+        !probationQueue.empty() &&
+        (probationQueueSize > probationQueueCapacity || protectedQueue.empty());
+    if (evictFromProbation) {
+        candidate = probationQueue.front();
+        probationQueue.pop_front();
+        probationQueueSize -= candidate.fileHandle->getPageSize();
+        return true;
+    }
+    if (!protectedQueue.empty()) {
+        candidate = protectedQueue.front();
+        protectedQueue.pop_front();
+        protectedQueueSize -= candidate.fileHandle->getPageSize();
+        return true;
+    }
+    return false;
+}
+
+void TwoQueueEvictionPolicy::notifyEvicted(const EvictionCandidate& candidate) {
+    if (candidate.isReferenced() || maxNumGhostPages == 0) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    auto key = getGhostKey(candidate.fileHandle, candidate.pageIdx);
+    ghostQueue.push_back(key);
+    ghostPages[key]++;
+    if (ghostQueue.size() > maxNumGhostPages) {
+        auto oldestKey = ghostQueue.front();
+        ghostQueue.pop_front();
+        if (--ghostPages[oldestKey] == 0) {
+            ghostPages.erase(oldestKey);
+        }
+    }
+}
+
+bool TwoQueueEvictionPolicy::wasRecentlyEvicted(BMFileHandle* fileHandle, page_idx_t pageIdx) {
+    std::unique_lock lck{mtx};
+    return ghostPages.contains(getGhostKey(fileHandle, pageIdx));
+}
+
+// See FIFOEvictionPolicy::removeNonEvictableCandidates(). Candidates given a second chance keep
+// their queue.
+void TwoQueueEvictionPolicy::removeNonEvictableCandidatesNoLock(
+    std::deque<EvictionCandidate>& queue, uint64_t& queueSize) {
+    while (!queue.empty()) {
+        auto candidate = queue.front();
+        auto pageStateAndVersion = candidate.pageState->getStateAndVersion();
+        if (candidate.isEvictable(pageStateAndVersion)) {
+            break;
+        }
+        queue.pop_front();
+        if (candidate.isSecondChanceEvictable(pageStateAndVersion)) {
+            candidate.pageState->tryMark(pageStateAndVersion);
+            queue.push_back(candidate);
+        } else {
+            queueSize -= candidate.fileHandle->getPageSize();
+        }
+    }
+}
+
+void TwoQueueEvictionPolicy::removeNonEvictableCandidates() {
+    std::unique_lock lck{mtx};
+    removeNonEvictableCandidatesNoLock(probationQueue, probationQueueSize);
+    removeNonEvictableCandidatesNoLock(protectedQueue, protectedQueueSize);
+}
+
+void TwoQueueEvictionPolicy::removeCandidatesForFile(BMFileHandle& fileHandle) {
+    std::unique_lock lck{mtx};
+    auto removeFromQueue = [&](std::deque<EvictionCandidate>& queue, uint64_t& queueSize) {
+        std::erase_if(queue, [&](const EvictionCandidate& candidate) {
+            if (candidate.fileHandle != &fileHandle) {
+                return false;
+            }
+            queueSize -= candidate.fileHandle->getPageSize();
+            return true;
+        });
+    };
+    removeFromQueue(probationQueue, probationQueueSize);
+    removeFromQueue(protectedQueue, protectedQueueSize);
+    // The ghost queue is left as is. A new file handle allocated at the same address may have
+    // some of its pages treated as referenced, which only affects their eviction order.
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,129 @@
+#include "storage/buffer_manager/eviction_queue.h"
+
+#include <mutex>
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+static_assert((EvictionQueue::SHARD_CAPACITY & (EvictionQueue::SHARD_CAPACITY - 1)) == 0);
+
+static uint64_t getThreadShardIdx() {
+    static std::atomic<uint64_t> nextShardIdx{0};
+    static thread_local uint64_t shardIdx =
+        nextShardIdx.fetch_add(1, std::memory_order_relaxed) % EvictionQueue::NUM_SHARDS;
+    return shardIdx;
+}
+
+EvictionQueue::Shard::Shard() : enqueuePos{0}, dequeuePos{0} {
+    for (auto i = 0u; i < SHARD_CAPACITY; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool EvictionQueue::Shard::tryPush(const EvictionCandidate& candidate) {
+    auto pos = enqueuePos.load(std::memory_order_relaxed);
+    while (true) {
+        auto& slot = slots[pos & (SHARD_CAPACITY - 1)];
+        auto diff = (int64_t)slot.sequence.load(std::memory_order_acquire) - (int64_t)pos;
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.candidate = candidate;
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // The slot has not been read since the last round, so the shard is full.
+            return false;
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool EvictionQueue::Shard::tryPop(EvictionCandidate& candidate) {
+    auto pos = dequeuePos.load(std::memory_order_relaxed);
+    while (true) {
+        auto& slot = slots[pos & (SHARD_CAPACITY - 1)];
+        auto diff = (int64_t)slot.sequence.load(std::memory_order_acquire) - (int64_t)(pos + 1);
+        if (diff == 0) {
+            if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                candidate = slot.candidate;
+                slot.sequence.store(pos + SHARD_CAPACITY, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // The slot has not been written yet, so the shard is empty.
+            return false;
+        } else {
+            pos = dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+EvictionQueue::EvictionQueue(std::unique_ptr<EvictionPolicy> policy)
+    : policy{std::move(policy)}, shards{std::make_unique<Shard[]>(NUM_SHARDS)},
+      numInsertionsSincePurge{0} {}
+
+void EvictionQueue::enqueue(const EvictionCandidate& candidate) {
+    auto& shard = shards[getThreadShardIdx()];
+    while (!shard.tryPush(candidate)) {
+        std::shared_lock sLck{mtx};
+        flushShardNoLock(shard);
+    }
+}
+
+bool EvictionQueue::dequeue(EvictionCandidate& candidate) {
+    flush();
+    return policy->dequeue(candidate);
+}
+
+void EvictionQueue::flush() {
+    for (auto i = 0u; i < NUM_SHARDS; i++) {
+        if (!shards[i].isEmpty()) {
+            std::shared_lock sLck{mtx};
+            flushShardNoLock(shards[i]);
+        }
+    }
+}
+
+void EvictionQueue::flushShardNoLock(Shard& shard) {
+    std::array<EvictionCandidate, SHARD_CAPACITY> candidates;
+    uint64_t numCandidates = 0;
+    while (numCandidates < SHARD_CAPACITY && shard.tryPop(candidates[numCandidates])) {
+        numCandidates++;
+    }
+    if (numCandidates == 0) {
+        return;
+    }
+    policy->enqueueBatch(candidates.data(), numCandidates);
+    auto numInsertions =
+        numInsertionsSincePurge.fetch_add(numCandidates, std::memory_order_relaxed) +
+        numCandidates;
+    if (numInsertions >= BufferPoolConstants::EVICTION_QUEUE_PURGING_INTERVAL &&
+        numInsertionsSincePurge.exchange(0, std::memory_order_relaxed) > 0) {
+        policy->removeNonEvictableCandidates();
+    }
+}
+
+void EvictionQueue::removeCandidatesForFile(BMFileHandle& fileHandle) {
+    std::unique_lock xLck{mtx};
+    for (auto i = 0u; i < NUM_SHARDS; i++) {
+        flushShardNoLock(shards[i]);
+    }
+    policy->removeCandidatesForFile(fileHandle);
+}
+
+void EvictionQueue::reset(std::unique_ptr<EvictionPolicy> newPolicy) {
+    std::unique_lock xLck{mtx};
+    EvictionCandidate candidate;
+    for (auto i = 0u; i < NUM_SHARDS; i++) {
+        while (shards[i].tryPop(candidate)) {}
+    }
+    policy = std::move(newPolicy);
+    numInsertionsSincePurge.store(0, std::memory_order_relaxed);
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -1,7 +1,18 @@
 #include "storage/buffer_manager/memory_manager.h"
 
+#include <atomic>
+#include <bit>
 #include <cstring>
+#include <unordered_map>
 
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "common/exception/buffer_manager.h"
+#include "common/file_system/virtual_file_system.h"
 #include "storage/buffer_manager/buffer_manager.h"
 
 using namespace kuzu::common;
@@ -9,44 +20,284 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
-MemoryBuffer::MemoryBuffer(MemoryAllocator* allocator, page_idx_t pageIdx, uint8_t* buffer)
-    : buffer{buffer}, pageIdx{pageIdx}, allocator{allocator} {}
+// Free buffers of an allocator cached by a thread.
+struct LocalFreeList {
+    std::weak_ptr<SharedFreeList> sharedFreeList;
+    std::vector<page_idx_t> pages;
+};
+
+struct LocalFreeListCache {
+    ~LocalFreeListCache() {
+        // Buffers cached by an exiting thread are handed back to the allocators still alive.
+        for (auto& [_, localFreeList] : freeLists) {
+            if (auto sharedFreeList = localFreeList.sharedFreeList.lock()) {
+                std::unique_lock<std::mutex> lck{sharedFreeList->mtx};
+                sharedFreeList->pages.insert(sharedFreeList->pages.end(),
+                    localFreeList.pages.begin(), localFreeList.pages.end());
+            }
+        }
+    }
+
+    LocalFreeList& getLocalFreeList(
+        uint64_t allocatorID, const std::shared_ptr<SharedFreeList>& sharedFreeList) {
+        auto it = freeLists.find(allocatorID);
+        if (it != freeLists.end()) {
+            return it->second;
+        }
+        // Drop the buffers cached for allocators that have been destroyed.
+        std::erase_if(freeLists,
+            [](const auto& entry) { return entry.second.sharedFreeList.expired(); });
+        auto& localFreeList = freeLists[allocatorID];
+        localFreeList.sharedFreeList = sharedFreeList;
+        return localFreeList;
+    }
+
+    std::unordered_map<uint64_t, LocalFreeList> freeLists;
+};
+
+static thread_local LocalFreeListCache localFreeListCache;
+static std::atomic<uint64_t> nextAllocatorID{0};
+
+// Each allocator spilling to disk gets its own file. The process id tells apart the databases of
+// different processes and the allocator id those within a process.
+static std::string getSpillFileName(uint64_t allocatorID) {
+#if defined(_WIN32)
+    auto pid = _getpid();
+#else
+    auto pid = getpid();
+#endif
+    return std::string(StorageConstants::SPILL_FILE_PREFIX) + "-" + std::to_string(pid) + "-" +
+           std::to_string(allocatorID) + StorageConstants::SPILL_FILE_SUFFIX;
+}
+
+MemoryBuffer::MemoryBuffer(MemoryAllocator* allocator, page_idx_t pageIdx, uint8_t* buffer,
+    std::shared_ptr<MemoryTracker> memoryTracker)
+    : buffer{buffer}, pageIdx{pageIdx}, allocator{allocator},
+      memoryTracker{std::move(memoryTracker)}, pinned{true} {}
 
 MemoryBuffer::~MemoryBuffer() {
     if (buffer != nullptr) {
-        allocator->freeBlock(pageIdx);
+        allocator->freeBlock(pageIdx, pinned);
+        if (pinned && memoryTracker != nullptr) {
+            memoryTracker->release(allocator->getBufferSize());
+        }
+    }
+}
+
+void MemoryBuffer::pin() {
+    if (!pinned) {
+        if (memoryTracker != nullptr) {
+            memoryTracker->reserve(allocator->getBufferSize());
+        }
+        try {
+            allocator->pinBlock(pageIdx, true /* readPages */);
+        } catch (...) {
+            if (memoryTracker != nullptr) {
+                memoryTracker->release(allocator->getBufferSize());
+            }
+            throw;
+        }
+        pinned = true;
     }
 }
 
-MemoryAllocator::MemoryAllocator(BufferManager* bm, VirtualFileSystem* vfs) : bm{bm} {
-    pageSize = BufferPoolConstants::PAGE_256KB_SIZE;
-    fh = bm->getBMFileHandle("mm-256KB", FileHandle::O_IN_MEM_TEMP_FILE,
-        BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, vfs, PAGE_256KB);
+void MemoryBuffer::unpin() {
+    if (pinned) {
+        pinned = !allocator->tryUnpinBlock(pageIdx);
+        if (!pinned && memoryTracker != nullptr) {
+            memoryTracker->release(allocator->getBufferSize());
+        }
+    }
 }
 
-MemoryAllocator::~MemoryAllocator() = default;
+MemoryAllocator::MemoryAllocator(BufferManager* bm, VirtualFileSystem* vfs, uint64_t bufferSize,
+    const std::string& spillDirectory, uint64_t maxSpillSize)
+    : id{nextAllocatorID.fetch_add(1)}, bm{bm}, vfs{vfs}, bufferSize{bufferSize},
+      maxSpillSize{maxSpillSize}, sharedFreeList{std::make_shared<SharedFreeList>()},
+      numBuffersInUse{0}, numAllocations{0}, numSharedFreeListAccesses{0} {
+    KU_ASSERT(std::has_single_bit(bufferSize));
+    auto pageSizeClass =
+        bufferSize < BufferPoolConstants::PAGE_256KB_SIZE ? PAGE_4KB : PAGE_256KB;
+    pageSize = pageSizeClass == PAGE_4KB ? BufferPoolConstants::PAGE_4KB_SIZE :
+                                           BufferPoolConstants::PAGE_256KB_SIZE;
+    numPagesPerBuffer = bufferSize / pageSize;
+    KU_ASSERT(StorageConstants::PAGE_GROUP_SIZE % numPagesPerBuffer == 0);
+    if (spillDirectory.empty() || maxSpillSize < bufferSize) {
+        auto flags = pageSizeClass == PAGE_4KB ? FileHandle::O_IN_MEM_TEMP_FILE_4KB_PAGED :
+                                                 FileHandle::O_IN_MEM_TEMP_FILE;
+        fh = bm->getBMFileHandle("mm-" + std::to_string(bufferSize), flags,
+            BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, vfs, pageSizeClass);
+        return;
+    }
+    KU_ASSERT(pageSizeClass == PAGE_256KB);
+    if (!vfs->fileOrPathExists(spillDirectory)) {
+        vfs->createDir(spillDirectory);
+    }
+    spillFilePath = vfs->joinPath(spillDirectory, getSpillFileName(id));
+    // A file left over by a crashed process with the same pid is never read back.
+    vfs->removeFileIfExists(spillFilePath);
+    fh = bm->getBMFileHandle(spillFilePath, FileHandle::O_SPILL_FILE,
+        BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, vfs, pageSizeClass);
+}
+
+MemoryAllocator::~MemoryAllocator() {
+    if (!spillFilePath.empty()) {
+        fh.reset();
+        vfs->removeFileIfExists(spillFilePath);
+    }
+}
 
 std::unique_ptr<MemoryBuffer> MemoryAllocator::allocateBuffer(bool initializeToZero) {
-    std::unique_lock<std::mutex> lock(allocatorLock);
-    page_idx_t pageIdx;
-    if (freePages.empty()) {
-        pageIdx = fh->addNewPage();
-    } else {
-        pageIdx = freePages.top();
-        freePages.pop();
-    }
-    auto buffer = bm->pin(*fh, pageIdx, BufferManager::PageReadPolicy::DONT_READ_PAGE);
-    auto memoryBuffer = std::make_unique<MemoryBuffer>(this, pageIdx, buffer);
+    numAllocations.fetch_add(1, std::memory_order_relaxed);
+    auto memoryTracker = MemoryTracker::getThreadTracker();
+    if (memoryTracker != nullptr) {
+        memoryTracker->reserve(bufferSize);
+    }
+    auto pageIdx = getFreePageIdx();
+    uint8_t* buffer;
+    try {
+        buffer = pinBlock(pageIdx, false /* readPages */);
+    } catch (...) {
+        localFreeListCache.getLocalFreeList(id, sharedFreeList).pages.push_back(pageIdx);
+        if (memoryTracker != nullptr) {
+            memoryTracker->release(bufferSize);
+        }
+        throw;
+    }
+    // A reused page may still be cached with the content of an unpinned buffer.
+    for (auto i = 0u; i < numPagesPerBuffer; i++) {
+        fh->clearLockedPageDirty(pageIdx + i);
+    }
+    numBuffersInUse.fetch_add(1, std::memory_order_relaxed);
+    auto memoryBuffer = std::make_unique<MemoryBuffer>(this, pageIdx, buffer,
+        memoryTracker != nullptr ? memoryTracker->shared_from_this() : nullptr);
     if (initializeToZero) {
-        memset(memoryBuffer->buffer, 0, pageSize);
+        memset(memoryBuffer->buffer, 0, bufferSize);
     }
     return memoryBuffer;
 }
 
-void MemoryAllocator::freeBlock(page_idx_t pageIdx) {
-    std::unique_lock<std::mutex> lock(allocatorLock);
-    bm->unpin(*fh, pageIdx);
-    freePages.push(pageIdx);
+MemoryAllocatorStats MemoryAllocator::getStats() const {
+    return MemoryAllocatorStats{bufferSize, fh->getNumPages() / numPagesPerBuffer,
+        numBuffersInUse.load(), numAllocations.load(), numSharedFreeListAccesses.load()};
+}
+
+page_idx_t MemoryAllocator::getFreePageIdx() {
+    auto& localFreeList = localFreeListCache.getLocalFreeList(id, sharedFreeList);
+    if (localFreeList.pages.empty()) {
+        numSharedFreeListAccesses.fetch_add(1, std::memory_order_relaxed);
+        std::unique_lock<std::mutex> lck{sharedFreeList->mtx};
+        auto& sharedPages = sharedFreeList->pages;
+        auto numPagesToTake = std::min<uint64_t>(sharedPages.size(), FREE_LIST_BATCH_SIZE);
+        localFreeList.pages.insert(
+            localFreeList.pages.end(), sharedPages.end() - numPagesToTake, sharedPages.end());
+        sharedPages.resize(sharedPages.size() - numPagesToTake);
+    }
+    if (localFreeList.pages.empty()) {
+        // Pages are only ever added numPagesPerBuffer at a time, so the new buffer is aligned.
+        return fh->addNewPages(numPagesPerBuffer);
+    }
+    auto pageIdx = localFreeList.pages.back();
+    localFreeList.pages.pop_back();
+    return pageIdx;
+}
+
+void MemoryAllocator::freeBlock(page_idx_t pageIdx, bool isPinned) {
+    if (isPinned) {
+        // The content of a freed buffer doesn't need to be spilled.
+        for (auto i = 0u; i < numPagesPerBuffer; i++) {
+            fh->clearLockedPageDirty(pageIdx + i);
+        }
+        unpinBlock(pageIdx, false /* spill */);
+    }
+    numBuffersInUse.fetch_sub(1, std::memory_order_relaxed);
+    auto& localFreeList = localFreeListCache.getLocalFreeList(id, sharedFreeList);
+    localFreeList.pages.push_back(pageIdx);
+    if (localFreeList.pages.size() > 2 * FREE_LIST_BATCH_SIZE) {
+        numSharedFreeListAccesses.fetch_add(1, std::memory_order_relaxed);
+        std::unique_lock<std::mutex> lck{sharedFreeList->mtx};
+        auto batchStart = localFreeList.pages.end() - FREE_LIST_BATCH_SIZE;
+        sharedFreeList->pages.insert(
+            sharedFreeList->pages.end(), batchStart, localFreeList.pages.end());
+        localFreeList.pages.erase(batchStart, localFreeList.pages.end());
+    }
+}
+
+uint8_t* MemoryAllocator::pinBlock(page_idx_t pageIdx, bool readPages) {
+    // Buffers are accounted as a whole by their MemoryBuffer, not as pages pinned in the BM.
+    MemoryTrackerScope noTracking{nullptr};
+    auto policy = readPages ? BufferManager::PageReadPolicy::READ_PAGE :
+                              BufferManager::PageReadPolicy::DONT_READ_PAGE;
+    uint8_t* buffer = nullptr;
+    for (auto i = 0u; i < numPagesPerBuffer; i++) {
+        try {
+            auto frame = bm->pin(*fh, pageIdx + i, policy);
+            if (i == 0) {
+                buffer = frame;
+            }
+        } catch (...) {
+            for (auto j = 0u; j < i; j++) {
+                bm->unpin(*fh, pageIdx + j);
+            }
+            throw;
+        }
+    }
+    return buffer;
+}
+
+void MemoryAllocator::unpinBlock(page_idx_t pageIdx, bool spill) {
+    MemoryTrackerScope noTracking{nullptr};
+    for (auto i = 0u; i < numPagesPerBuffer; i++) {
+        if (spill) {
+            // Marking the page as dirty makes the BM write it to the spill file if it gets
+            // evicted.
+            fh->setLockedPageDirty(pageIdx + i);
+        }
+        bm->unpin(*fh, pageIdx + i);
+    }
+}
+
+bool MemoryAllocator::tryUnpinBlock(page_idx_t pageIdx) {
+    if (!canSpill(pageIdx)) {
+        return false;
+    }
+    unpinBlock(pageIdx, true /* spill */);
+    return true;
+}
+
+MemoryManager::MemoryManager(BufferManager* bm, VirtualFileSystem* vfs,
+    const std::string& spillDirectory, uint64_t maxSpillSize)
+    : bm{bm} {
+    for (auto log2 = MIN_BUFFER_SIZE_LOG2; log2 <= MAX_BUFFER_SIZE_LOG2; log2++) {
+        auto bufferSize = (uint64_t)1 << log2;
+        // Only the buffers of factorized tables are spilled.
+        auto isSpillable = bufferSize == BufferPoolConstants::PAGE_256KB_SIZE;
+        allocators.push_back(std::make_unique<MemoryAllocator>(bm, vfs, bufferSize,
+            isSpillable ? spillDirectory : "", isSpillable ? maxSpillSize : 0));
+    }
+}
+
+std::unique_ptr<MemoryBuffer> MemoryManager::allocateBuffer(bool initializeToZero, uint64_t size) {
+    if (size > MAX_BUFFER_SIZE) {
+        throw BufferManagerException("Cannot allocate a memory buffer of " +
+                                     std::to_string(size) + " bytes, which is larger than " +
+                                     std::to_string(MAX_BUFFER_SIZE) + " bytes.");
+    }
+    return allocators[getSizeClassIdx(size)]->allocateBuffer(initializeToZero);
+}
+
+std::vector<MemoryAllocatorStats> MemoryManager::getStats() const {
+    std::vector<MemoryAllocatorStats> stats;
+    for (auto& allocator : allocators) {
+        stats.push_back(allocator->getStats());
+    }
+    return stats;
+}
+
+uint64_t MemoryManager::getSizeClassIdx(uint64_t size) {
+    KU_ASSERT(size <= MAX_BUFFER_SIZE);
+    auto log2 = std::bit_width(std::max<uint64_t>(size, MIN_BUFFER_SIZE) - 1);
+    return log2 - MIN_BUFFER_SIZE_LOG2;
 }
 
 } // namespace storage
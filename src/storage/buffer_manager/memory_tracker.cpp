@@ -0,0 +1,72 @@
+#include "storage/buffer_manager/memory_tracker.h"
+
+#include <algorithm>
+
+#include "common/assert.h"
+#include "common/exception/buffer_manager.h"
+#include "common/string_format.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+static thread_local MemoryTracker* threadTracker = nullptr;
+// The memory of the BM pages reserved in the current scope of the thread and not yet released.
+static thread_local uint64_t threadPageMemory = 0;
+
+void MemoryTracker::reserve(uint64_t size) {
+    auto newMemory = currentMemory.fetch_add(size, std::memory_order_relaxed) + size;
+    if (newMemory > limit) {
+        currentMemory.fetch_sub(size, std::memory_order_relaxed);
+        throw BufferManagerException(
+            stringFormat("The query exceeded its memory limit of {} bytes while reserving {} "
+                         "bytes. Increase the limit with CALL query_memory_limit=<bytes>.",
+                limit, size));
+    }
+    auto currPeakMemory = peakMemory.load(std::memory_order_relaxed);
+    while (newMemory > currPeakMemory &&
+           !peakMemory.compare_exchange_weak(currPeakMemory, newMemory)) {}
+}
+
+void MemoryTracker::release(uint64_t size) {
+    [[maybe_unused]] auto prevMemory = currentMemory.fetch_sub(size, std::memory_order_relaxed);
+    KU_ASSERT(prevMemory >= size);
+}
+
+MemoryTracker* MemoryTracker::getThreadTracker() {
+    return threadTracker;
+}
+
+void MemoryTracker::reservePage(uint64_t size) {
+    if (threadTracker == nullptr) {
+        return;
+    }
+    threadTracker->reserve(size);
+    threadPageMemory += size;
+}
+
+void MemoryTracker::releasePage(uint64_t size) {
+    // A page pinned in another scope was not reserved in this one.
+    size = std::min(size, threadPageMemory);
+    if (threadTracker == nullptr || size == 0) {
+        return;
+    }
+    threadTracker->release(size);
+    threadPageMemory -= size;
+}
+
+MemoryTrackerScope::MemoryTrackerScope(MemoryTracker* tracker)
+    : prevTracker{threadTracker}, prevPageMemory{threadPageMemory} {
+    threadTracker = tracker;
+    threadPageMemory = 0;
+}
+
+MemoryTrackerScope::~MemoryTrackerScope() {
+    MemoryTracker::releasePage(threadPageMemory);
+    threadTracker = prevTracker;
+    threadPageMemory = prevPageMemory;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,83 @@
+#include "storage/buffer_manager/page_prefetcher.h"
+
+#include <algorithm>
+
+#include "storage/buffer_manager/buffer_manager.h"
+
+namespace kuzu {
+namespace storage {
+
+PagePrefetcher::~PagePrefetcher() {
+    {
+        std::unique_lock lck{mtx};
+        stopped = true;
+        pendingRequests.clear();
+    }
+    hasPendingRequestsCV.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+bool PagePrefetcher::schedule(const PrefetchRequest& request) {
+    {
+        std::unique_lock lck{mtx};
+        if (stopped || pendingRequests.size() >= MAX_NUM_PENDING_REQUESTS) {
+            return false;
+        }
+        if (threads.empty()) {
+            for (auto i = 0u; i < NUM_THREADS; i++) {
+                threads.emplace_back([this]() { runWorker(); });
+            }
+        }
+        pendingRequests.push_back(request);
+    }
+    hasPendingRequestsCV.notify_one();
+    return true;
+}
+
+void PagePrefetcher::removeRequestsForFile(BMFileHandle* fileHandle) {
+    std::unique_lock lck{mtx};
+    std::erase_if(pendingRequests,
+        [&](const PrefetchRequest& request) { return request.fileHandle == fileHandle; });
+    requestProcessedCV.wait(lck, [&]() {
+        return std::find(activeFileHandles.begin(), activeFileHandles.end(), fileHandle) ==
+               activeFileHandles.end();
+    });
+}
+
+void PagePrefetcher::waitForAllRequests() {
+    std::unique_lock lck{mtx};
+    requestProcessedCV.wait(
+        lck, [&]() { return pendingRequests.empty() && activeFileHandles.empty(); });
+}
+
+void PagePrefetcher::runWorker() {
+    while (true) {
+        PrefetchRequest request;
+        {
+            std::unique_lock lck{mtx};
+            hasPendingRequestsCV.wait(lck, [&]() { return stopped || !pendingRequests.empty(); });
+            if (stopped) {
+                return;
+            }
+            request = pendingRequests.front();
+            pendingRequests.pop_front();
+            activeFileHandles.push_back(request.fileHandle);
+        }
+        try {
+            bm->prefetchPages(*request.fileHandle, request.startPageIdx, request.numPages);
+        } catch (...) { // LCOV_EXCL_START
+            // Errors are ignored, since the pages are read again when they are pinned.
+        } // LCOV_EXCL_STOP
+        {
+            std::unique_lock lck{mtx};
+            activeFileHandles.erase(
+                std::find(activeFileHandles.begin(), activeFileHandles.end(), request.fileHandle));
+        }
+        requestProcessedCV.notify_all();
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
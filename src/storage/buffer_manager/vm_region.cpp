@@ -1,6 +1,10 @@
 #include "storage/buffer_manager/vm_region.h"
 
+#include <algorithm>
+
+#include "common/assert.h"
 #include "common/string_format.h"
+#include "common/string_utils.h"
 #include "common/system_message.h"
 
 #ifdef _WIN32
@@ -11,6 +15,15 @@
 #include <sys/mman.h>
 #endif
 
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <vector>
+#endif
+
 #include "common/exception/buffer_manager.h"
 
 using namespace kuzu::common;
@@ -18,7 +31,68 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
-VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFrameGroups{0} {
+NUMAPolicy NUMAPolicyUtils::fromString(const std::string& str) {
+    auto upperStr = StringUtils::getUpper(str);
+    if (upperStr == "DEFAULT") {
+        return NUMAPolicy::DEFAULT;
+    } else if (upperStr == "LOCAL") {
+        return NUMAPolicy::LOCAL;
+    } else if (upperStr == "INTERLEAVE") {
+        return NUMAPolicy::INTERLEAVE;
+    }
+    throw BufferManagerException(
+        "Unknown NUMA policy " + str + ". Supported policies are DEFAULT, LOCAL and INTERLEAVE.");
+}
+
+std::string NUMAPolicyUtils::toString(NUMAPolicy policy) {
+    switch (policy) {
+    case NUMAPolicy::DEFAULT:
+        return "DEFAULT";
+    case NUMAPolicy::LOCAL:
+        return "LOCAL";
+    case NUMAPolicy::INTERLEAVE:
+        return "INTERLEAVE";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+#ifdef __linux__
+// Parses the list of online NUMA nodes, e.g. "0-1,4".
+static std::vector<uint64_t> getOnlineNUMANodes() {
+    std::vector<uint64_t> nodes;
+    std::ifstream file{"/sys/devices/system/node/online"};
+    std::string nodeList;
+    if (!file || !std::getline(file, nodeList)) {
+        return nodes;
+    }
+    for (auto& range : StringUtils::split(nodeList, ",")) {
+        auto bounds = StringUtils::split(range, "-");
+        try {
+            auto first = std::stoull(bounds[0]);
+            auto last = bounds.size() > 1 ? std::stoull(bounds[1]) : first;
+            for (auto node = first; node <= last; node++) {
+                nodes.push_back(node);
+            }
+        } catch (std::exception&) { // LCOV_EXCL_START
+            return {};
+        } // LCOV_EXCL_STOP
+    }
+    return nodes;
+}
+#endif
+
+uint64_t VMRegion::getNumNUMANodes() {
+#ifdef __linux__
+    static const uint64_t numNodes = std::max<uint64_t>(getOnlineNUMANodes().size(), 1);
+    return numNodes;
+#else
+    return 1;
+#endif
+}
+
+VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize, VMRegionConfig config)
+    : numFrameGroups{0}, config{config} {
     if (maxRegionSize > (std::size_t)-1) {
         throw BufferManagerException("maxRegionSize is beyond the max available mmap region size.");
     }
@@ -42,6 +116,42 @@ VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFra
         throw BufferManagerException(
             "Mmap for size " + std::to_string(getMaxRegionSize()) + " failed.");
     }
+#endif
+    applyConfig();
+}
+
+void VMRegion::applyConfig() {
+#ifdef __linux__
+    // Errors are ignored, since the region works without huge pages and NUMA placement.
+#ifdef MADV_HUGEPAGE
+    if (config.useHugePages) {
+        // Releasing a frame smaller than a huge page splits the huge page, which the kernel may
+        // collapse again once all of its frames are in use.
+        madvise(region, getMaxRegionSize(), MADV_HUGEPAGE);
+    }
+#endif
+    switch (config.numaPolicy) {
+    case NUMAPolicy::LOCAL: {
+        syscall(SYS_mbind, region, getMaxRegionSize(), MPOL_LOCAL, nullptr, 0, 0);
+    } break;
+    case NUMAPolicy::INTERLEAVE: {
+        auto nodes = getOnlineNUMANodes();
+        if (nodes.size() <= 1) {
+            break;
+        }
+        constexpr uint64_t numBitsPerWord = sizeof(unsigned long) * 8;
+        auto maxNode = *std::max_element(nodes.begin(), nodes.end()) + 1;
+        std::vector<unsigned long> nodeMask((maxNode + numBitsPerWord - 1) / numBitsPerWord, 0);
+        for (auto node : nodes) {
+            nodeMask[node / numBitsPerWord] |= 1ul << (node % numBitsPerWord);
+        }
+        // The kernel only reads maxnode - 1 bits of the mask.
+        syscall(SYS_mbind, region, getMaxRegionSize(), MPOL_INTERLEAVE, nodeMask.data(),
+            maxNode + 1, 0);
+    } break;
+    default:
+        break;
+    }
 #endif
 }
 
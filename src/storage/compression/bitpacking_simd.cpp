@@ -0,0 +1,379 @@
+#include "storage/compression/bitpacking_simd.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "common/assert.h"
+#include "fastpfor/bitpackinghelpers.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KUZU_BITPACKING_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace kuzu {
+namespace storage {
+
+static constexpr uint64_t CHUNK_SIZE = BitpackingUtils::CHUNK_SIZE;
+// The vectorized kernels load full registers, so they may read up to this many bytes past the end
+// of the last chunk they unpack.
+static constexpr uint64_t MAX_OVERREAD = 64;
+
+template<typename U>
+static inline U getValueMask(uint8_t bitWidth) {
+    return bitWidth >= sizeof(U) * 8 ? ~U(0) : static_cast<U>((U(1) << bitWidth) - 1);
+}
+
+template<typename U>
+static inline U getSignBit(const BitpackHeader& header) {
+    // (value ^ signBit) - signBit is a no-op when signBit is 0, so the kernels can apply it
+    // unconditionally
+    return header.hasNegative && header.bitWidth > 0 ? U(1) << (header.bitWidth - 1) : U(0);
+}
+
+template<typename T>
+static void unpackChunksScalar(
+    const uint8_t* src, T* dst, uint64_t numChunks, const BitpackHeader& header) {
+    using U = std::make_unsigned_t<T>;
+    const auto bytesPerChunk = CHUNK_SIZE / 8 * header.bitWidth;
+    const auto signBit = getSignBit<U>(header);
+    const auto offset = static_cast<U>(header.offset);
+    for (auto chunk = 0u; chunk < numChunks; chunk++) {
+        auto out = reinterpret_cast<U*>(dst + chunk * CHUNK_SIZE);
+        if constexpr (sizeof(T) == sizeof(uint32_t) || sizeof(T) == sizeof(uint64_t)) {
+            FastPForLib::fastunpack(
+                reinterpret_cast<const uint32_t*>(src), out, header.bitWidth);
+        } else if constexpr (sizeof(T) == sizeof(uint16_t)) {
+            FastPForLib::fastunpack(
+                reinterpret_cast<const uint16_t*>(src), out, header.bitWidth);
+        } else {
+            static_assert(sizeof(T) == sizeof(uint8_t));
+            FastPForLib::fastunpack(src, out, header.bitWidth);
+        }
+        for (auto i = 0u; i < CHUNK_SIZE; i++) {
+            out[i] = static_cast<U>(static_cast<U>((out[i] ^ signBit) - signBit) + offset);
+        }
+        src += bytesPerChunk;
+    }
+}
+
+#ifdef KUZU_BITPACKING_X86_SIMD
+
+// Positions of the values in a group of lanes: the index of the 32-bit word in which each value
+// starts and the shift needed to move it to the start of the lane. Values which don't end in their
+// first word are completed from the next word, shifted to the left.
+template<uint32_t NUM_LANES>
+struct WordLayout {
+    alignas(64) uint32_t lowWords[NUM_LANES];
+    alignas(64) uint32_t highWords[NUM_LANES];
+    alignas(64) uint32_t lowShifts[NUM_LANES];
+    alignas(64) uint32_t highShifts[NUM_LANES];
+
+    explicit WordLayout(uint32_t bitWidth) {
+        for (auto i = 0u; i < NUM_LANES; i++) {
+            auto bit = i * bitWidth;
+            lowWords[i] = bit / 32;
+            // The permutes only use the low bits of the index, so the word past the end of the
+            // register wraps around. This only happens for a bit width of 32, where the high
+            // shift is 32 and the variable shifts zero out the lane.
+            highWords[i] = bit / 32 + 1;
+            lowShifts[i] = bit % 32;
+            highShifts[i] = 32 - bit % 32;
+        }
+    }
+};
+
+// Byte offset and shift of each value in a chunk for bit widths larger than 32, which are unpacked
+// into 64-bit lanes with gathers.
+struct ByteLayout {
+    alignas(64) int64_t byteOffsets[CHUNK_SIZE];
+    alignas(64) uint64_t lowShifts[CHUNK_SIZE];
+    alignas(64) uint64_t highShifts[CHUNK_SIZE];
+    // Values of more than 57 bits can span 9 bytes
+    bool spansTwoWords;
+
+    explicit ByteLayout(uint32_t bitWidth) : spansTwoWords{bitWidth > 57} {
+        for (auto i = 0u; i < CHUNK_SIZE; i++) {
+            auto bit = i * bitWidth;
+            byteOffsets[i] = bit / 8;
+            lowShifts[i] = bit % 8;
+            highShifts[i] = 64 - bit % 8;
+        }
+    }
+};
+
+__attribute__((target("avx2"))) static inline __m256i unpackGroupAVX2(const uint8_t* src,
+    __m256i lowWords, __m256i highWords, __m256i lowShifts, __m256i highShifts, __m256i mask) {
+    auto data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    auto low = _mm256_srlv_epi32(_mm256_permutevar8x32_epi32(data, lowWords), lowShifts);
+    auto high = _mm256_sllv_epi32(_mm256_permutevar8x32_epi32(data, highWords), highShifts);
+    return _mm256_and_si256(_mm256_or_si256(low, high), mask);
+}
+
+__attribute__((target("avx2"))) static void unpack32AVX2(
+    const uint8_t* src, uint32_t* dst, uint64_t numChunks, const BitpackHeader& header) {
+    const WordLayout<8> layout(header.bitWidth);
+    const auto lowWords = _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.lowWords));
+    const auto highWords = _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.highWords));
+    const auto lowShifts = _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.lowShifts));
+    const auto highShifts = _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.highShifts));
+    const auto mask =
+        _mm256_set1_epi32(static_cast<int32_t>(getValueMask<uint32_t>(header.bitWidth)));
+    const auto signBit = _mm256_set1_epi32(static_cast<int32_t>(getSignBit<uint32_t>(header)));
+    const auto offset = _mm256_set1_epi32(static_cast<int32_t>(header.offset));
+    // A group of 8 values takes exactly bitWidth bytes
+    for (auto group = 0u; group < numChunks * CHUNK_SIZE / 8; group++) {
+        auto values = unpackGroupAVX2(
+            src + group * header.bitWidth, lowWords, highWords, lowShifts, highShifts, mask);
+        values = _mm256_sub_epi32(_mm256_xor_si256(values, signBit), signBit);
+        values = _mm256_add_epi32(values, offset);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + group * 8), values);
+    }
+}
+
+__attribute__((target("avx2"))) static void unpack64AVX2(
+    const uint8_t* src, uint64_t* dst, uint64_t numChunks, const BitpackHeader& header) {
+    const auto signBit = _mm256_set1_epi64x(static_cast<int64_t>(getSignBit<uint64_t>(header)));
+    const auto offset = _mm256_set1_epi64x(static_cast<int64_t>(header.offset));
+    if (header.bitWidth <= 32) {
+        // Unpack into 32-bit lanes and widen
+        const WordLayout<8> layout(header.bitWidth);
+        const auto lowWords = _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.lowWords));
+        const auto highWords =
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.highWords));
+        const auto lowShifts =
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.lowShifts));
+        const auto highShifts =
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.highShifts));
+        const auto mask =
+            _mm256_set1_epi32(static_cast<int32_t>(getValueMask<uint32_t>(header.bitWidth)));
+        for (auto group = 0u; group < numChunks * CHUNK_SIZE / 8; group++) {
+            auto values = unpackGroupAVX2(
+                src + group * header.bitWidth, lowWords, highWords, lowShifts, highShifts, mask);
+            __m256i halves[2] = {_mm256_cvtepu32_epi64(_mm256_castsi256_si128(values)),
+                _mm256_cvtepu32_epi64(_mm256_extracti128_si256(values, 1))};
+            for (auto i = 0u; i < 2; i++) {
+                auto half = _mm256_sub_epi64(_mm256_xor_si256(halves[i], signBit), signBit);
+                half = _mm256_add_epi64(half, offset);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + group * 8 + i * 4), half);
+            }
+        }
+        return;
+    }
+    const ByteLayout layout(header.bitWidth);
+    const auto mask =
+        _mm256_set1_epi64x(static_cast<int64_t>(getValueMask<uint64_t>(header.bitWidth)));
+    const auto bytesPerChunk = CHUNK_SIZE / 8 * header.bitWidth;
+    for (auto chunk = 0u; chunk < numChunks; chunk++) {
+        auto base = reinterpret_cast<const long long*>(src + chunk * bytesPerChunk);
+        for (auto i = 0u; i < CHUNK_SIZE; i += 4) {
+            auto byteOffsets =
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.byteOffsets + i));
+            auto values = _mm256_srlv_epi64(_mm256_i64gather_epi64(base, byteOffsets, 1),
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.lowShifts + i)));
+            if (layout.spansTwoWords) {
+                auto high = _mm256_sllv_epi64(_mm256_i64gather_epi64(base + 1, byteOffsets, 1),
+                    _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.highShifts + i)));
+                values = _mm256_or_si256(values, high);
+            }
+            values = _mm256_and_si256(values, mask);
+            values = _mm256_sub_epi64(_mm256_xor_si256(values, signBit), signBit);
+            values = _mm256_add_epi64(values, offset);
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(dst + chunk * CHUNK_SIZE + i), values);
+        }
+    }
+}
+
+__attribute__((target("avx512f"))) static inline __m512i unpackGroupAVX512(const uint8_t* src,
+    __m512i lowWords, __m512i highWords, __m512i lowShifts, __m512i highShifts, __m512i mask) {
+    auto data = _mm512_loadu_si512(src);
+    auto low = _mm512_srlv_epi32(_mm512_permutexvar_epi32(lowWords, data), lowShifts);
+    auto high = _mm512_sllv_epi32(_mm512_permutexvar_epi32(highWords, data), highShifts);
+    return _mm512_and_si512(_mm512_or_si512(low, high), mask);
+}
+
+__attribute__((target("avx512f"))) static void unpack32AVX512(
+    const uint8_t* src, uint32_t* dst, uint64_t numChunks, const BitpackHeader& header) {
+    const WordLayout<16> layout(header.bitWidth);
+    const auto lowWords = _mm512_load_si512(layout.lowWords);
+    const auto highWords = _mm512_load_si512(layout.highWords);
+    const auto lowShifts = _mm512_load_si512(layout.lowShifts);
+    const auto highShifts = _mm512_load_si512(layout.highShifts);
+    const auto mask =
+        _mm512_set1_epi32(static_cast<int32_t>(getValueMask<uint32_t>(header.bitWidth)));
+    const auto signBit = _mm512_set1_epi32(static_cast<int32_t>(getSignBit<uint32_t>(header)));
+    const auto offset = _mm512_set1_epi32(static_cast<int32_t>(header.offset));
+    // A group of 16 values takes exactly 2 * bitWidth bytes
+    for (auto group = 0u; group < numChunks * CHUNK_SIZE / 16; group++) {
+        auto values = unpackGroupAVX512(
+            src + group * 2 * header.bitWidth, lowWords, highWords, lowShifts, highShifts, mask);
+        values = _mm512_sub_epi32(_mm512_xor_si512(values, signBit), signBit);
+        values = _mm512_add_epi32(values, offset);
+        _mm512_storeu_si512(dst + group * 16, values);
+    }
+}
+
+__attribute__((target("avx512f"))) static void unpack64AVX512(
+    const uint8_t* src, uint64_t* dst, uint64_t numChunks, const BitpackHeader& header) {
+    const auto signBit = _mm512_set1_epi64(static_cast<int64_t>(getSignBit<uint64_t>(header)));
+    const auto offset = _mm512_set1_epi64(static_cast<int64_t>(header.offset));
+    if (header.bitWidth <= 32) {
+        // Unpack into 32-bit lanes and widen
+        const WordLayout<16> layout(header.bitWidth);
+        const auto lowWords = _mm512_load_si512(layout.lowWords);
+        const auto highWords = _mm512_load_si512(layout.highWords);
+        const auto lowShifts = _mm512_load_si512(layout.lowShifts);
+        const auto highShifts = _mm512_load_si512(layout.highShifts);
+        const auto mask =
+            _mm512_set1_epi32(static_cast<int32_t>(getValueMask<uint32_t>(header.bitWidth)));
+        for (auto group = 0u; group < numChunks * CHUNK_SIZE / 16; group++) {
+            auto values = unpackGroupAVX512(src + group * 2 * header.bitWidth, lowWords,
+                highWords, lowShifts, highShifts, mask);
+            __m512i halves[2] = {_mm512_cvtepu32_epi64(_mm512_castsi512_si256(values)),
+                _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(values, 1))};
+            for (auto i = 0u; i < 2; i++) {
+                auto half = _mm512_sub_epi64(_mm512_xor_si512(halves[i], signBit), signBit);
+                half = _mm512_add_epi64(half, offset);
+                _mm512_storeu_si512(dst + group * 16 + i * 8, half);
+            }
+        }
+        return;
+    }
+    const ByteLayout layout(header.bitWidth);
+    const auto mask =
+        _mm512_set1_epi64(static_cast<int64_t>(getValueMask<uint64_t>(header.bitWidth)));
+    const auto bytesPerChunk = CHUNK_SIZE / 8 * header.bitWidth;
+    for (auto chunk = 0u; chunk < numChunks; chunk++) {
+        auto base = src + chunk * bytesPerChunk;
+        for (auto i = 0u; i < CHUNK_SIZE; i += 8) {
+            auto byteOffsets = _mm512_load_si512(layout.byteOffsets + i);
+            auto values = _mm512_srlv_epi64(_mm512_i64gather_epi64(byteOffsets, base, 1),
+                _mm512_load_si512(layout.lowShifts + i));
+            if (layout.spansTwoWords) {
+                auto high = _mm512_sllv_epi64(_mm512_i64gather_epi64(byteOffsets, base + 8, 1),
+                    _mm512_load_si512(layout.highShifts + i));
+                values = _mm512_or_si512(values, high);
+            }
+            values = _mm512_and_si512(values, mask);
+            values = _mm512_sub_epi64(_mm512_xor_si512(values, signBit), signBit);
+            values = _mm512_add_epi64(values, offset);
+            _mm512_storeu_si512(dst + chunk * CHUNK_SIZE + i, values);
+        }
+    }
+}
+
+template<typename U>
+using unpack_kernel_t = void (*)(const uint8_t*, U*, uint64_t, const BitpackHeader&);
+
+// Runs the kernel directly on the source for all but the last few chunks, and on a zero-padded copy
+// of the remaining chunks so that the kernel never reads past the end of the source.
+template<typename U>
+static void unpackChunksVectorized(unpack_kernel_t<U> kernel, const uint8_t* src, U* dst,
+    uint64_t numChunks, const BitpackHeader& header) {
+    const auto bytesPerChunk = CHUNK_SIZE / 8 * header.bitWidth;
+    const auto numPaddedChunks =
+        std::min(numChunks, (MAX_OVERREAD + bytesPerChunk - 1) / bytesPerChunk);
+    const auto numDirectChunks = numChunks - numPaddedChunks;
+    if (numDirectChunks > 0) {
+        kernel(src, dst, numDirectChunks, header);
+    }
+    alignas(64) uint8_t buffer[CHUNK_SIZE * sizeof(uint64_t) + 2 * MAX_OVERREAD];
+    const auto paddedSize = numPaddedChunks * bytesPerChunk;
+    KU_ASSERT(paddedSize + MAX_OVERREAD <= sizeof(buffer));
+    memcpy(buffer, src + numDirectChunks * bytesPerChunk, paddedSize);
+    memset(buffer + paddedSize, 0, MAX_OVERREAD);
+    kernel(buffer, dst + numDirectChunks * CHUNK_SIZE, numPaddedChunks, header);
+}
+
+#endif
+
+SIMDLevel BitpackingUtils::getSupportedSIMDLevel() {
+    static const SIMDLevel level = []() {
+#ifdef KUZU_BITPACKING_X86_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SIMDLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return SIMDLevel::AVX2;
+        }
+#endif
+        return SIMDLevel::SCALAR;
+    }();
+    return level;
+}
+
+const char* BitpackingUtils::toString(SIMDLevel level) {
+    switch (level) {
+    case SIMDLevel::SCALAR:
+        return "SCALAR";
+    case SIMDLevel::AVX2:
+        return "AVX2";
+    case SIMDLevel::AVX512:
+        return "AVX512";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+template<typename T>
+void BitpackingUtils::unpackChunks(const uint8_t* src, T* dst, uint64_t numChunks,
+    const BitpackHeader& header, SIMDLevel level) {
+    KU_ASSERT(level <= getSupportedSIMDLevel());
+    KU_ASSERT(header.bitWidth <= sizeof(T) * 8);
+    if (numChunks == 0) {
+        return;
+    }
+    if (header.bitWidth == 0) {
+        std::fill_n(dst, numChunks * CHUNK_SIZE, static_cast<T>(header.offset));
+        return;
+    }
+#ifdef KUZU_BITPACKING_X86_SIMD
+    if constexpr (sizeof(T) == sizeof(uint32_t)) {
+        switch (level) {
+        case SIMDLevel::AVX512:
+            return unpackChunksVectorized<uint32_t>(
+                unpack32AVX512, src, reinterpret_cast<uint32_t*>(dst), numChunks, header);
+        case SIMDLevel::AVX2:
+            return unpackChunksVectorized<uint32_t>(
+                unpack32AVX2, src, reinterpret_cast<uint32_t*>(dst), numChunks, header);
+        default:
+            break;
+        }
+    } else if constexpr (sizeof(T) == sizeof(uint64_t)) {
+        switch (level) {
+        case SIMDLevel::AVX512:
+            return unpackChunksVectorized<uint64_t>(
+                unpack64AVX512, src, reinterpret_cast<uint64_t*>(dst), numChunks, header);
+        case SIMDLevel::AVX2:
+            return unpackChunksVectorized<uint64_t>(
+                unpack64AVX2, src, reinterpret_cast<uint64_t*>(dst), numChunks, header);
+        default:
+            break;
+        }
+    }
+#endif
+    unpackChunksScalar(src, dst, numChunks, header);
+}
+
+template void BitpackingUtils::unpackChunks<int8_t>(
+    const uint8_t*, int8_t*, uint64_t, const BitpackHeader&, SIMDLevel);
+template void BitpackingUtils::unpackChunks<int16_t>(
+    const uint8_t*, int16_t*, uint64_t, const BitpackHeader&, SIMDLevel);
+template void BitpackingUtils::unpackChunks<int32_t>(
+    const uint8_t*, int32_t*, uint64_t, const BitpackHeader&, SIMDLevel);
+template void BitpackingUtils::unpackChunks<int64_t>(
+    const uint8_t*, int64_t*, uint64_t, const BitpackHeader&, SIMDLevel);
+template void BitpackingUtils::unpackChunks<uint8_t>(
+    const uint8_t*, uint8_t*, uint64_t, const BitpackHeader&, SIMDLevel);
+template void BitpackingUtils::unpackChunks<uint16_t>(
+    const uint8_t*, uint16_t*, uint64_t, const BitpackHeader&, SIMDLevel);
+template void BitpackingUtils::unpackChunks<uint32_t>(
+    const uint8_t*, uint32_t*, uint64_t, const BitpackHeader&, SIMDLevel);
+template void BitpackingUtils::unpackChunks<uint64_t>(
+    const uint8_t*, uint64_t*, uint64_t, const BitpackHeader&, SIMDLevel);
+
+} // namespace storage
+} // namespace kuzu
@@ -1,6 +1,8 @@
 #include "storage/compression/compression.h"
 
+#include <cmath>
 #include <limits>
+#include <numeric>
 #include <string>
 
 #include "common/exception/not_implemented.h"
@@ -9,7 +11,9 @@
 #include "common/types/types.h"
 #include "common/vector/value_vector.h"
 #include "fastpfor/bitpackinghelpers.h"
-#include "storage/compression/sign_extend.h"
+#include "storage/compression/bitpacking_simd.h"
+#include "storage/compression/float_compression.h"
+#include "storage/compression/run_length_encoding.h"
 #include "storage/store/column.h"
 #include <bit>
 
@@ -44,11 +48,16 @@ uint32_t getDataTypeSizeInChunk(const common::LogicalType& dataType) {
 bool CompressionMetadata::canAlwaysUpdateInPlace() const {
     switch (compression) {
     case CompressionType::BOOLEAN_BITPACKING:
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return true;
     }
     case CompressionType::CONSTANT:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::FRAME_OF_REFERENCE:
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::ALP:
+    case CompressionType::RLE: {
         return false;
     }
     default: {
@@ -58,6 +67,19 @@ bool CompressionMetadata::canAlwaysUpdateInPlace() const {
     }
 }
 
+bool CompressionMetadata::canNeverUpdateInPlace() const {
+    switch (compression) {
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::ALP:
+    case CompressionType::RLE: {
+        return true;
+    }
+    default: {
+        return false;
+    }
+    }
+}
+
 bool CompressionMetadata::canUpdateInPlace(
     const uint8_t* data, uint32_t pos, PhysicalTypeID physicalType) const {
     if (canAlwaysUpdateInPlace()) {
@@ -70,9 +92,17 @@ bool CompressionMetadata::canUpdateInPlace(
         return memcmp(data + pos * size, this->data.data(), size) == 0;
     }
     case CompressionType::BOOLEAN_BITPACKING:
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return true;
     }
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::ALP:
+    case CompressionType::RLE: {
+        // See canNeverUpdateInPlace
+        return false;
+    }
+    case CompressionType::FRAME_OF_REFERENCE:
     case CompressionType::INTEGER_BITPACKING: {
         switch (physicalType) {
         case PhysicalTypeID::INT64: {
@@ -137,9 +167,11 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& da
     case CompressionType::CONSTANT: {
         return std::numeric_limits<uint64_t>::max();
     }
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return Uncompressed::numValues(pageSize, dataType);
     }
+    case CompressionType::FRAME_OF_REFERENCE:
     case CompressionType::INTEGER_BITPACKING: {
         switch (dataType.getPhysicalType()) {
         case PhysicalTypeID::INT64:
@@ -171,9 +203,56 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& da
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING: {
+        auto header = BitpackHeader::readHeader(data);
+        switch (dataType.getPhysicalType()) {
+        case PhysicalTypeID::INT64:
+            return DeltaBitpacking<int64_t>::numValues(pageSize, header);
+        case PhysicalTypeID::INT32:
+            return DeltaBitpacking<int32_t>::numValues(pageSize, header);
+        case PhysicalTypeID::INT16:
+            return DeltaBitpacking<int16_t>::numValues(pageSize, header);
+        case PhysicalTypeID::INT8:
+            return DeltaBitpacking<int8_t>::numValues(pageSize, header);
+        case PhysicalTypeID::VAR_LIST:
+        case PhysicalTypeID::UINT64:
+            return DeltaBitpacking<uint64_t>::numValues(pageSize, header);
+        case PhysicalTypeID::STRING:
+        case PhysicalTypeID::UINT32:
+            return DeltaBitpacking<uint32_t>::numValues(pageSize, header);
+        case PhysicalTypeID::UINT16:
+            return DeltaBitpacking<uint16_t>::numValues(pageSize, header);
+        case PhysicalTypeID::UINT8:
+            return DeltaBitpacking<uint8_t>::numValues(pageSize, header);
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses delta bitpacking but does not "
+                "have a supported integer physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(dataType.getPhysicalType()));
+        }
+        }
+    }
+    case CompressionType::ALP: {
+        auto header = ALPHeader::readHeader(data);
+        switch (dataType.getPhysicalType()) {
+        case PhysicalTypeID::DOUBLE:
+            return FloatCompression<double>::numValues(pageSize, header);
+        case PhysicalTypeID::FLOAT:
+            return FloatCompression<float>::numValues(pageSize, header);
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses ALP compression but does not "
+                "have a floating point physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(dataType.getPhysicalType()));
+        }
+        }
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
+    case CompressionType::RLE: {
+        return RunLengthEncoding::numValues(*this);
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -252,12 +331,30 @@ std::string CompressionMetadata::toString() const {
         auto header = BitpackHeader::readHeader(data);
         return "INTEGER_BITPACKING[" + std::to_string(header.bitWidth) + "]";
     }
+    case CompressionType::FRAME_OF_REFERENCE: {
+        auto header = BitpackHeader::readHeader(data);
+        return "FRAME_OF_REFERENCE[" + std::to_string(header.bitWidth) + "]";
+    }
+    case CompressionType::DELTA_BITPACKING: {
+        auto header = BitpackHeader::readHeader(data);
+        return "DELTA_BITPACKING[" + std::to_string(header.bitWidth) + "]";
+    }
+    case CompressionType::ALP: {
+        auto header = ALPHeader::readHeader(data);
+        return "ALP[" + std::to_string(header.bitWidth) + "]";
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return "BOOLEAN_BITPACKING";
     }
     case CompressionType::CONSTANT: {
         return "CONSTANT";
     }
+    case CompressionType::FSST: {
+        return "FSST";
+    }
+    case CompressionType::RLE: {
+        return "RLE[" + std::to_string(RunLengthEncoding::numValues(*this)) + "]";
+    }
     default: {
         KU_UNREACHABLE;
     }
@@ -284,6 +381,182 @@ void ConstantCompression::copyFromPage(const uint8_t* srcBuffer, uint64_t srcOff
     }
 }
 
+// The values satisfying a comparison with a constant, as the inclusive range [min, max], or
+// everything outside of it if isNegated is set (for NOT_EQUALS).
+template<typename T>
+struct PredicateRange {
+    T min;
+    T max;
+    bool isEmpty = false;
+    bool isNegated = false;
+
+    // Returns std::nullopt for anything other than =, <>, <, <=, > and >=
+    static std::optional<PredicateRange> create(const ColumnPredicate& predicate) {
+        T value;
+        if constexpr (std::is_floating_point_v<T>) {
+            value = (T)predicate.value.floatVal;
+        } else if constexpr (std::is_signed_v<T>) {
+            value = (T)predicate.value.signedInt;
+        } else {
+            value = (T)predicate.value.unsignedInt;
+        }
+        PredicateRange range{lowest(), highest()};
+        switch (predicate.comparison) {
+        case ExpressionType::NOT_EQUALS:
+            range.isNegated = true;
+            [[fallthrough]];
+        case ExpressionType::EQUALS: {
+            range.min = value;
+            range.max = value;
+        } break;
+        case ExpressionType::GREATER_THAN: {
+            range.isEmpty = value == highest();
+            if constexpr (std::is_floating_point_v<T>) {
+                range.min = std::nextafter(value, highest());
+            } else {
+                range.min = range.isEmpty ? value : value + 1;
+            }
+        } break;
+        case ExpressionType::GREATER_THAN_EQUALS: {
+            range.min = value;
+        } break;
+        case ExpressionType::LESS_THAN: {
+            range.isEmpty = value == lowest();
+            if constexpr (std::is_floating_point_v<T>) {
+                range.max = std::nextafter(value, lowest());
+            } else {
+                range.max = range.isEmpty ? value : value - 1;
+            }
+        } break;
+        case ExpressionType::LESS_THAN_EQUALS: {
+            range.max = value;
+        } break;
+        default:
+            return std::nullopt;
+        }
+        return range;
+    }
+
+private:
+    static constexpr T lowest() {
+        if constexpr (std::is_floating_point_v<T>) {
+            return -std::numeric_limits<T>::infinity();
+        } else {
+            return std::numeric_limits<T>::min();
+        }
+    }
+    static constexpr T highest() {
+        if constexpr (std::is_floating_point_v<T>) {
+            return std::numeric_limits<T>::infinity();
+        } else {
+            return std::numeric_limits<T>::max();
+        }
+    }
+};
+
+static uint64_t selectAll(uint64_t numValues, sel_t posInResult, sel_t* selectedPositions) {
+    std::iota(selectedPositions, selectedPositions + numValues, posInResult);
+    return numValues;
+}
+
+// Branch-free so that the compiler can vectorize the comparisons: every position is written, but
+// the output cursor only advances for values in the range.
+template<typename T>
+static uint64_t selectInRange(const T* values, uint64_t numValues, const PredicateRange<T>& range,
+    sel_t posInResult, sel_t* selectedPositions) {
+    uint64_t numSelected = 0;
+    if constexpr (std::is_floating_point_v<T>) {
+        for (auto i = 0u; i < numValues; i++) {
+            selectedPositions[numSelected] = posInResult + i;
+            numSelected +=
+                (values[i] >= range.min && values[i] <= range.max) != range.isNegated;
+        }
+    } else {
+        // min <= value <= max iff value - min <= max - min with unsigned wrap-around
+        using U = std::make_unsigned_t<T>;
+        auto span = (U)((U)range.max - (U)range.min);
+        for (auto i = 0u; i < numValues; i++) {
+            selectedPositions[numSelected] = posInResult + i;
+            numSelected += ((U)((U)values[i] - (U)range.min) <= span) != range.isNegated;
+        }
+    }
+    return numSelected;
+}
+
+template<typename T>
+static std::optional<uint64_t> selectFromValues(const T* values, uint64_t numValues,
+    const ColumnPredicate& predicate, sel_t posInResult, sel_t* selectedPositions) {
+    auto range = PredicateRange<T>::create(predicate);
+    if (!range) {
+        return std::nullopt;
+    }
+    if (range->isEmpty) {
+        return 0;
+    }
+    return selectInRange(values, numValues, *range, posInResult, selectedPositions);
+}
+
+static std::optional<uint64_t> selectFromValues(PhysicalTypeID physicalType,
+    const uint8_t* values, uint64_t numValues, const ColumnPredicate& predicate,
+    sel_t posInResult, sel_t* selectedPositions) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return selectFromValues(
+            (const int64_t*)values, numValues, predicate, posInResult, selectedPositions);
+    case PhysicalTypeID::INT32:
+        return selectFromValues(
+            (const int32_t*)values, numValues, predicate, posInResult, selectedPositions);
+    case PhysicalTypeID::INT16:
+        return selectFromValues(
+            (const int16_t*)values, numValues, predicate, posInResult, selectedPositions);
+    case PhysicalTypeID::INT8:
+        return selectFromValues(
+            (const int8_t*)values, numValues, predicate, posInResult, selectedPositions);
+    case PhysicalTypeID::UINT64:
+        return selectFromValues(
+            (const uint64_t*)values, numValues, predicate, posInResult, selectedPositions);
+    case PhysicalTypeID::UINT32:
+        return selectFromValues(
+            (const uint32_t*)values, numValues, predicate, posInResult, selectedPositions);
+    case PhysicalTypeID::UINT16:
+        return selectFromValues(
+            (const uint16_t*)values, numValues, predicate, posInResult, selectedPositions);
+    case PhysicalTypeID::UINT8:
+        return selectFromValues(
+            (const uint8_t*)values, numValues, predicate, posInResult, selectedPositions);
+    case PhysicalTypeID::DOUBLE:
+        return selectFromValues(
+            (const double*)values, numValues, predicate, posInResult, selectedPositions);
+    case PhysicalTypeID::FLOAT:
+        return selectFromValues(
+            (const float*)values, numValues, predicate, posInResult, selectedPositions);
+    default:
+        return std::nullopt;
+    }
+}
+
+std::optional<uint64_t> ConstantCompression::selectFromPage(const uint8_t* /*srcBuffer*/,
+    uint64_t /*srcOffset*/, uint64_t numValues, const ColumnPredicate& predicate,
+    const CompressionMetadata& metadata, sel_t posInResult, sel_t* selectedPositions) const {
+    // Copy the value out of the metadata so that it is aligned
+    uint64_t value[2];
+    memcpy(value, metadata.data.data(), std::min<uint64_t>(numBytesPerValue, sizeof(value)));
+    sel_t selectedPos;
+    auto numSelected = selectFromValues(dataType, (const uint8_t*)value, 1 /*numValues*/,
+        predicate, 0 /*posInResult*/, &selectedPos);
+    if (!numSelected.has_value()) {
+        return std::nullopt;
+    }
+    return *numSelected == 0 ? 0 : selectAll(numValues, posInResult, selectedPositions);
+}
+
+std::optional<uint64_t> Uncompressed::selectFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint64_t numValues, const ColumnPredicate& predicate, const CompressionMetadata& /*metadata*/,
+    sel_t posInResult, sel_t* selectedPositions) const {
+    return selectFromValues(physicalType, srcBuffer + srcOffset * numBytesPerValue, numValues,
+        predicate, posInResult, selectedPositions);
+}
+
 template<typename T>
 static inline T abs(typename std::enable_if<std::is_unsigned<T>::value, T>::type value) {
     return value;
@@ -419,16 +692,8 @@ void IntegerBitpacking<T>::getValues(const uint8_t* chunkStart, uint8_t pos, uin
     // TODO(bmwinger): optimize as in setValueFromUncompressed
     KU_ASSERT(pos + numValuesToRead <= CHUNK_SIZE);
 
-    U chunk[CHUNK_SIZE];
-    fastunpack(chunkStart, chunk, header.bitWidth);
-    if (header.hasNegative) {
-        SignExtend<T, U, CHUNK_SIZE>((uint8_t*)chunk, header.bitWidth);
-    }
-    if (header.offset != 0) {
-        for (int i = pos; i < pos + numValuesToRead; i++) {
-            chunk[i] = (U)((T)chunk[i] + (T)header.offset);
-        }
-    }
+    T chunk[CHUNK_SIZE];
+    BitpackingUtils::unpackChunks(chunkStart, chunk, 1 /*numChunks*/, header);
     memcpy(dst, &chunk[pos], sizeof(T) * numValuesToRead);
 }
 
@@ -442,7 +707,8 @@ uint64_t IntegerBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
         return Uncompressed(sizeof(T)).compressNextPage(
             srcBuffer, numValuesRemaining, dstBuffer, dstBufferSize, metadata);
     }
-    KU_ASSERT(metadata.compression == CompressionType::INTEGER_BITPACKING);
+    KU_ASSERT(metadata.compression == CompressionType::INTEGER_BITPACKING ||
+              metadata.compression == CompressionType::FRAME_OF_REFERENCE);
     auto header = BitpackHeader::readHeader(metadata.data);
     auto bitWidth = header.bitWidth;
 
@@ -517,19 +783,11 @@ void IntegerBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t
         dstIndex += valuesInFirstChunk;
     }
 
-    // Use fastunpack to directly unpack the full-sized chunks
-    for (; dstIndex + CHUNK_SIZE <= dstOffset + numValues; dstIndex += CHUNK_SIZE) {
-        fastunpack(srcCursor, (U*)dstBuffer + dstIndex, header.bitWidth);
-        if (header.hasNegative) {
-            SignExtend<T, U, CHUNK_SIZE>(dstBuffer + dstIndex * sizeof(U), header.bitWidth);
-        }
-        if (header.offset != 0) {
-            for (auto i = 0u; i < CHUNK_SIZE; i++) {
-                ((T*)dstBuffer)[dstIndex + i] += (T)header.offset;
-            }
-        }
-        srcCursor += bytesPerChunk;
-    }
+    // Directly unpack the full-sized chunks, applying the sign extension and offset along the way
+    auto numFullChunks = (dstOffset + numValues - dstIndex) / CHUNK_SIZE;
+    BitpackingUtils::unpackChunks(srcCursor, (T*)dstBuffer + dstIndex, numFullChunks, header);
+    srcCursor += numFullChunks * bytesPerChunk;
+    dstIndex += numFullChunks * CHUNK_SIZE;
     // Copy remaining values from within the last chunk.
     if (dstIndex < dstOffset + numValues) {
         getValues(srcCursor, 0, dstBuffer + dstIndex * sizeof(U), dstOffset + numValues - dstIndex,
@@ -537,6 +795,72 @@ void IntegerBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t
     }
 }
 
+template<typename T>
+std::optional<uint64_t> IntegerBitpacking<T>::selectFromPage(const uint8_t* srcBuffer,
+    uint64_t srcOffset, uint64_t numValues, const ColumnPredicate& predicate,
+    const CompressionMetadata& metadata, sel_t posInResult, sel_t* selectedPositions) const {
+    // Values are unpacked in batches of whole chunks, aligned to the start of the page
+    static constexpr uint64_t BATCH_SIZE = 32 * CHUNK_SIZE;
+    auto range = PredicateRange<T>::create(predicate);
+    if (!range) {
+        return std::nullopt;
+    }
+    if (range->isEmpty) {
+        return 0;
+    }
+    auto header = BitpackHeader::readHeader(metadata.data);
+    uint64_t numSelected = 0;
+    if (header.hasNegative) {
+        T values[BATCH_SIZE];
+        for (auto pos = srcOffset; pos < srcOffset + numValues;) {
+            auto numValuesInBatch = std::min((pos / BATCH_SIZE + 1) * BATCH_SIZE,
+                                        srcOffset + numValues) - pos;
+            decompressFromPage(
+                srcBuffer, pos, (uint8_t*)values, 0 /*dstOffset*/, numValuesInBatch, metadata);
+            numSelected += selectInRange(values, numValuesInBatch, *range,
+                posInResult + (pos - srcOffset), selectedPositions + numSelected);
+            pos += numValuesInBatch;
+        }
+        return numSelected;
+    }
+    // Every value is offset + packed, with packed in [0, maxPacked]. Translate the range into the
+    // same domain as the packed values.
+    auto offset = (T)header.offset;
+    U maxPacked = header.bitWidth >= sizeof(U) * 8 ? std::numeric_limits<U>::max() :
+                                                     ((U)1 << header.bitWidth) - 1;
+    PredicateRange<U> packedRange{0, maxPacked, false /*isEmpty*/, range->isNegated};
+    if (range->max < offset) {
+        packedRange.isEmpty = true;
+    } else {
+        if (range->min > offset) {
+            packedRange.min = (U)range->min - (U)offset;
+        }
+        packedRange.max = std::min((U)((U)range->max - (U)offset), maxPacked);
+        packedRange.isEmpty = packedRange.min > packedRange.max;
+    }
+    // Nothing needs to be unpacked if either all or none of the values are in the range
+    if (packedRange.isEmpty) {
+        return packedRange.isNegated ? selectAll(numValues, posInResult, selectedPositions) : 0;
+    }
+    if (packedRange.min == 0 && packedRange.max == maxPacked) {
+        return packedRange.isNegated ? 0 : selectAll(numValues, posInResult, selectedPositions);
+    }
+    // Unpack without applying the offset
+    auto packedMetadata = CompressionMetadata(CompressionType::INTEGER_BITPACKING,
+        BitpackHeader{header.bitWidth, false /*hasNegative*/, 0 /*offset*/}.getData());
+    U values[BATCH_SIZE];
+    for (auto pos = srcOffset; pos < srcOffset + numValues;) {
+        auto numValuesInBatch =
+            std::min((pos / BATCH_SIZE + 1) * BATCH_SIZE, srcOffset + numValues) - pos;
+        IntegerBitpacking<U>().decompressFromPage(srcBuffer, pos, (uint8_t*)values,
+            0 /*dstOffset*/, numValuesInBatch, packedMetadata);
+        numSelected += selectInRange(values, numValuesInBatch, packedRange,
+            posInResult + (pos - srcOffset), selectedPositions + numSelected);
+        pos += numValuesInBatch;
+    }
+    return numSelected;
+}
+
 template class IntegerBitpacking<int8_t>;
 template class IntegerBitpacking<int16_t>;
 template class IntegerBitpacking<int32_t>;
@@ -546,6 +870,182 @@ template class IntegerBitpacking<uint16_t>;
 template class IntegerBitpacking<uint32_t>;
 template class IntegerBitpacking<uint64_t>;
 
+template<typename T>
+BitpackHeader FrameOfReference<T>::getBitWidth(const uint8_t* srcBuffer, uint64_t numValues) const {
+    if (numValues == 0) {
+        return BitpackHeader{0, false, 0};
+    }
+    T max = ((T*)srcBuffer)[0], min = ((T*)srcBuffer)[0];
+    for (auto i = 1u; i < numValues; i++) {
+        T value = ((T*)srcBuffer)[i];
+        if (value > max) {
+            max = value;
+        }
+        if (value < min) {
+            min = value;
+        }
+    }
+    // The subtraction is done on the unsigned type, since the range of signed values may not be
+    // representable in the signed type.
+    auto bitWidth = static_cast<uint8_t>(std::bit_width((U)((U)max - (U)min)));
+    return BitpackHeader{bitWidth, false /*hasNegative*/, (uint64_t)min};
+}
+
+template class FrameOfReference<int8_t>;
+template class FrameOfReference<int16_t>;
+template class FrameOfReference<int32_t>;
+template class FrameOfReference<int64_t>;
+template class FrameOfReference<uint8_t>;
+template class FrameOfReference<uint16_t>;
+template class FrameOfReference<uint32_t>;
+template class FrameOfReference<uint64_t>;
+
+template<typename T>
+BitpackHeader DeltaBitpacking<T>::getBitWidth(const uint8_t* srcBuffer, uint64_t numValues) const {
+    if (numValues <= 1) {
+        return BitpackHeader{0, false, 0};
+    }
+    // Deltas are computed with wrap-around on the unsigned type and compared as signed values
+    // (even for unsigned types), so that decreasing runs have small negative deltas. Decoding
+    // uses the same wrap-around arithmetic, so the values are always restored exactly.
+    using S = std::make_signed_t<T>;
+    auto values = (const U*)srcBuffer;
+    S minDelta = (S)(U)(values[1] - values[0]), maxDelta = minDelta;
+    for (auto i = 2u; i < numValues; i++) {
+        S delta = (S)(U)(values[i] - values[i - 1]);
+        if (delta < minDelta) {
+            minDelta = delta;
+        }
+        if (delta > maxDelta) {
+            maxDelta = delta;
+        }
+    }
+    auto bitWidth = static_cast<uint8_t>(std::bit_width((U)((U)maxDelta - (U)minDelta)));
+    return BitpackHeader{bitWidth, false /*hasNegative*/, (uint64_t)minDelta};
+}
+
+template<typename T>
+void DeltaBitpacking<T>::decodeBlock(const uint8_t* blockStart, uint64_t endPos, U* values,
+    const BitpackHeader& header) const {
+    KU_ASSERT(endPos <= BLOCK_SIZE);
+    if (endPos == 0) {
+        return;
+    }
+    auto packedStart = blockStart + sizeof(T);
+    if (header.bitWidth == 0) {
+        std::fill(values, values + endPos, 0);
+    } else {
+        for (auto chunkStart = 0u; chunkStart < endPos; chunkStart += CHUNK_SIZE) {
+            fastunpack(packedStart + chunkStart * header.bitWidth / 8, values + chunkStart,
+                header.bitWidth);
+        }
+    }
+    auto minDelta = (U)header.offset;
+    memcpy(&values[0], blockStart, sizeof(T));
+    for (auto i = 1u; i < endPos; i++) {
+        values[i] = (U)(values[i - 1] + values[i] + minDelta);
+    }
+}
+
+template<typename T>
+void DeltaBitpacking<T>::encodeBlock(const U* values, uint64_t numValuesInBlock,
+    uint8_t* blockStart, const BitpackHeader& header) const {
+    KU_ASSERT(numValuesInBlock > 0 && numValuesInBlock <= BLOCK_SIZE);
+    memcpy(blockStart, &values[0], sizeof(T));
+    if (header.bitWidth == 0) {
+        return;
+    }
+    // Deltas past the end of the values are left as zero
+    U deltas[BLOCK_SIZE] = {0};
+    auto minDelta = (U)header.offset;
+    for (auto i = 1u; i < numValuesInBlock; i++) {
+        deltas[i] = (U)(values[i] - values[i - 1] - minDelta);
+        KU_ASSERT(std::bit_width(deltas[i]) <= header.bitWidth);
+    }
+    auto packedStart = blockStart + sizeof(T);
+    for (auto chunkStart = 0u; chunkStart < BLOCK_SIZE; chunkStart += CHUNK_SIZE) {
+        fastpack(deltas + chunkStart, packedStart + chunkStart * header.bitWidth / 8,
+            header.bitWidth);
+    }
+}
+
+template<typename T>
+void DeltaBitpacking<T>::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
+    uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
+    const CompressionMetadata& metadata) const {
+    // Only used when the new values happen to fit the existing deltas. canUpdateInPlace is always
+    // false, so updates through the Column are always done out of place instead.
+    auto header = BitpackHeader::readHeader(metadata.data);
+    auto blockSize = getBlockSize(header.bitWidth);
+    U block[BLOCK_SIZE];
+    offset_t numValuesWritten = 0;
+    while (numValuesWritten < numValues) {
+        auto pos = dstOffset + numValuesWritten;
+        auto blockStart = dstBuffer + pos / BLOCK_SIZE * blockSize;
+        auto posInBlock = pos % BLOCK_SIZE;
+        auto numValuesToWrite = std::min(BLOCK_SIZE - posInBlock, numValues - numValuesWritten);
+        decodeBlock(blockStart, BLOCK_SIZE, block, header);
+        memcpy(block + posInBlock, srcBuffer + (srcOffset + numValuesWritten) * sizeof(T),
+            numValuesToWrite * sizeof(T));
+        encodeBlock(block, BLOCK_SIZE, blockStart, header);
+        numValuesWritten += numValuesToWrite;
+    }
+}
+
+template<typename T>
+uint64_t DeltaBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    if (metadata.compression == CompressionType::UNCOMPRESSED) {
+        return Uncompressed(sizeof(T)).compressNextPage(
+            srcBuffer, numValuesRemaining, dstBuffer, dstBufferSize, metadata);
+    }
+    KU_ASSERT(metadata.compression == CompressionType::DELTA_BITPACKING);
+    auto header = BitpackHeader::readHeader(metadata.data);
+    auto blockSize = getBlockSize(header.bitWidth);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(dstBufferSize, header));
+    KU_ASSERT(numValuesToCompress > 0);
+    auto values = (const U*)srcBuffer;
+    uint64_t compressedSize = 0;
+    for (uint64_t i = 0; i < numValuesToCompress; i += BLOCK_SIZE) {
+        encodeBlock(values + i, std::min(BLOCK_SIZE, numValuesToCompress - i),
+            dstBuffer + compressedSize, header);
+        compressedSize += blockSize;
+    }
+    KU_ASSERT(compressedSize <= dstBufferSize);
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return compressedSize;
+}
+
+template<typename T>
+void DeltaBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    auto header = BitpackHeader::readHeader(metadata.data);
+    auto blockSize = getBlockSize(header.bitWidth);
+    U block[BLOCK_SIZE];
+    uint64_t numValuesRead = 0;
+    while (numValuesRead < numValues) {
+        auto pos = srcOffset + numValuesRead;
+        auto posInBlock = pos % BLOCK_SIZE;
+        auto numValuesToRead = std::min(BLOCK_SIZE - posInBlock, numValues - numValuesRead);
+        decodeBlock(srcBuffer + pos / BLOCK_SIZE * blockSize, posInBlock + numValuesToRead, block,
+            header);
+        memcpy(dstBuffer + (dstOffset + numValuesRead) * sizeof(T), block + posInBlock,
+            numValuesToRead * sizeof(T));
+        numValuesRead += numValuesToRead;
+    }
+}
+
+template class DeltaBitpacking<int8_t>;
+template class DeltaBitpacking<int16_t>;
+template class DeltaBitpacking<int32_t>;
+template class DeltaBitpacking<int64_t>;
+template class DeltaBitpacking<uint8_t>;
+template class DeltaBitpacking<uint16_t>;
+template class DeltaBitpacking<uint32_t>;
+template class DeltaBitpacking<uint64_t>;
+
 void BooleanBitpacking::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
     uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
     const CompressionMetadata& /*metadata*/) const {
@@ -609,8 +1109,10 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         return constant.decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
             posInVector, numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
+    case CompressionType::FRAME_OF_REFERENCE:
     case CompressionType::INTEGER_BITPACKING: {
         switch (physicalType) {
         case PhysicalTypeID::INT64: {
@@ -653,9 +1155,71 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING: {
+        switch (physicalType) {
+        case PhysicalTypeID::INT64: {
+            return DeltaBitpacking<int64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT32: {
+            return DeltaBitpacking<int32_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT16: {
+            return DeltaBitpacking<int16_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT8: {
+            return DeltaBitpacking<int8_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::VAR_LIST:
+        case PhysicalTypeID::UINT64: {
+            return DeltaBitpacking<uint64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::STRING:
+        case PhysicalTypeID::UINT32: {
+            return DeltaBitpacking<uint32_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::UINT16: {
+            return DeltaBitpacking<uint16_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::UINT8: {
+            return DeltaBitpacking<uint8_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("DELTA_BITPACKING is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
+    case CompressionType::RLE:
+        return RunLengthEncoding(numBytesPerValue)
+            .decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
+                posInVector, numValuesToRead, metadata);
     default:
         KU_UNREACHABLE;
     }
@@ -669,8 +1233,10 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         return constant.copyFromPage(
             frame, pageCursor.elemPosInPage, result, startPosInResult, numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(
             frame, pageCursor.elemPosInPage, result, startPosInResult, numValuesToRead, metadata);
+    case CompressionType::FRAME_OF_REFERENCE:
     case CompressionType::INTEGER_BITPACKING: {
         switch (physicalType) {
         case PhysicalTypeID::INT64: {
@@ -713,15 +1279,133 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING: {
+        switch (physicalType) {
+        case PhysicalTypeID::INT64: {
+            return DeltaBitpacking<int64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT32: {
+            return DeltaBitpacking<int32_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT16: {
+            return DeltaBitpacking<int16_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT8: {
+            return DeltaBitpacking<int8_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::VAR_LIST:
+        case PhysicalTypeID::UINT64: {
+            return DeltaBitpacking<uint64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::STRING:
+        case PhysicalTypeID::UINT32: {
+            return DeltaBitpacking<uint32_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::UINT16: {
+            return DeltaBitpacking<uint16_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::UINT8: {
+            return DeltaBitpacking<uint8_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("DELTA_BITPACKING is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(
             frame, pageCursor.elemPosInPage, result, startPosInResult, numValuesToRead, metadata);
+    case CompressionType::RLE:
+        return RunLengthEncoding(numBytesPerValue)
+            .decompressFromPage(frame, pageCursor.elemPosInPage, result, startPosInResult,
+                numValuesToRead, metadata);
     default:
         KU_UNREACHABLE;
     }
 }
 
+std::optional<uint64_t> SelectCompressedValuesFromPage::operator()(const uint8_t* frame,
+    PageCursor& pageCursor, uint64_t numValues, const ColumnPredicate& predicate,
+    const CompressionMetadata& metadata, sel_t posInResult, sel_t* selectedPositions) {
+    switch (metadata.compression) {
+    case CompressionType::CONSTANT:
+        return constant.selectFromPage(frame, pageCursor.elemPosInPage, numValues, predicate,
+            metadata, posInResult, selectedPositions);
+    case CompressionType::UNCOMPRESSED:
+        return uncompressed.selectFromPage(frame, pageCursor.elemPosInPage, numValues, predicate,
+            metadata, posInResult, selectedPositions);
+    case CompressionType::FRAME_OF_REFERENCE:
+    case CompressionType::INTEGER_BITPACKING: {
+        switch (physicalType) {
+        case PhysicalTypeID::INT64: {
+            return IntegerBitpacking<int64_t>().selectFromPage(frame, pageCursor.elemPosInPage,
+                numValues, predicate, metadata, posInResult, selectedPositions);
+        }
+        case PhysicalTypeID::INT32: {
+            return IntegerBitpacking<int32_t>().selectFromPage(frame, pageCursor.elemPosInPage,
+                numValues, predicate, metadata, posInResult, selectedPositions);
+        }
+        case PhysicalTypeID::INT16: {
+            return IntegerBitpacking<int16_t>().selectFromPage(frame, pageCursor.elemPosInPage,
+                numValues, predicate, metadata, posInResult, selectedPositions);
+        }
+        case PhysicalTypeID::INT8: {
+            return IntegerBitpacking<int8_t>().selectFromPage(frame, pageCursor.elemPosInPage,
+                numValues, predicate, metadata, posInResult, selectedPositions);
+        }
+        case PhysicalTypeID::UINT64: {
+            return IntegerBitpacking<uint64_t>().selectFromPage(frame, pageCursor.elemPosInPage,
+                numValues, predicate, metadata, posInResult, selectedPositions);
+        }
+        case PhysicalTypeID::UINT32: {
+            return IntegerBitpacking<uint32_t>().selectFromPage(frame, pageCursor.elemPosInPage,
+                numValues, predicate, metadata, posInResult, selectedPositions);
+        }
+        case PhysicalTypeID::UINT16: {
+            return IntegerBitpacking<uint16_t>().selectFromPage(frame, pageCursor.elemPosInPage,
+                numValues, predicate, metadata, posInResult, selectedPositions);
+        }
+        case PhysicalTypeID::UINT8: {
+            return IntegerBitpacking<uint8_t>().selectFromPage(frame, pageCursor.elemPosInPage,
+                numValues, predicate, metadata, posInResult, selectedPositions);
+        }
+        default: {
+            return std::nullopt;
+        }
+        }
+    }
+    default:
+        // The values have to be decompressed before they can be compared
+        return std::nullopt;
+    }
+}
+
 void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame,
     const uint8_t* data, offset_t dataOffset, offset_t numValues,
     const CompressionMetadata& metadata) {
@@ -730,8 +1414,10 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
         return constant.setValuesFromUncompressed(
             data, dataOffset, frame, posInFrame, numValues, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.setValuesFromUncompressed(
             data, dataOffset, frame, posInFrame, numValues, metadata);
+    case CompressionType::FRAME_OF_REFERENCE:
     case CompressionType::INTEGER_BITPACKING: {
         switch (physicalType) {
         case PhysicalTypeID::INT64: {
@@ -774,9 +1460,70 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING: {
+        switch (physicalType) {
+        case PhysicalTypeID::INT64: {
+            return DeltaBitpacking<int64_t>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        case PhysicalTypeID::INT32: {
+            return DeltaBitpacking<int32_t>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        case PhysicalTypeID::INT16: {
+            return DeltaBitpacking<int16_t>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        case PhysicalTypeID::INT8: {
+            return DeltaBitpacking<int8_t>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        case PhysicalTypeID::VAR_LIST:
+        case PhysicalTypeID::UINT64: {
+            return DeltaBitpacking<uint64_t>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        case PhysicalTypeID::STRING:
+        case PhysicalTypeID::UINT32: {
+            return DeltaBitpacking<uint32_t>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        case PhysicalTypeID::UINT16: {
+            return DeltaBitpacking<uint16_t>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        case PhysicalTypeID::UINT8: {
+            return DeltaBitpacking<uint8_t>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        default: {
+            throw NotImplementedException("DELTA_BITPACKING is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.copyFromPage(
             data, dataOffset, frame, posInFrame, numValues, metadata);
+    case CompressionType::RLE:
+        return RunLengthEncoding(numBytesPerValue)
+            .setValuesFromUncompressed(data, dataOffset, frame, posInFrame, numValues, metadata);
 
     default:
         KU_UNREACHABLE;
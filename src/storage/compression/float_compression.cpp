@@ -0,0 +1,318 @@
+#include "storage/compression/float_compression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+#include "common/constants.h"
+#include "fastpfor/bitpackinghelpers.h"
+#include <bit>
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+template<typename T>
+struct ALPConstants;
+
+template<>
+struct ALPConstants<double> {
+    static constexpr uint8_t MAX_EXPONENT = 18;
+    static constexpr double EXP10[] = {1.0, 10.0, 100.0, 1000.0, 10000.0, 100000.0, 1000000.0,
+        10000000.0, 100000000.0, 1000000000.0, 10000000000.0, 100000000000.0, 1000000000000.0,
+        10000000000000.0, 100000000000000.0, 1000000000000000.0, 10000000000000000.0,
+        100000000000000000.0, 1000000000000000000.0};
+    static constexpr double FRAC10[] = {1.0, 0.1, 0.01, 0.001, 0.0001, 0.00001, 0.000001,
+        0.0000001, 0.00000001, 0.000000001, 0.0000000001, 0.00000000001, 0.000000000001,
+        0.0000000000001, 0.00000000000001, 0.000000000000001, 0.0000000000000001,
+        0.00000000000000001, 0.000000000000000001};
+    // Encoded values are limited to 2^62 so that rounding can't overflow int64_t
+    static constexpr double ENCODING_LIMIT = 4611686018427387904.0;
+};
+
+template<>
+struct ALPConstants<float> {
+    static constexpr uint8_t MAX_EXPONENT = 10;
+    static constexpr float EXP10[] = {1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f, 100000.0f,
+        1000000.0f, 10000000.0f, 100000000.0f, 1000000000.0f, 10000000000.0f};
+    static constexpr float FRAC10[] = {1.0f, 0.1f, 0.01f, 0.001f, 0.0001f, 0.00001f, 0.000001f,
+        0.0000001f, 0.00000001f, 0.000000001f, 0.0000000001f};
+    // Encoded values are limited to 2^30 so that rounding can't overflow int32_t
+    static constexpr float ENCODING_LIMIT = 1073741824.0f;
+};
+
+std::array<uint8_t, CompressionMetadata::DATA_SIZE> ALPHeader::getData() const {
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> data = {bitWidth, exponent, factor};
+    memcpy(&data[3], &exceptionCapacity, sizeof(exceptionCapacity));
+    return data;
+}
+
+ALPHeader ALPHeader::readHeader(const std::array<uint8_t, CompressionMetadata::DATA_SIZE>& data) {
+    ALPHeader header;
+    header.bitWidth = data[0];
+    header.exponent = data[1];
+    header.factor = data[2];
+    memcpy(&header.exceptionCapacity, &data[3], sizeof(header.exceptionCapacity));
+    return header;
+}
+
+template<typename T>
+bool FloatCompression<T>::encode(T value, uint8_t exponent, uint8_t factor, EncodedType& encoded) {
+    using constants = ALPConstants<T>;
+    T scaled = value * constants::EXP10[exponent] * constants::FRAC10[factor];
+    // Also false for NaN
+    if (!(scaled >= -constants::ENCODING_LIMIT && scaled <= constants::ENCODING_LIMIT)) {
+        return false;
+    }
+    encoded = static_cast<EncodedType>(std::llround(scaled));
+    auto decoded = decode(encoded, exponent, factor);
+    // Compared bitwise, so that -0.0 is stored as an exception instead of being decoded as 0.0
+    return memcmp(&decoded, &value, sizeof(T)) == 0;
+}
+
+template<typename T>
+T FloatCompression<T>::decode(EncodedType encoded, uint8_t exponent, uint8_t factor) {
+    using constants = ALPConstants<T>;
+    return static_cast<T>(encoded) * constants::EXP10[factor] * constants::FRAC10[exponent];
+}
+
+template<typename T>
+uint64_t FloatCompression<T>::numValues(uint64_t dataSize, const ALPHeader& header) {
+    auto reservedSize = PAGE_HEADER_SIZE + getExceptionsSize(header);
+    if (dataSize <= reservedSize) {
+        return 0;
+    }
+    auto numValues = header.bitWidth == 0 ? MAX_VALUES_PER_PAGE :
+                                            (dataSize - reservedSize) * 8 / header.bitWidth;
+    numValues = std::min(numValues, MAX_VALUES_PER_PAGE);
+    // Round down to nearest multiple of CHUNK_SIZE so that only full chunks are packed
+    return numValues - numValues % CHUNK_SIZE;
+}
+
+template<typename T>
+std::pair<uint8_t, uint8_t> FloatCompression<T>::chooseExponentAndFactor(
+    const T* values, uint64_t numValues) const {
+    // Exponent and factor are chosen from an evenly spaced sample of the values, minimizing the
+    // estimated size of the bitpacked values plus the exceptions.
+    static constexpr uint64_t SAMPLE_SIZE = 1024;
+    static constexpr uint64_t EXCEPTION_SIZE_IN_BITS = (sizeof(T) + sizeof(uint16_t)) * 8;
+    auto step = std::max<uint64_t>(1, numValues / SAMPLE_SIZE);
+    uint8_t bestExponent = 0, bestFactor = 0;
+    uint64_t bestSize = UINT64_MAX;
+    for (uint8_t exponent = 0; exponent <= ALPConstants<T>::MAX_EXPONENT; exponent++) {
+        for (uint8_t factor = 0; factor <= exponent; factor++) {
+            EncodedType min = 0, max = 0;
+            uint64_t numEncoded = 0, numExceptions = 0;
+            for (auto i = 0u; i < numValues; i += step) {
+                EncodedType encoded;
+                if (!encode(values[i], exponent, factor, encoded)) {
+                    numExceptions++;
+                    continue;
+                }
+                if (numEncoded++ == 0) {
+                    min = max = encoded;
+                } else {
+                    min = std::min(min, encoded);
+                    max = std::max(max, encoded);
+                }
+            }
+            auto bitWidth = std::bit_width((EncodedUType)((EncodedUType)max - (EncodedUType)min));
+            auto size = numEncoded * bitWidth + numExceptions * EXCEPTION_SIZE_IN_BITS;
+            if (size < bestSize) {
+                bestSize = size;
+                bestExponent = exponent;
+                bestFactor = factor;
+            }
+        }
+    }
+    return {bestExponent, bestFactor};
+}
+
+template<typename T>
+CompressionMetadata FloatCompression<T>::getCompressionMetadata(
+    const uint8_t* srcBuffer, uint64_t numValues) const {
+    if (numValues == 0) {
+        return CompressionMetadata();
+    }
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    ALPHeader header{};
+    std::tie(header.exponent, header.factor) = chooseExponentAndFactor(values, numValues);
+    EncodedType min = 0, max = 0;
+    bool hasEncoded = false;
+    std::vector<uint64_t> exceptionPositions;
+    for (auto i = 0u; i < numValues; i++) {
+        EncodedType encoded;
+        if (!encode(values[i], header.exponent, header.factor, encoded)) {
+            exceptionPositions.push_back(i);
+            continue;
+        }
+        if (!hasEncoded) {
+            min = max = encoded;
+            hasEncoded = true;
+        } else {
+            min = std::min(min, encoded);
+            max = std::max(max, encoded);
+        }
+    }
+    header.bitWidth = std::bit_width((EncodedUType)((EncodedUType)max - (EncodedUType)min));
+    if (header.bitWidth >= sizeof(T) * 8) {
+        return CompressionMetadata();
+    }
+    // The exception area is the same size in every page, so it needs to fit the page with the
+    // most exceptions. Reserving space for exceptions reduces the number of values per page, which
+    // changes which values end up on the same page, so iterate until the capacity is stable.
+    static constexpr uint64_t MAX_ITERATIONS = 8;
+    for (auto iteration = 0u; iteration < MAX_ITERATIONS; iteration++) {
+        auto numValuesPerPage = this->numValues(BufferPoolConstants::PAGE_4KB_SIZE, header);
+        if (numValuesPerPage == 0) {
+            break;
+        }
+        uint64_t maxExceptionsInPage = 0, numExceptionsInPage = 0;
+        uint64_t pageIdx = 0;
+        for (auto position : exceptionPositions) {
+            if (position / numValuesPerPage != pageIdx) {
+                pageIdx = position / numValuesPerPage;
+                numExceptionsInPage = 0;
+            }
+            maxExceptionsInPage = std::max(maxExceptionsInPage, ++numExceptionsInPage);
+        }
+        if (maxExceptionsInPage <= header.exceptionCapacity) {
+            if (numValuesPerPage <= BufferPoolConstants::PAGE_4KB_SIZE / sizeof(T)) {
+                // The exceptions take up more space than is saved by packing the other values
+                break;
+            }
+            return CompressionMetadata(CompressionType::ALP, header.getData());
+        }
+        if (maxExceptionsInPage > UINT16_MAX) {
+            break;
+        }
+        header.exceptionCapacity = maxExceptionsInPage;
+    }
+    // Too many exceptions to be worth compressing
+    return CompressionMetadata();
+}
+
+template<typename T>
+uint64_t FloatCompression<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    if (metadata.compression == CompressionType::UNCOMPRESSED) {
+        return Uncompressed(sizeof(T)).compressNextPage(
+            srcBuffer, numValuesRemaining, dstBuffer, dstBufferSize, metadata);
+    }
+    KU_ASSERT(metadata.compression == CompressionType::ALP);
+    auto header = ALPHeader::readHeader(metadata.data);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(dstBufferSize, header));
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+
+    std::vector<EncodedType> encodedValues(numValuesToCompress);
+    std::vector<uint16_t> exceptionPositions;
+    EncodedType frameOfReference = 0;
+    bool hasEncoded = false;
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        if (!encode(values[i], header.exponent, header.factor, encodedValues[i])) {
+            exceptionPositions.push_back(i);
+            continue;
+        }
+        if (!hasEncoded || encodedValues[i] < frameOfReference) {
+            frameOfReference = encodedValues[i];
+            hasEncoded = true;
+        }
+    }
+    KU_ASSERT(exceptionPositions.size() <= header.exceptionCapacity);
+    uint32_t numExceptions = exceptionPositions.size();
+    memcpy(dstBuffer, &frameOfReference, sizeof(EncodedType));
+    memcpy(dstBuffer + sizeof(EncodedType), &numExceptions, sizeof(uint32_t));
+    auto exceptionValues = dstBuffer + PAGE_HEADER_SIZE;
+    auto exceptionPositionsStart = exceptionValues + header.exceptionCapacity * sizeof(T);
+    for (auto i = 0u; i < numExceptions; i++) {
+        auto position = exceptionPositions[i];
+        memcpy(exceptionValues + i * sizeof(T), &values[position], sizeof(T));
+        memcpy(exceptionPositionsStart + i * sizeof(uint16_t), &position, sizeof(uint16_t));
+        // Exceptions are stored as the frame of reference, so they pack to zero
+        encodedValues[position] = frameOfReference;
+    }
+
+    auto packedStart = dstBuffer + PAGE_HEADER_SIZE + getExceptionsSize(header);
+    auto bytesPerChunk = CHUNK_SIZE * header.bitWidth / 8;
+    auto numChunks = (numValuesToCompress + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    if (header.bitWidth > 0) {
+        EncodedUType chunk[CHUNK_SIZE];
+        for (auto chunkIdx = 0u; chunkIdx < numChunks; chunkIdx++) {
+            auto chunkStart = chunkIdx * CHUNK_SIZE;
+            auto numValuesInChunk = std::min(CHUNK_SIZE, numValuesToCompress - chunkStart);
+            for (auto i = 0u; i < numValuesInChunk; i++) {
+                chunk[i] = (EncodedUType)encodedValues[chunkStart + i] -
+                           (EncodedUType)frameOfReference;
+            }
+            std::fill(chunk + numValuesInChunk, chunk + CHUNK_SIZE, 0);
+            FastPForLib::fastpack(
+                chunk, (uint32_t*)(packedStart + chunkIdx * bytesPerChunk), header.bitWidth);
+        }
+    }
+    srcBuffer += numValuesToCompress * sizeof(T);
+    auto compressedSize = packedStart - dstBuffer + numChunks * bytesPerChunk;
+    KU_ASSERT(compressedSize <= dstBufferSize);
+    return compressedSize;
+}
+
+template<typename T>
+void FloatCompression<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    using constants = ALPConstants<T>;
+    auto header = ALPHeader::readHeader(metadata.data);
+    EncodedType frameOfReference;
+    uint32_t numExceptions;
+    memcpy(&frameOfReference, srcBuffer, sizeof(EncodedType));
+    memcpy(&numExceptions, srcBuffer + sizeof(EncodedType), sizeof(uint32_t));
+    auto packedStart = srcBuffer + PAGE_HEADER_SIZE + getExceptionsSize(header);
+    auto bytesPerChunk = CHUNK_SIZE * header.bitWidth / 8;
+    auto result = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    // Same operations as decode, hoisted out of the loop
+    auto factorMultiplier = constants::EXP10[header.factor];
+    auto exponentFraction = constants::FRAC10[header.exponent];
+
+    // Values are unpacked one chunk at a time and decoded with a branch-free loop which the
+    // compiler can vectorize.
+    EncodedUType chunk[CHUNK_SIZE] = {0};
+    auto end = srcOffset + numValues;
+    for (auto pos = srcOffset; pos < end;) {
+        auto posInChunk = pos % CHUNK_SIZE;
+        auto numValuesInChunk = std::min(CHUNK_SIZE - posInChunk, end - pos);
+        if (header.bitWidth > 0) {
+            FastPForLib::fastunpack(
+                (const uint32_t*)(packedStart + pos / CHUNK_SIZE * bytesPerChunk), chunk,
+                header.bitWidth);
+        }
+        auto out = result + (pos - srcOffset);
+        for (auto i = 0u; i < numValuesInChunk; i++) {
+            auto encoded = (EncodedType)(chunk[posInChunk + i] + (EncodedUType)frameOfReference);
+            out[i] = static_cast<T>(encoded) * factorMultiplier * exponentFraction;
+        }
+        pos += numValuesInChunk;
+    }
+
+    // Patch the exceptions within the range
+    auto exceptionValues = srcBuffer + PAGE_HEADER_SIZE;
+    auto exceptionPositions = reinterpret_cast<const uint16_t*>(
+        exceptionValues + header.exceptionCapacity * sizeof(T));
+    auto firstException = std::lower_bound(
+        exceptionPositions, exceptionPositions + numExceptions, (uint16_t)srcOffset);
+    for (auto exception = firstException; exception < exceptionPositions + numExceptions;
+         exception++) {
+        if (*exception >= end) {
+            break;
+        }
+        memcpy(&result[*exception - srcOffset],
+            exceptionValues + (exception - exceptionPositions) * sizeof(T), sizeof(T));
+    }
+}
+
+template class FloatCompression<double>;
+template class FloatCompression<float>;
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,167 @@
+#include "storage/compression/fsst.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include "common/assert.h"
+
+namespace kuzu {
+namespace storage {
+
+// The symbol table is built from a sample of roughly this many bytes.
+static constexpr uint64_t SAMPLE_SIZE = 16384;
+// Number of rounds in which the symbol table is refined using the previous table.
+static constexpr uint64_t NUM_GENERATIONS = 5;
+
+FSSTSymbolTable::FSSTSymbolTable() : numSymbols{0}, symbols{}, lengths{} {}
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<std::string_view>& strings) {
+    uint64_t totalSize = 0;
+    for (auto value : strings) {
+        totalSize += value.size();
+    }
+    std::vector<std::string_view> sample;
+    uint64_t sampleSize = 0;
+    auto step = std::max<uint64_t>(1, totalSize / SAMPLE_SIZE);
+    for (auto i = 0u; i < strings.size() && sampleSize < SAMPLE_SIZE; i += step) {
+        sample.push_back(strings[i]);
+        sampleSize += strings[i].size();
+    }
+
+    FSSTSymbolTable table;
+    for (auto generation = 0u; generation < NUM_GENERATIONS; generation++) {
+        // Count how often each symbol of the current table is used when encoding the sample, as
+        // well as each concatenation of two consecutive symbols, which are the candidates for
+        // longer symbols in the next table.
+        std::unordered_map<std::string, uint64_t> counts;
+        for (auto value : sample) {
+            std::string_view prev;
+            while (!value.empty()) {
+                auto code = table.findLongestSymbol(value);
+                auto length = code == ESCAPE_CODE ? 1 : table.lengths[code];
+                auto symbol = value.substr(0, length);
+                counts[std::string(symbol)]++;
+                if (!prev.empty() && prev.size() + symbol.size() <= MAX_SYMBOL_LENGTH) {
+                    // prev directly precedes symbol in the value
+                    counts[std::string(prev.data(), prev.size() + symbol.size())]++;
+                }
+                prev = symbol;
+                value.remove_prefix(length);
+            }
+        }
+        // Keep the symbols which cover the most bytes of the sample
+        std::vector<std::pair<uint64_t, std::string>> candidates;
+        candidates.reserve(counts.size());
+        for (auto& [symbol, count] : counts) {
+            candidates.emplace_back(count * symbol.size(), symbol);
+        }
+        auto numCandidates = std::min<uint64_t>(MAX_NUM_SYMBOLS, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + numCandidates, candidates.end(),
+            [](const auto& a, const auto& b) {
+                return a.first > b.first || (a.first == b.first && a.second < b.second);
+            });
+        table = FSSTSymbolTable();
+        for (auto i = 0u; i < numCandidates; i++) {
+            table.addSymbol(candidates[i].second);
+        }
+    }
+    return table;
+}
+
+void FSSTSymbolTable::addSymbol(std::string_view symbol) {
+    KU_ASSERT(numSymbols < MAX_NUM_SYMBOLS);
+    KU_ASSERT(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH);
+    auto code = numSymbols++;
+    memcpy(symbols[code].data(), symbol.data(), symbol.size());
+    lengths[code] = symbol.size();
+    auto& codes = codesByFirstByte[(uint8_t)symbol[0]];
+    auto position = std::find_if(
+        codes.begin(), codes.end(), [&](uint8_t other) { return lengths[other] < symbol.size(); });
+    codes.insert(position, code);
+}
+
+uint8_t FSSTSymbolTable::findLongestSymbol(std::string_view value) const {
+    KU_ASSERT(!value.empty());
+    for (auto code : codesByFirstByte[(uint8_t)value[0]]) {
+        auto length = lengths[code];
+        if (length <= value.size() && memcmp(symbols[code].data(), value.data(), length) == 0) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+void FSSTSymbolTable::encode(std::string_view value, std::string& result) const {
+    while (!value.empty()) {
+        auto code = findLongestSymbol(value);
+        result.push_back((char)code);
+        if (code == ESCAPE_CODE) {
+            result.push_back(value[0]);
+            value.remove_prefix(1);
+        } else {
+            value.remove_prefix(lengths[code]);
+        }
+    }
+}
+
+uint64_t FSSTSymbolTable::getDecodedSize(const uint8_t* data, uint64_t size) const {
+    uint64_t decodedSize = 0;
+    for (auto i = 0u; i < size; i++) {
+        if (data[i] == ESCAPE_CODE) {
+            // Skip the escaped byte
+            i++;
+            decodedSize++;
+        } else {
+            decodedSize += lengths[data[i]];
+        }
+    }
+    return decodedSize;
+}
+
+void FSSTSymbolTable::decode(const uint8_t* data, uint64_t size, uint8_t* result) const {
+    for (auto i = 0u; i < size; i++) {
+        auto code = data[i];
+        if (code == ESCAPE_CODE) {
+            KU_ASSERT(i + 1 < size);
+            *result++ = data[++i];
+        } else {
+            KU_ASSERT(code < numSymbols);
+            memcpy(result, symbols[code].data(), lengths[code]);
+            result += lengths[code];
+        }
+    }
+}
+
+uint64_t FSSTSymbolTable::getSerializedSize() const {
+    uint64_t size = 1 + numSymbols;
+    for (auto i = 0u; i < numSymbols; i++) {
+        size += lengths[i];
+    }
+    return size;
+}
+
+void FSSTSymbolTable::serialize(uint8_t* buffer) const {
+    *buffer++ = numSymbols;
+    memcpy(buffer, lengths.data(), numSymbols);
+    buffer += numSymbols;
+    for (auto i = 0u; i < numSymbols; i++) {
+        memcpy(buffer, symbols[i].data(), lengths[i]);
+        buffer += lengths[i];
+    }
+}
+
+FSSTSymbolTable FSSTSymbolTable::deserialize(const uint8_t* buffer) {
+    FSSTSymbolTable table;
+    auto numSymbols = *buffer++;
+    auto symbolLengths = buffer;
+    buffer += numSymbols;
+    for (auto i = 0u; i < numSymbols; i++) {
+        table.addSymbol(std::string_view((const char*)buffer, symbolLengths[i]));
+        buffer += symbolLengths[i];
+    }
+    return table;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,183 @@
+#include "storage/compression/run_length_encoding.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "common/constants.h"
+#include "common/types/int128_t.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+static std::vector<uint64_t> getRunStarts(
+    const uint8_t* values, uint64_t numValues, uint32_t numBytesPerValue) {
+    std::vector<uint64_t> runStarts;
+    for (auto i = 1u; i < numValues; i++) {
+        if (memcmp(values + (i - 1) * numBytesPerValue, values + i * numBytesPerValue,
+                numBytesPerValue) != 0) {
+            runStarts.push_back(i);
+        }
+    }
+    return runStarts;
+}
+
+// Returns true if no page of numValuesPerPage values contains more than runCapacity runs.
+static bool fitsInPages(
+    const std::vector<uint64_t>& runStarts, uint64_t numValuesPerPage, uint64_t runCapacity) {
+    uint64_t currentPage = 0;
+    // Every page starts with a run
+    uint64_t numRunsInPage = 1;
+    for (auto runStart : runStarts) {
+        auto page = runStart / numValuesPerPage;
+        if (page != currentPage) {
+            currentPage = page;
+            numRunsInPage = 1;
+        }
+        if (runStart % numValuesPerPage != 0) {
+            numRunsInPage++;
+        }
+        if (numRunsInPage > runCapacity) {
+            return false;
+        }
+    }
+    return true;
+}
+
+CompressionMetadata RunLengthEncoding::getCompressionMetadata(
+    const uint8_t* srcBuffer, uint64_t numValues) const {
+    auto runStarts = getRunStarts(srcBuffer, numValues, numBytesPerValue);
+    auto runCapacity = getRunCapacity(BufferPoolConstants::PAGE_4KB_SIZE);
+    KU_ASSERT(runCapacity > 0);
+    // Pages of a single value always fit, so binary search for the largest number of values per
+    // page which fits
+    uint64_t low = 1, high = MAX_VALUES_PER_PAGE;
+    while (low < high) {
+        auto mid = (low + high + 1) / 2;
+        if (fitsInPages(runStarts, mid, runCapacity)) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> data{};
+    auto numValuesPerPage = static_cast<uint32_t>(low);
+    memcpy(data.data(), &numValuesPerPage, sizeof(numValuesPerPage));
+    return CompressionMetadata(CompressionType::RLE, data);
+}
+
+uint64_t RunLengthEncoding::numValues(const CompressionMetadata& metadata) {
+    uint32_t numValuesPerPage;
+    memcpy(&numValuesPerPage, metadata.data.data(), sizeof(numValuesPerPage));
+    return numValuesPerPage;
+}
+
+uint64_t RunLengthEncoding::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const CompressionMetadata& metadata) const {
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(metadata));
+    auto runCapacity = static_cast<uint32_t>(getRunCapacity(dstBufferSize));
+    auto runEnds = reinterpret_cast<uint16_t*>(dstBuffer + PAGE_HEADER_SIZE);
+    auto runValues = dstBuffer + PAGE_HEADER_SIZE + runCapacity * sizeof(uint16_t);
+    uint32_t numRuns = 0;
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        auto value = srcBuffer + i * numBytesPerValue;
+        if (i == 0 || memcmp(value - numBytesPerValue, value, numBytesPerValue) != 0) {
+            KU_ASSERT(numRuns < runCapacity);
+            memcpy(runValues + numRuns * numBytesPerValue, value, numBytesPerValue);
+            numRuns++;
+        }
+        runEnds[numRuns - 1] = static_cast<uint16_t>(i);
+    }
+    memcpy(dstBuffer, &numRuns, sizeof(numRuns));
+    memcpy(dstBuffer + sizeof(numRuns), &runCapacity, sizeof(runCapacity));
+    srcBuffer += numValuesToCompress * numBytesPerValue;
+    return PAGE_HEADER_SIZE + runCapacity * sizeof(uint16_t) + numRuns * numBytesPerValue;
+}
+
+uint32_t RunLengthEncoding::findRun(const uint8_t* page, uint64_t pos) const {
+    uint32_t numRuns;
+    memcpy(&numRuns, page, sizeof(numRuns));
+    auto runEnds = reinterpret_cast<const uint16_t*>(page + PAGE_HEADER_SIZE);
+    auto run = std::lower_bound(runEnds, runEnds + numRuns, pos) - runEnds;
+    KU_ASSERT((uint32_t)run < numRuns);
+    return run;
+}
+
+template<typename T>
+static inline void fillValue(uint8_t* dst, const uint8_t* value, uint64_t numValues) {
+    T typedValue;
+    memcpy(&typedValue, value, sizeof(T));
+    std::fill_n(reinterpret_cast<T*>(dst), numValues, typedValue);
+}
+
+void RunLengthEncoding::fill(uint8_t* dst, const uint8_t* value, uint64_t numValues) const {
+    switch (numBytesPerValue) {
+    case 1: {
+        return fillValue<uint8_t>(dst, value, numValues);
+    }
+    case 2: {
+        return fillValue<uint16_t>(dst, value, numValues);
+    }
+    case 4: {
+        return fillValue<uint32_t>(dst, value, numValues);
+    }
+    case 8: {
+        return fillValue<uint64_t>(dst, value, numValues);
+    }
+    case 16: {
+        return fillValue<int128_t>(dst, value, numValues);
+    }
+    default: {
+        for (auto i = 0u; i < numValues; i++) {
+            memcpy(dst + i * numBytesPerValue, value, numBytesPerValue);
+        }
+    }
+    }
+}
+
+void RunLengthEncoding::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& /*metadata*/) const {
+    if (numValues == 0) {
+        return;
+    }
+    uint32_t runCapacity;
+    memcpy(&runCapacity, srcBuffer + sizeof(uint32_t), sizeof(runCapacity));
+    auto runEnds = reinterpret_cast<const uint16_t*>(srcBuffer + PAGE_HEADER_SIZE);
+    auto runValues = srcBuffer + PAGE_HEADER_SIZE + runCapacity * sizeof(uint16_t);
+    uint32_t numRuns;
+    memcpy(&numRuns, srcBuffer, sizeof(numRuns));
+    auto dst = dstBuffer + dstOffset * numBytesPerValue;
+    // Positions past the end of the last run were never written
+    if (numRuns == 0 || runEnds[numRuns - 1] < srcOffset) {
+        memset(dst, 0, numValues * numBytesPerValue);
+        return;
+    }
+    auto run = findRun(srcBuffer, srcOffset);
+    auto pos = srcOffset;
+    auto endPos = srcOffset + numValues;
+    while (pos < endPos) {
+        if (run == numRuns) {
+            memset(dst, 0, (endPos - pos) * numBytesPerValue);
+            return;
+        }
+        auto numValuesInRun = std::min<uint64_t>(runEnds[run] + 1, endPos) - pos;
+        fill(dst, runValues + run * numBytesPerValue, numValuesInRun);
+        dst += numValuesInRun * numBytesPerValue;
+        pos += numValuesInRun;
+        run++;
+    }
+}
+
+bool RunLengthEncoding::isSingleRun(
+    const uint8_t* srcBuffer, uint64_t srcOffset, uint64_t numValues) const {
+    auto runEnds = reinterpret_cast<const uint16_t*>(srcBuffer + PAGE_HEADER_SIZE);
+    return runEnds[findRun(srcBuffer, srcOffset)] >= srcOffset + numValues - 1;
+}
+
+} // namespace storage
+} // namespace kuzu
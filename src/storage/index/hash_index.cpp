@@ -125,9 +125,12 @@ HashIndex<T, S>::HashIndex(const DBFileIDAndName& dbFileIDAndName,
 // - the key has been marked as deleted in the local storage, return false;
 // - the key is neither deleted nor found in the local storage, lookup in the persistent
 // storage.
+// The local storage is also skipped for concurrent write transactions which do not own the table,
+// as it holds the uncommitted changes of the concurrent write transaction owning the table.
 template<typename T, typename S>
 bool HashIndex<T, S>::lookupInternal(Transaction* transaction, T key, offset_t& result) {
-    if (transaction->isReadOnly()) {
+    if (transaction->isReadOnly() ||
+        !transaction->ownsTable(dbFileIDAndName.dbFileID.nodeIndexID.tableID)) {
         return lookupInPersistentIndex(transaction->getType(), key, result);
     } else {
         KU_ASSERT(transaction->isWriteTransaction());
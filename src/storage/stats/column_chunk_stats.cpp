@@ -0,0 +1,231 @@
+#include "storage/stats/column_chunk_stats.h"
+
+#include "common/assert.h"
+#include "common/types/value/value.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+std::optional<StorageValue> StorageValue::fromValue(const Value& value) {
+    if (value.isNull()) {
+        return std::nullopt;
+    }
+    switch (value.getDataType()->getPhysicalType()) {
+    case PhysicalTypeID::INT64:
+        return StorageValue::create(value.val.int64Val);
+    case PhysicalTypeID::INT32:
+        return StorageValue::create(value.val.int32Val);
+    case PhysicalTypeID::INT16:
+        return StorageValue::create(value.val.int16Val);
+    case PhysicalTypeID::INT8:
+        return StorageValue::create(value.val.int8Val);
+    case PhysicalTypeID::UINT64:
+        return StorageValue::create(value.val.uint64Val);
+    case PhysicalTypeID::UINT32:
+        return StorageValue::create(value.val.uint32Val);
+    case PhysicalTypeID::UINT16:
+        return StorageValue::create(value.val.uint16Val);
+    case PhysicalTypeID::UINT8:
+        return StorageValue::create(value.val.uint8Val);
+    case PhysicalTypeID::DOUBLE:
+        return StorageValue::create(value.val.doubleVal);
+    case PhysicalTypeID::FLOAT:
+        return StorageValue::create(value.val.floatVal);
+    default:
+        return std::nullopt;
+    }
+}
+
+bool ColumnChunkStats::isSupported(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+template<typename T>
+static inline T& getTypedValue(StorageValue& value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return value.floatVal;
+    } else if constexpr (std::is_signed_v<T>) {
+        return value.signedInt;
+    } else {
+        return value.unsignedInt;
+    }
+}
+
+template<typename T>
+static inline T getTypedValue(const StorageValue& value) {
+    return getTypedValue<T>(const_cast<StorageValue&>(value));
+}
+
+double StorageValue::toDouble(PhysicalTypeID physicalType) const {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+        return (double)getTypedValue<int64_t>(*this);
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+        return (double)getTypedValue<uint64_t>(*this);
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return getTypedValue<double>(*this);
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
+template<typename T>
+static bool updateTyped(ColumnChunkStats& stats, StorageValue value) {
+    auto typedValue = getTypedValue<T>(value);
+    if constexpr (std::is_floating_point_v<T>) {
+        // NaN never satisfies a comparison, so it does not need to be covered by the range.
+        if (typedValue != typedValue) {
+            return false;
+        }
+    }
+    if (!stats.hasValues) {
+        getTypedValue<T>(stats.min) = typedValue;
+        getTypedValue<T>(stats.max) = typedValue;
+        stats.hasValues = true;
+        return true;
+    }
+    if (typedValue < getTypedValue<T>(stats.min)) {
+        getTypedValue<T>(stats.min) = typedValue;
+        return true;
+    }
+    if (typedValue > getTypedValue<T>(stats.max)) {
+        getTypedValue<T>(stats.max) = typedValue;
+        return true;
+    }
+    return false;
+}
+
+bool ColumnChunkStats::update(StorageValue value, PhysicalTypeID physicalType) {
+    if (!hasStats) {
+        return false;
+    }
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+        return updateTyped<int64_t>(*this, value);
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+        return updateTyped<uint64_t>(*this, value);
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return updateTyped<double>(*this, value);
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
+template<typename T>
+static inline StorageValue readValue(const uint8_t* data, offset_t pos) {
+    return StorageValue::create(reinterpret_cast<const T*>(data)[pos]);
+}
+
+bool ColumnChunkStats::update(const uint8_t* data, offset_t pos, PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return update(readValue<int64_t>(data, pos), physicalType);
+    case PhysicalTypeID::INT32:
+        return update(readValue<int32_t>(data, pos), physicalType);
+    case PhysicalTypeID::INT16:
+        return update(readValue<int16_t>(data, pos), physicalType);
+    case PhysicalTypeID::INT8:
+        return update(readValue<int8_t>(data, pos), physicalType);
+    case PhysicalTypeID::UINT64:
+        return update(readValue<uint64_t>(data, pos), physicalType);
+    case PhysicalTypeID::UINT32:
+        return update(readValue<uint32_t>(data, pos), physicalType);
+    case PhysicalTypeID::UINT16:
+        return update(readValue<uint16_t>(data, pos), physicalType);
+    case PhysicalTypeID::UINT8:
+        return update(readValue<uint8_t>(data, pos), physicalType);
+    case PhysicalTypeID::DOUBLE:
+        return update(readValue<double>(data, pos), physicalType);
+    case PhysicalTypeID::FLOAT:
+        return update(readValue<float>(data, pos), physicalType);
+    default: {
+        // Values of unsupported types can't be tracked, so the statistics are no longer valid.
+        auto changed = hasStats;
+        hasStats = false;
+        return changed;
+    }
+    }
+}
+
+template<typename T>
+static bool canSkipTyped(const ColumnChunkStats& stats, const ColumnPredicate& predicate) {
+    auto min = getTypedValue<T>(stats.min);
+    auto max = getTypedValue<T>(stats.max);
+    auto value = getTypedValue<T>(predicate.value);
+    switch (predicate.comparison) {
+    case ExpressionType::EQUALS:
+        return value < min || value > max;
+    case ExpressionType::GREATER_THAN:
+        return max <= value;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return max < value;
+    case ExpressionType::LESS_THAN:
+        return min >= value;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return min > value;
+    default:
+        return false;
+    }
+}
+
+bool ColumnChunkStats::canSkip(
+    const ColumnPredicate& predicate, PhysicalTypeID physicalType) const {
+    if (!hasStats) {
+        return false;
+    }
+    if (!hasValues) {
+        return true;
+    }
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+        return canSkipTyped<int64_t>(*this, predicate);
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+        return canSkipTyped<uint64_t>(*this, predicate);
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return canSkipTyped<double>(*this, predicate);
+    default:
+        return false;
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
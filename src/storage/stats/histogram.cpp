@@ -0,0 +1,115 @@
+#include "storage/stats/histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+EquiDepthHistogram EquiDepthHistogram::build(std::vector<double> sample, uint64_t numValues) {
+    EquiDepthHistogram result;
+    // NaN doesn't compare with anything, so it isn't covered by the histogram.
+    std::erase_if(sample, [](double value) { return std::isnan(value); });
+    if (sample.empty() || numValues == 0) {
+        return result;
+    }
+    std::sort(sample.begin(), sample.end());
+    result.numValues = numValues;
+    result.boundaries.resize(NUM_BUCKETS + 1);
+    for (auto i = 0u; i <= NUM_BUCKETS; i++) {
+        auto pos = std::llround((double)i * (double)(sample.size() - 1) / NUM_BUCKETS);
+        result.boundaries[i] = sample[pos];
+    }
+    return result;
+}
+
+double EquiDepthHistogram::estimateFractionBelow(double value, bool inclusive) const {
+    if (isEmpty()) {
+        return 0;
+    }
+    double numBuckets = 0;
+    for (auto i = 0u; i < NUM_BUCKETS; i++) {
+        auto lower = boundaries[i];
+        auto upper = boundaries[i + 1];
+        if (upper < value || (inclusive && upper == value)) {
+            numBuckets += 1;
+        } else if (lower < value && value <= upper) {
+            numBuckets += (value - lower) / (upper - lower);
+        }
+    }
+    return numBuckets / NUM_BUCKETS;
+}
+
+void EquiDepthHistogram::merge(const EquiDepthHistogram& other) {
+    if (other.isEmpty()) {
+        return;
+    }
+    if (isEmpty()) {
+        *this = other;
+        return;
+    }
+    // Fraction of the merged values less than (or equal to) value
+    auto totalNumValues = numValues + other.numValues;
+    auto estimateMerged = [&](double value, bool inclusive) {
+        return (estimateFractionBelow(value, inclusive) * (double)numValues +
+                   other.estimateFractionBelow(value, inclusive) * (double)other.numValues) /
+               (double)totalNumValues;
+    };
+    // The merged distribution is linear between consecutive boundaries of either histogram (and
+    // may jump at boundaries), so the new boundaries can be found by walking over them.
+    std::vector<double> points;
+    points.reserve(boundaries.size() + other.boundaries.size());
+    std::merge(boundaries.begin(), boundaries.end(), other.boundaries.begin(),
+        other.boundaries.end(), std::back_inserter(points));
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    std::vector<double> fractionBelow(points.size()), fractionAtMost(points.size());
+    for (auto i = 0u; i < points.size(); i++) {
+        fractionBelow[i] = estimateMerged(points[i], false /* inclusive */);
+        fractionAtMost[i] = estimateMerged(points[i], true /* inclusive */);
+    }
+    std::vector<double> newBoundaries(NUM_BUCKETS + 1);
+    newBoundaries[0] = points.front();
+    newBoundaries[NUM_BUCKETS] = points.back();
+    auto pointIdx = 0u;
+    for (auto i = 1u; i < NUM_BUCKETS; i++) {
+        auto fraction = (double)i / NUM_BUCKETS;
+        while (pointIdx < points.size() - 1 && fractionAtMost[pointIdx] < fraction) {
+            pointIdx++;
+        }
+        if (pointIdx == 0 || fraction >= fractionBelow[pointIdx]) {
+            newBoundaries[i] = points[pointIdx];
+        } else {
+            // Interpolate between the previous point and this one
+            auto lower = points[pointIdx - 1];
+            auto lowerFraction = fractionAtMost[pointIdx - 1];
+            auto upperFraction = fractionBelow[pointIdx];
+            KU_ASSERT(upperFraction > lowerFraction);
+            newBoundaries[i] = lower + (fraction - lowerFraction) /
+                                           (upperFraction - lowerFraction) *
+                                           (points[pointIdx] - lower);
+        }
+    }
+    boundaries = std::move(newBoundaries);
+    numValues = totalNumValues;
+}
+
+void EquiDepthHistogram::serialize(Serializer& serializer) const {
+    serializer.serializeValue(numValues);
+    serializer.serializeVector(boundaries);
+}
+
+EquiDepthHistogram EquiDepthHistogram::deserialize(Deserializer& deserializer) {
+    EquiDepthHistogram result;
+    deserializer.deserializeValue(result.numValues);
+    deserializer.deserializeVector(result.boundaries);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,96 @@
+#include "storage/stats/hyperloglog.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+void HyperLogLog::add(uint64_t hash) {
+    if (registers.empty()) {
+        registers.resize(NUM_REGISTERS, 0);
+    }
+    auto registerIdx = hash >> (64 - PRECISION);
+    // Position of the first set bit in the remaining bits
+    auto remainingBits = hash << PRECISION;
+    auto rank = remainingBits == 0 ? 64 - PRECISION + 1 : std::countl_zero(remainingBits) + 1;
+    registers[registerIdx] = std::max<uint8_t>(registers[registerIdx], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+    if (other.isEmpty()) {
+        return;
+    }
+    if (isEmpty()) {
+        registers = other.registers;
+        return;
+    }
+    for (auto i = 0u; i < NUM_REGISTERS; i++) {
+        registers[i] = std::max(registers[i], other.registers[i]);
+    }
+}
+
+uint64_t HyperLogLog::estimate() const {
+    if (isEmpty()) {
+        return 0;
+    }
+    constexpr double numRegisters = NUM_REGISTERS;
+    constexpr double alpha = 0.7213 / (1 + 1.079 / numRegisters);
+    double sum = 0;
+    auto numZeroRegisters = 0u;
+    for (auto value : registers) {
+        sum += std::ldexp(1.0, -value);
+        numZeroRegisters += value == 0;
+    }
+    auto estimate = alpha * numRegisters * numRegisters / sum;
+    // Small range correction: fall back to linear counting while there are empty registers
+    if (estimate <= 2.5 * numRegisters && numZeroRegisters > 0) {
+        estimate = numRegisters * std::log(numRegisters / numZeroRegisters);
+    }
+    return std::llround(estimate);
+}
+
+uint64_t HyperLogLog::hash(uint64_t value) {
+    // Finalizer of murmurhash3
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+uint64_t HyperLogLog::hash(const uint8_t* value, uint32_t numBytes) {
+    uint64_t result = numBytes;
+    for (auto i = 0u; i < numBytes; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        memcpy(&word, value + i, std::min<uint32_t>(sizeof(uint64_t), numBytes - i));
+        result = hash(result ^ word);
+    }
+    return result;
+}
+
+uint64_t HyperLogLog::hash(std::string_view value) {
+    return hash(std::hash<std::string_view>()(value));
+}
+
+void HyperLogLog::serialize(Serializer& serializer) const {
+    serializer.serializeVector(registers);
+}
+
+HyperLogLog HyperLogLog::deserialize(Deserializer& deserializer) {
+    HyperLogLog result;
+    deserializer.deserializeVector(result.registers);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
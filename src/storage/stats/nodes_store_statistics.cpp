@@ -12,10 +12,9 @@ offset_t NodesStoreStatsAndDeletedIDs::getMaxNodeOffset(
         return getNodeStatisticsAndDeletedIDs(tableID)->getMaxNodeOffset();
     } else {
         std::unique_lock xLck{mtx};
-        return readWriteVersion == nullptr ?
-                   getNodeStatisticsAndDeletedIDs(tableID)->getMaxNodeOffset() :
-                   getNodeTableStats(transaction::TransactionType::WRITE, tableID)
-                       ->getMaxNodeOffset();
+        return ku_dynamic_cast<TableStatistics*, NodeTableStatsAndDeletedIDs*>(
+            getTableStatisticsNoLock(transaction, tableID))
+            ->getMaxNodeOffset();
     }
 }
 
@@ -40,10 +39,9 @@ void NodesStoreStatsAndDeletedIDs::setDeletedNodeOffsetsForMorsel(
     // query where scans/reads happen in a write transaction cannot run concurrently with the
     // pipeline that performs an add/delete node.
     lock_t lck{mtx};
-    (transaction->isReadOnly() || readWriteVersion == nullptr) ?
-        getNodeStatisticsAndDeletedIDs(tableID)->setDeletedNodeOffsetsForMorsel(nodeOffsetVector) :
-        ((NodeTableStatsAndDeletedIDs*)readWriteVersion->tableStatisticPerTable[tableID].get())
-            ->setDeletedNodeOffsetsForMorsel(nodeOffsetVector);
+    ku_dynamic_cast<TableStatistics*, NodeTableStatsAndDeletedIDs*>(
+        getTableStatisticsNoLock(transaction, tableID))
+        ->setDeletedNodeOffsetsForMorsel(nodeOffsetVector);
 }
 
 void NodesStoreStatsAndDeletedIDs::addNodeStatisticsAndDeletedIDs(
@@ -80,9 +78,8 @@ MetadataDAHInfo* NodesStoreStatsAndDeletedIDs::getMetadataDAHInfo(
     if (transaction->isWriteTransaction()) {
         initTableStatisticsForWriteTrx();
     }
-    KU_ASSERT(transaction->isReadOnly() ||
-              (transaction->isWriteTransaction() && readWriteVersion &&
-                  readWriteVersion->tableStatisticPerTable.contains(tableID)));
+    KU_ASSERT(transaction->getType() == transaction::TransactionType::READ_ONLY ||
+              (readWriteVersion && readWriteVersion->tableStatisticPerTable.contains(tableID)));
     auto nodeTableStats = getNodeTableStats(transaction->getType(), tableID);
     return nodeTableStats->getMetadataDAHInfo(columnID);
 }
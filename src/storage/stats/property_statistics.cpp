@@ -1,27 +1,202 @@
 #include "storage/stats/property_statistics.h"
 
+#include <cstring>
+
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
+#include "common/vector/value_vector.h"
 #include "storage/stats/table_statistics_collection.h"
+#include "storage/store/string_column_chunk.h"
+
+using namespace kuzu::common;
 
 namespace kuzu {
 namespace storage {
 
+void PropertyStatistics::merge(const PropertyStatistics& other) {
+    mayHaveNullValue |= other.mayHaveNullValue;
+    if (other.numValues == 0) {
+        return;
+    }
+    if (numValues == 0) {
+        physicalType = other.physicalType;
+        range = other.range;
+    } else if (!range.hasStats || !other.range.hasStats || physicalType != other.physicalType) {
+        range.hasStats = false;
+    } else if (other.range.hasValues) {
+        range.update(other.range.min, physicalType);
+        range.update(other.range.max, physicalType);
+    }
+    numValues += other.numValues;
+    distinctValues.merge(other.distinctValues);
+    histogram.merge(other.histogram);
+}
+
 void PropertyStatistics::serialize(common::Serializer& serializer) const {
     serializer.serializeValue(mayHaveNullValue);
+    serializer.serializeValue(numValues);
+    serializer.serializeValue(physicalType);
+    serializer.serializeValue(range);
+    distinctValues.serialize(serializer);
+    histogram.serialize(serializer);
 }
 
-RWPropertyStats::RWPropertyStats(TablesStatistics* tablesStatistics, common::table_id_t tableID,
-    common::property_id_t propertyID)
-    : tablesStatistics{tablesStatistics}, tableID{tableID}, propertyID{propertyID} {}
-
 std::unique_ptr<PropertyStatistics> PropertyStatistics::deserialize(
     common::Deserializer& deserializer) {
     bool hasNull;
     deserializer.deserializeValue<bool>(hasNull);
-    return std::make_unique<PropertyStatistics>(hasNull);
+    auto result = std::make_unique<PropertyStatistics>(hasNull);
+    deserializer.deserializeValue(result->numValues);
+    deserializer.deserializeValue(result->physicalType);
+    deserializer.deserializeValue(result->range);
+    result->distinctValues = HyperLogLog::deserialize(deserializer);
+    result->histogram = EquiDepthHistogram::deserialize(deserializer);
+    return result;
+}
+
+PropertyStatisticsCollector::PropertyStatisticsCollector(PhysicalTypeID physicalType)
+    : physicalType{physicalType}, numBytesPerValue{0},
+      hasHistogram{ColumnChunkStats::isSupported(physicalType)}, numValuesSeenBySample{0},
+      randomState{0x9e3779b97f4a7c15ULL} {
+    switch (physicalType) {
+    case PhysicalTypeID::STRING:
+    case PhysicalTypeID::FIXED_LIST:
+    case PhysicalTypeID::VAR_LIST:
+    case PhysicalTypeID::STRUCT:
+    case PhysicalTypeID::POINTER:
+    case PhysicalTypeID::ANY: {
+        // Only the number of values is tracked for nested types
+    } break;
+    case PhysicalTypeID::INTERNAL_ID: {
+        // Column chunks only store the offsets of internal ids, so only offsets are hashed.
+        numBytesPerValue = sizeof(offset_t);
+    } break;
+    default: {
+        numBytesPerValue = PhysicalTypeUtils::getFixedTypeSize(physicalType);
+    }
+    }
+    stats.physicalType = physicalType;
+    if (hasHistogram) {
+        stats.range = ColumnChunkStats::empty();
+    }
+}
+
+void PropertyStatisticsCollector::add(
+    const ColumnChunk& chunk, offset_t startOffset, offset_t numValues) {
+    auto nullChunk = const_cast<ColumnChunk&>(chunk).getNullChunk();
+    for (auto pos = startOffset; pos < startOffset + numValues; pos++) {
+        if (nullChunk && nullChunk->isNull(pos)) {
+            addNull();
+        } else if (physicalType == PhysicalTypeID::STRING) {
+            addString(ku_dynamic_cast<const ColumnChunk&, const StringColumnChunk&>(chunk)
+                          .getValue<std::string_view>(pos));
+        } else if (physicalType == PhysicalTypeID::BOOL) {
+            // Booleans are bitpacked in chunks
+            auto value = chunk.getValue<bool>(pos);
+            addFixedSizeValue(reinterpret_cast<const uint8_t*>(&value));
+        } else if (numBytesPerValue > 0) {
+            addFixedSizeValue(chunk.getData() + pos * chunk.getNumBytesPerValue());
+        } else {
+            stats.numValues++;
+        }
+    }
+}
+
+void PropertyStatisticsCollector::add(
+    const ValueVector& vector, sel_t pos, uint64_t numRepetitions) {
+    if (numRepetitions == 0) {
+        return;
+    }
+    if (vector.isNull(pos)) {
+        addNull();
+    } else if (physicalType == PhysicalTypeID::STRING) {
+        addString(vector.getValue<ku_string_t>(pos).getAsStringView(), numRepetitions);
+    } else if (numBytesPerValue > 0) {
+        addFixedSizeValue(vector.getData() + pos * vector.getNumBytesPerValue(), numRepetitions);
+    } else {
+        stats.numValues += numRepetitions;
+    }
 }
 
+void PropertyStatisticsCollector::addNull() {
+    stats.mayHaveNullValue = true;
+}
+
+template<typename T>
+static inline double toDouble(const uint8_t* value) {
+    T typedValue;
+    memcpy(&typedValue, value, sizeof(T));
+    return (double)typedValue;
+}
+
+static double toDouble(const uint8_t* value, PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return toDouble<int64_t>(value);
+    case PhysicalTypeID::INT32:
+        return toDouble<int32_t>(value);
+    case PhysicalTypeID::INT16:
+        return toDouble<int16_t>(value);
+    case PhysicalTypeID::INT8:
+        return toDouble<int8_t>(value);
+    case PhysicalTypeID::UINT64:
+        return toDouble<uint64_t>(value);
+    case PhysicalTypeID::UINT32:
+        return toDouble<uint32_t>(value);
+    case PhysicalTypeID::UINT16:
+        return toDouble<uint16_t>(value);
+    case PhysicalTypeID::UINT8:
+        return toDouble<uint8_t>(value);
+    case PhysicalTypeID::DOUBLE:
+        return toDouble<double>(value);
+    case PhysicalTypeID::FLOAT:
+        return toDouble<float>(value);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+void PropertyStatisticsCollector::addFixedSizeValue(
+    const uint8_t* value, uint64_t numRepetitions) {
+    stats.numValues += numRepetitions;
+    stats.distinctValues.add(HyperLogLog::hash(value, numBytesPerValue));
+    if (hasHistogram) {
+        stats.range.update(value, 0 /* pos */, physicalType);
+        auto doubleValue = toDouble(value, physicalType);
+        for (auto i = 0u; i < numRepetitions; i++) {
+            addToSample(doubleValue);
+        }
+    }
+}
+
+void PropertyStatisticsCollector::addToSample(double value) {
+    // Reservoir sampling (Vitter's algorithm R)
+    if (sample.size() < MAX_SAMPLE_SIZE) {
+        sample.push_back(value);
+    } else {
+        // xorshift64
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+        auto pos = randomState % (numValuesSeenBySample + 1);
+        if (pos < MAX_SAMPLE_SIZE) {
+            sample[pos] = value;
+        }
+    }
+    numValuesSeenBySample++;
+}
+
+PropertyStatistics PropertyStatisticsCollector::finalize() {
+    if (hasHistogram) {
+        stats.histogram = EquiDepthHistogram::build(std::move(sample), stats.numValues);
+    }
+    return std::move(stats);
+}
+
+RWPropertyStats::RWPropertyStats(TablesStatistics* tablesStatistics, common::table_id_t tableID,
+    common::property_id_t propertyID)
+    : tablesStatistics{tablesStatistics}, tableID{tableID}, propertyID{propertyID} {}
+
 // Read/write statistics cannot be cached since functions like checkpointInMemoryIfNecessary may
 // overwrite them and invalidate the reference
 bool RWPropertyStats::mayHaveNull(const transaction::Transaction& transaction) {
@@ -34,21 +209,22 @@ bool RWPropertyStats::mayHaveNull(const transaction::Transaction& transaction) {
         return true;
     }
     KU_ASSERT(tablesStatistics);
-    auto statistics =
+    auto& statistics =
         tablesStatistics->getPropertyStatisticsForTable(transaction, tableID, propertyID);
     return statistics.mayHaveNull();
 }
 
-void RWPropertyStats::setHasNull(const transaction::Transaction& transaction) {
+void RWPropertyStats::setHasNull(const transaction::Transaction& /*transaction*/) {
+    update(PropertyStatistics(true /* mayHaveNullValue */));
+}
+
+void RWPropertyStats::update(const PropertyStatistics& newStats) {
     // TODO(Guodong): INVALID_PROPERTY_ID is used here because we have a column, i.e., adjColumn,
     // not exposed as property in table schema, but still have nullColumn. Should be fixed once we
     // properly align properties and chunks.
     if (propertyID != common::INVALID_PROPERTY_ID) {
         KU_ASSERT(tablesStatistics);
-        auto propStats =
-            tablesStatistics->getPropertyStatisticsForTable(transaction, tableID, propertyID);
-        propStats.setHasNull();
-        tablesStatistics->setPropertyStatisticsForTable(tableID, propertyID, propStats);
+        tablesStatistics->mergePropertyStatisticsForTable(tableID, propertyID, newStats);
     }
 }
 
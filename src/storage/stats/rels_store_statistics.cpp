@@ -1,6 +1,7 @@
 #include "storage/stats/rels_store_statistics.h"
 
 #include "common/assert.h"
+#include "common/cast.h"
 #include "storage/stats/rel_table_statistics.h"
 #include "storage/wal/wal.h"
 
@@ -27,29 +28,26 @@ void RelsStoreStats::setNumTuplesForTable(table_id_t relTableID, uint64_t numRel
     relStatistics->setNumTuples(numRels);
 }
 
-void RelsStoreStats::updateNumRelsByValue(table_id_t relTableID, int64_t value) {
+void RelsStoreStats::updateNumRelsByValue(
+    Transaction* transaction, table_id_t relTableID, int64_t value) {
     std::unique_lock lck{mtx};
-    initTableStatisticsForWriteTrxNoLock();
-    KU_ASSERT(readWriteVersion && readWriteVersion->tableStatisticPerTable.contains(relTableID));
-    setToUpdated();
-    auto relStatistics = (RelTableStats*)readWriteVersion->tableStatisticPerTable[relTableID].get();
+    auto relStatistics = ku_dynamic_cast<TableStatistics*, RelTableStats*>(
+        getTableStatisticsForWriteNoLock(transaction, relTableID));
     auto numRelsBeforeUpdate = relStatistics->getNumTuples();
     KU_ASSERT(!(numRelsBeforeUpdate == 0 && value < 0));
     auto numRelsAfterUpdate = relStatistics->getNumTuples() + value;
     relStatistics->setNumTuples(numRelsAfterUpdate);
     // Update the nextRelID only when we are inserting rels.
     if (value > 0) {
-        increaseNextRelOffset(relTableID, value);
+        relStatistics->incrementNextRelOffset(value);
     }
 }
 
 offset_t RelsStoreStats::getNextRelOffset(
     transaction::Transaction* transaction, table_id_t tableID) {
     std::unique_lock lck{mtx};
-    auto& tableStatisticContent = (transaction->isReadOnly() || readWriteVersion == nullptr) ?
-                                      readOnlyVersion :
-                                      readWriteVersion;
-    return ((RelTableStats*)tableStatisticContent->tableStatisticPerTable.at(tableID).get())
+    return ku_dynamic_cast<TableStatistics*, RelTableStats*>(
+        getTableStatisticsNoLock(transaction, tableID))
         ->getNextRelOffset();
 }
 
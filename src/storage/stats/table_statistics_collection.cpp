@@ -57,14 +57,63 @@ void TablesStatistics::initTableStatisticsForWriteTrxNoLock() {
     }
 }
 
+void TablesStatistics::applyLocalTableStatistics(transaction::Transaction* transaction) {
+    std::unique_lock xLck{mtx};
+    initTableStatisticsForWriteTrxNoLock();
+    auto& localTableStatistics = transaction->getLocalStorage()->getTableStatistics();
+    for (auto it = localTableStatistics.begin(); it != localTableStatistics.end();) {
+        // The local storage holds the statistics of both node and rel tables.
+        if (readWriteVersion->tableStatisticPerTable.contains(it->first)) {
+            readWriteVersion->tableStatisticPerTable[it->first] = it->second->copy();
+            setToUpdated();
+            it = localTableStatistics.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+TableStatistics* TablesStatistics::getTableStatisticsNoLock(
+    transaction::Transaction* transaction, table_id_t tableID) {
+    if (transaction->getType() == transaction::TransactionType::READ_ONLY) {
+        return readOnlyVersion->tableStatisticPerTable.at(tableID).get();
+    }
+    if (transaction->isConcurrentWriteTransaction()) {
+        auto& localTableStatistics = transaction->getLocalStorage()->getTableStatistics();
+        if (localTableStatistics.contains(tableID)) {
+            return localTableStatistics.at(tableID).get();
+        }
+    }
+    auto& tablesStatisticsContent =
+        readWriteVersion == nullptr ? readOnlyVersion : readWriteVersion;
+    return tablesStatisticsContent->tableStatisticPerTable.at(tableID).get();
+}
+
+TableStatistics* TablesStatistics::getTableStatisticsForWriteNoLock(
+    transaction::Transaction* transaction, table_id_t tableID) {
+    KU_ASSERT(transaction->getType() == transaction::TransactionType::WRITE);
+    if (!transaction->isConcurrentWriteTransaction()) {
+        initTableStatisticsForWriteTrxNoLock();
+        setToUpdated();
+        return readWriteVersion->tableStatisticPerTable.at(tableID).get();
+    }
+    auto& localTableStatistics = transaction->getLocalStorage()->getTableStatistics();
+    if (!localTableStatistics.contains(tableID)) {
+        localTableStatistics[tableID] = getTableStatisticsNoLock(transaction, tableID)->copy();
+    }
+    return localTableStatistics.at(tableID).get();
+}
+
 PropertyStatistics& TablesStatistics::getPropertyStatisticsForTable(
     const transaction::Transaction& transaction, table_id_t tableID, property_id_t propertyID) {
-    if (transaction.isReadOnly()) {
+    if (transaction.getType() == transaction::TransactionType::READ_ONLY) {
         KU_ASSERT(readOnlyVersion->tableStatisticPerTable.contains(tableID));
         auto tableStatistics = readOnlyVersion->tableStatisticPerTable.at(tableID).get();
         return tableStatistics->getPropertyStatistics(propertyID);
     } else {
-        initTableStatisticsForWriteTrx();
+        if (transaction.isWriteTransaction()) {
+            initTableStatisticsForWriteTrx();
+        }
         KU_ASSERT(readWriteVersion && readWriteVersion->tableStatisticPerTable.contains(tableID));
         auto tableStatistics = readWriteVersion->tableStatisticPerTable.at(tableID).get();
         return tableStatistics->getPropertyStatistics(propertyID);
@@ -80,6 +129,16 @@ void TablesStatistics::setPropertyStatisticsForTable(
     tableStatistics->setPropertyStatistics(propertyID, stats);
 }
 
+void TablesStatistics::mergePropertyStatisticsForTable(
+    table_id_t tableID, property_id_t propertyID, const PropertyStatistics& stats) {
+    std::unique_lock xLck{mtx};
+    initTableStatisticsForWriteTrxNoLock();
+    KU_ASSERT(readWriteVersion->tableStatisticPerTable.contains(tableID));
+    setToUpdated();
+    auto tableStatistics = readWriteVersion->tableStatisticPerTable.at(tableID).get();
+    tableStatistics->getPropertyStatistics(propertyID).merge(stats);
+}
+
 std::unique_ptr<MetadataDAHInfo> TablesStatistics::createMetadataDAHInfo(
     const LogicalType& dataType, BMFileHandle& metadataFH, BufferManager* bm, WAL* wal) {
     auto metadataDAHInfo = std::make_unique<MetadataDAHInfo>();
@@ -123,6 +123,8 @@ void StorageManager::dropTable(table_id_t tableID) {
 }
 
 void StorageManager::prepareCommit(transaction::Transaction* transaction) {
+    nodesStatisticsAndDeletedIDs->applyLocalTableStatistics(transaction);
+    relsStatistics->applyLocalTableStatistics(transaction);
     auto localStorage = transaction->getLocalStorage();
     for (auto tableID : localStorage->getTableIDsWithUpdates()) {
         KU_ASSERT(tables.contains(tableID));
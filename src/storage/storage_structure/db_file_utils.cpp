@@ -31,8 +31,8 @@ WALPageIdxAndFrame createWALVersionIfNecessaryAndPinPage(page_idx_t originalPage
         walFrame = bufferManager.pin(
             *wal.fileHandle, pageIdxInWAL, BufferManager::PageReadPolicy::READ_PAGE);
     } else {
-        pageIdxInWAL =
-            wal.logPageUpdateRecord(dbFileID, originalPageIdx /* pageIdxInOriginalFile */);
+        pageIdxInWAL = wal.logPageUpdateRecord(fileHandle, dbFileID,
+            originalPageIdx /* pageIdxInOriginalFile */, insertingNewPage /* isNewPage */);
         walFrame = bufferManager.pin(
             *wal.fileHandle, pageIdxInWAL, BufferManager::PageReadPolicy::DONT_READ_PAGE);
         if (!insertingNewPage) {
@@ -75,7 +75,7 @@ std::pair<BMFileHandle*, page_idx_t> DBFileUtils::getFileHandleAndPhysicalPageId
 common::page_idx_t DBFileUtils::insertNewPage(BMFileHandle& fileHandle, DBFileID dbFileID,
     BufferManager& bufferManager, WAL& wal, const std::function<void(uint8_t*)>& insertOp) {
     auto newOriginalPage = fileHandle.addNewPage();
-    auto newWALPage = wal.logPageInsertRecord(dbFileID, newOriginalPage);
+    auto newWALPage = wal.logPageInsertRecord(fileHandle, dbFileID, newOriginalPage);
     auto walFrame = bufferManager.pin(
         *wal.fileHandle, newWALPage, BufferManager::PageReadPolicy::DONT_READ_PAGE);
     fileHandle.addWALPageIdxGroupIfNecessary(newOriginalPage);
@@ -1,10 +1,12 @@
 #include "storage/store/column.h"
 
+#include <array>
 #include <memory>
 
 #include "common/assert.h"
 #include "common/types/internal_id_t.h"
 #include "common/types/types.h"
+#include "storage/compression/run_length_encoding.h"
 #include "storage/stats/property_statistics.h"
 #include "storage/storage_utils.h"
 #include "storage/store/column_chunk.h"
@@ -225,6 +227,7 @@ Column::Column(std::string name, LogicalType dataType, const MetadataDAHInfo& me
     readToVectorFunc = getReadValuesToVectorFunc(this->dataType);
     readToPageFunc = ReadCompressedValuesFromPage(this->dataType);
     batchLookupFunc = ReadCompressedValuesFromPage(this->dataType);
+    selectFunc = SelectCompressedValuesFromPage(this->dataType);
     writeFromVectorFunc = getWriteValueFromVectorFunc(this->dataType);
     writeFunc = getWriteValuesFunc(this->dataType);
     KU_ASSERT(numBytesPerFixedSizedValue <= BufferPoolConstants::PAGE_4KB_SIZE);
@@ -260,12 +263,121 @@ void Column::batchLookup(
 }
 
 void Column::scan(Transaction* transaction, ValueVector* nodeIDVector, ValueVector* resultVector) {
+    resultVector->setConstant(false);
     if (nullColumn) {
         nullColumn->scan(transaction, nodeIDVector, resultVector);
     }
     scanInternal(transaction, nodeIDVector, resultVector);
 }
 
+void Column::scan(Transaction* transaction, ValueVector* nodeIDVector, ValueVector* resultVector,
+    const ColumnPredicate& predicate) {
+    KU_ASSERT(ColumnChunkStats::isSupported(dataType.getPhysicalType()));
+    resultVector->setConstant(false);
+    if (nullColumn) {
+        nullColumn->scan(transaction, nodeIDVector, resultVector);
+    }
+    auto startNodeOffset = nodeIDVector->readNodeOffset(0);
+    KU_ASSERT(startNodeOffset % DEFAULT_VECTOR_CAPACITY == 0);
+    auto [nodeGroupIdx, offsetInChunk] =
+        StorageUtils::getNodeGroupIdxAndOffsetInChunk(startNodeOffset);
+    auto chunkMeta = metadataDA->get(nodeGroupIdx, transaction->getType());
+    readAhead(chunkMeta, offsetInChunk);
+    auto numValuesPerPage =
+        chunkMeta.compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
+    auto selVector = nodeIDVector->state->selVector.get();
+    auto numValuesToScan = nodeIDVector->state->getOriginalSize();
+    // Evaluate the predicate on each page containing selected nodes. Positions of the matching
+    // values are in ascending order.
+    std::array<sel_t, DEFAULT_VECTOR_CAPACITY> matches;
+    uint64_t numMatches = 0;
+    // Set if the compression doesn't support evaluating the predicate, in which case the values
+    // of the scanned pages have already been decompressed into the result vector
+    bool isDecompressed = false;
+    auto cursor = getPageCursorForOffset(transaction->getType(), nodeGroupIdx, offsetInChunk);
+    uint64_t numValuesScanned = 0;
+    auto posInSelVector = 0u;
+    while (numValuesScanned < numValuesToScan && posInSelVector < selVector->selectedSize) {
+        uint64_t numValuesToScanInPage = std::min(
+            numValuesPerPage - cursor.elemPosInPage, numValuesToScan - numValuesScanned);
+        if (selVector->selectedPositions[posInSelVector] <
+            numValuesScanned + numValuesToScanInPage) {
+            KU_ASSERT(isPageIdxValid(cursor.pageIdx, chunkMeta));
+            readFromPage(transaction, cursor.pageIdx, [&](uint8_t* frame) -> void {
+                auto numSelected = selectFunc(frame, cursor, numValuesToScanInPage, predicate,
+                    chunkMeta.compMeta, numValuesScanned, matches.data() + numMatches);
+                if (!numSelected.has_value()) {
+                    readToVectorFunc(frame, cursor, resultVector, numValuesScanned,
+                        numValuesToScanInPage, chunkMeta.compMeta);
+                    numSelected = Uncompressed(dataType).selectFromPage(resultVector->getData(),
+                        numValuesScanned, numValuesToScanInPage, predicate, chunkMeta.compMeta,
+                        numValuesScanned, matches.data() + numMatches);
+                    KU_ASSERT(numSelected.has_value());
+                    isDecompressed = true;
+                }
+                numMatches += *numSelected;
+            });
+        }
+        numValuesScanned += numValuesToScanInPage;
+        cursor.nextPage();
+        while (posInSelVector < selVector->selectedSize &&
+               selVector->selectedPositions[posInSelVector] < numValuesScanned) {
+            posInSelVector++;
+        }
+    }
+    // Intersect the matches with the current selection and drop nulls, which never satisfy a
+    // comparison. Both are sorted, and no position is written before it is read.
+    auto selectedPositionsBuffer = selVector->getSelectedPositionsBuffer();
+    sel_t numSelected = 0;
+    if (selVector->isUnfiltered()) {
+        for (auto i = 0u; i < numMatches; i++) {
+            selectedPositionsBuffer[numSelected] = matches[i];
+            numSelected += !resultVector->isNull(matches[i]);
+        }
+    } else {
+        auto posInMatches = 0u;
+        for (auto i = 0u; i < selVector->selectedSize; i++) {
+            auto pos = selVector->selectedPositions[i];
+            while (posInMatches < numMatches && matches[posInMatches] < pos) {
+                posInMatches++;
+            }
+            if (posInMatches < numMatches && matches[posInMatches] == pos &&
+                !resultVector->isNull(pos)) {
+                selectedPositionsBuffer[numSelected++] = pos;
+            }
+        }
+    }
+    selVector->resetSelectorToValuePosBufferWithSize(numSelected);
+    if (isDecompressed || numSelected == 0) {
+        return;
+    }
+    // Only decompress the values from the first to the last selected position in each page
+    cursor = getPageCursorForOffset(transaction->getType(), nodeGroupIdx, offsetInChunk);
+    numValuesScanned = 0;
+    posInSelVector = 0;
+    while (posInSelVector < selVector->selectedSize) {
+        uint64_t numValuesToScanInPage = std::min(
+            numValuesPerPage - cursor.elemPosInPage, numValuesToScan - numValuesScanned);
+        auto pageEnd = numValuesScanned + numValuesToScanInPage;
+        if (selVector->selectedPositions[posInSelVector] < pageEnd) {
+            auto firstPos = selVector->selectedPositions[posInSelVector];
+            while (posInSelVector < selVector->selectedSize &&
+                   selVector->selectedPositions[posInSelVector] < pageEnd) {
+                posInSelVector++;
+            }
+            auto lastPos = selVector->selectedPositions[posInSelVector - 1];
+            auto pageCursor = cursor;
+            pageCursor.elemPosInPage += firstPos - numValuesScanned;
+            readFromPage(transaction, cursor.pageIdx, [&](uint8_t* frame) -> void {
+                readToVectorFunc(frame, pageCursor, resultVector, firstPos,
+                    lastPos - firstPos + 1, chunkMeta.compMeta);
+            });
+        }
+        numValuesScanned = pageEnd;
+        cursor.nextPage();
+    }
+}
+
 void Column::scan(transaction::Transaction* transaction, node_group_idx_t nodeGroupIdx,
     offset_t startOffsetInGroup, offset_t endOffsetInGroup, ValueVector* resultVector,
     uint64_t offsetInVector) {
@@ -298,7 +410,6 @@ void Column::scan(Transaction* transaction, node_group_idx_t nodeGroupIdx, Colum
             chunkMetadata.compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
         auto cursor = PageUtils::getPageCursorForPos(startOffset, numValuesPerPage);
         cursor.pageIdx += chunkMetadata.pageIdx;
-        uint64_t numValuesScanned = 0u;
         endOffset = std::min(endOffset, chunkMetadata.numValues);
         KU_ASSERT(endOffset >= startOffset);
         auto numValuesToScan = endOffset - startOffset;
@@ -306,19 +417,15 @@ void Column::scan(Transaction* transaction, node_group_idx_t nodeGroupIdx, Colum
             columnChunk->resize(std::bit_ceil(numValuesToScan));
         }
         KU_ASSERT((numValuesToScan + startOffset) <= chunkMetadata.numValues);
-        while (numValuesScanned < numValuesToScan) {
-            auto numValuesToReadInPage = std::min(
-                numValuesPerPage - cursor.elemPosInPage, numValuesToScan - numValuesScanned);
-            KU_ASSERT(isPageIdxValid(cursor.pageIdx, chunkMetadata));
-            readFromPage(transaction, cursor.pageIdx, [&](uint8_t* frame) -> void {
-                readToPageFunc(frame, cursor, columnChunk->getData(), numValuesScanned,
+        prefetchPages(chunkMetadata, startOffset, endOffset, false /* async */);
+        scanPages(transaction, cursor, numValuesPerPage, numValuesToScan,
+            [&](uint8_t* frame, PageCursor& pageCursor, uint64_t numValuesScanned,
+                uint64_t numValuesToReadInPage) {
+                KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMetadata));
+                readToPageFunc(frame, pageCursor, columnChunk->getData(), numValuesScanned,
                     numValuesToReadInPage, chunkMetadata.compMeta);
             });
-            numValuesScanned += numValuesToReadInPage;
-            cursor.nextPage();
-        }
-        KU_ASSERT(numValuesScanned == numValuesToScan);
-        columnChunk->setNumValues(numValuesScanned);
+        columnChunk->setNumValues(numValuesToScan);
     }
 }
 
@@ -326,18 +433,12 @@ void Column::scan(Transaction* transaction, const ReadState& state, offset_t sta
     offset_t endOffsetInGroup, uint8_t* result) {
     auto cursor = getPageCursorForOffsetInGroup(startOffsetInGroup, state);
     auto numValuesToScan = endOffsetInGroup - startOffsetInGroup;
-    uint64_t numValuesScanned = 0;
-    while (numValuesScanned < numValuesToScan) {
-        uint64_t numValuesToScanInPage =
-            std::min((uint64_t)state.numValuesPerPage - cursor.elemPosInPage,
-                numValuesToScan - numValuesScanned);
-        readFromPage(transaction, cursor.pageIdx, [&](uint8_t* frame) -> void {
-            readToPageFunc(frame, cursor, result, numValuesScanned, numValuesToScanInPage,
+    scanPages(transaction, cursor, state.numValuesPerPage, numValuesToScan,
+        [&](uint8_t* frame, PageCursor& pageCursor, uint64_t numValuesScanned,
+            uint64_t numValuesToScanInPage) {
+            readToPageFunc(frame, pageCursor, result, numValuesScanned, numValuesToScanInPage,
                 state.metadata.compMeta);
         });
-        numValuesScanned += numValuesToScanInPage;
-        cursor.nextPage();
-    }
 }
 
 void Column::scanInternal(
@@ -349,9 +450,17 @@ void Column::scanInternal(
         StorageUtils::getNodeGroupIdxAndOffsetInChunk(startNodeOffset);
     auto cursor = getPageCursorForOffset(transaction->getType(), nodeGroupIdx, offsetInChunk);
     auto chunkMeta = metadataDA->get(nodeGroupIdx, transaction->getType());
+    readAhead(chunkMeta, offsetInChunk);
     if (nodeIDVector->state->selVector->isUnfiltered()) {
-        scanUnfiltered(transaction, cursor, nodeIDVector->state->selVector->selectedSize,
-            resultVector, chunkMeta);
+        if (canScanAsConstant(resultVector)) {
+            bool isConstant = true;
+            scanUnfiltered(transaction, cursor, nodeIDVector->state->selVector->selectedSize,
+                resultVector, chunkMeta, 0 /*startPosInVector*/, &isConstant);
+            resultVector->setConstant(isConstant);
+        } else {
+            scanUnfiltered(transaction, cursor, nodeIDVector->state->selVector->selectedSize,
+                resultVector, chunkMeta);
+        }
     } else {
         scanFiltered(transaction, cursor, nodeIDVector, resultVector, chunkMeta);
     }
@@ -359,21 +468,57 @@ void Column::scanInternal(
 
 void Column::scanUnfiltered(Transaction* transaction, PageCursor& pageCursor,
     uint64_t numValuesToScan, ValueVector* resultVector, const ColumnChunkMetadata& chunkMeta,
-    uint64_t startPosInVector) {
-    uint64_t numValuesScanned = 0;
+    uint64_t startPosInVector, bool* isConstant) {
     auto numValuesPerPage =
         chunkMeta.compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
-    while (numValuesScanned < numValuesToScan) {
-        uint64_t numValuesToScanInPage =
-            std::min((uint64_t)numValuesPerPage - pageCursor.elemPosInPage,
-                numValuesToScan - numValuesScanned);
-        KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
-        readFromPage(transaction, pageCursor.pageIdx, [&](uint8_t* frame) -> void {
-            readToVectorFunc(frame, pageCursor, resultVector, numValuesScanned + startPosInVector,
+    if (isConstant) {
+        *isConstant = chunkMeta.compMeta.compression == CompressionType::CONSTANT ||
+                      chunkMeta.compMeta.compression == CompressionType::RLE;
+    }
+    scanPages(transaction, pageCursor, numValuesPerPage, numValuesToScan,
+        [&](uint8_t* frame, PageCursor& cursor, uint64_t numValuesScanned,
+            uint64_t numValuesToScanInPage) {
+            KU_ASSERT(isPageIdxValid(cursor.pageIdx, chunkMeta));
+            readToVectorFunc(frame, cursor, resultVector, numValuesScanned + startPosInVector,
                 numValuesToScanInPage, chunkMeta.compMeta);
+            if (isConstant && *isConstant &&
+                chunkMeta.compMeta.compression == CompressionType::RLE) {
+                // Each page may hold a single run, but consecutive pages are only part of the
+                // same run if their values are equal
+                auto numBytes = resultVector->getNumBytesPerValue();
+                *isConstant = RunLengthEncoding(numBytes).isSingleRun(
+                                  frame, cursor.elemPosInPage, numValuesToScanInPage) &&
+                              memcmp(resultVector->getData() + startPosInVector * numBytes,
+                                  resultVector->getData() +
+                                      (numValuesScanned + startPosInVector) * numBytes,
+                                  numBytes) == 0;
+            }
         });
-        numValuesScanned += numValuesToScanInPage;
-        pageCursor.nextPage();
+}
+
+bool Column::canScanAsConstant(ValueVector* resultVector) const {
+    // Nulls are scanned separately, so a vector containing nulls is never constant
+    if (!resultVector->hasNoNullsGuarantee()) {
+        return false;
+    }
+    switch (dataType.getPhysicalType()) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT: {
+        return true;
+    }
+    default: {
+        // This also keeps scans of the null column from marking the result vector as constant.
+        return false;
+    }
     }
 }
 
@@ -450,6 +595,117 @@ void Column::readFromPage(
     bufferManager->optimisticRead(*fileHandleToPin, pageIdxToPin, func);
 }
 
+void Column::readFromPages(Transaction* transaction, page_idx_t startPageIdx, page_idx_t numPages,
+    const std::function<void(uint8_t*, page_idx_t)>& func) {
+    if (startPageIdx == INVALID_PAGE_IDX) {
+        KU_ASSERT(numPages == 1);
+        return func(nullptr, startPageIdx);
+    }
+    // Pages updated by a write transaction are read from the WAL one at a time.
+    auto isInWAL = [&](page_idx_t pageIdx) {
+        return transaction->getType() != TransactionType::READ_ONLY &&
+               dataFH->hasWALPageVersionNoWALPageIdxLock(pageIdx);
+    };
+    auto endPageIdx = startPageIdx + numPages;
+    auto pageIdx = startPageIdx;
+    while (pageIdx < endPageIdx) {
+        if (isInWAL(pageIdx)) {
+            readFromPage(transaction, pageIdx, [&](uint8_t* frame) { func(frame, pageIdx); });
+            pageIdx++;
+            continue;
+        }
+        PageRun extent{pageIdx, 1};
+        while (extent.endPageIdx() < endPageIdx &&
+               extent.canAppend(
+                   extent.endPageIdx(), BufferManager::MAX_NUM_PAGES_PER_IO_REQUEST) &&
+               !isInWAL(extent.endPageIdx())) {
+            extent.numPages++;
+        }
+        bufferManager->optimisticReadPages(*dataFH, extent.startPageIdx, extent.numPages,
+            [&](uint8_t* frame, page_idx_t firstPageIdx, page_idx_t numPagesToRead) {
+                for (auto i = 0u; i < numPagesToRead; i++) {
+                    func(frame + i * BufferPoolConstants::PAGE_4KB_SIZE, firstPageIdx + i);
+                }
+            });
+        pageIdx = extent.endPageIdx();
+    }
+}
+
+void Column::scanPages(Transaction* transaction, PageCursor& cursor, uint64_t numValuesPerPage,
+    uint64_t numValuesToScan,
+    const std::function<void(uint8_t*, PageCursor&, uint64_t, uint64_t)>& func) {
+    if (numValuesToScan == 0) {
+        return;
+    }
+    auto startCursor = cursor;
+    auto numValuesInFirstPage =
+        std::min(numValuesPerPage - startCursor.elemPosInPage, numValuesToScan);
+    auto numPages = 1 + (numValuesToScan - numValuesInFirstPage + numValuesPerPage - 1) /
+                            numValuesPerPage;
+    readFromPages(transaction, startCursor.pageIdx, numPages,
+        [&](uint8_t* frame, page_idx_t pageIdx) {
+            auto pageIdxInScan = pageIdx - startCursor.pageIdx;
+            auto pageCursor = pageIdxInScan == 0 ? startCursor : PageCursor{pageIdx, 0};
+            auto numValuesScanned =
+                pageIdxInScan == 0 ? 0 :
+                                     numValuesInFirstPage + (pageIdxInScan - 1) * numValuesPerPage;
+            func(frame, pageCursor, numValuesScanned,
+                std::min(numValuesPerPage - pageCursor.elemPosInPage,
+                    numValuesToScan - numValuesScanned));
+        });
+    cursor.pageIdx += numPages - 1;
+    cursor.nextPage();
+}
+
+void Column::prefetch(Transaction* transaction, node_group_idx_t nodeGroupIdx,
+    offset_t startOffsetInGroup, offset_t endOffsetInGroup, bool async) {
+    if (nullColumn) {
+        nullColumn->prefetch(
+            transaction, nodeGroupIdx, startOffsetInGroup, endOffsetInGroup, async);
+    }
+    if (nodeGroupIdx >= metadataDA->getNumElements(transaction->getType())) {
+        return;
+    }
+    prefetchPages(metadataDA->get(nodeGroupIdx, transaction->getType()), startOffsetInGroup,
+        endOffsetInGroup, async);
+}
+
+void Column::prefetchPages(const ColumnChunkMetadata& chunkMeta, offset_t startOffsetInGroup,
+    offset_t endOffsetInGroup, bool async) {
+    auto numValuesPerPage =
+        chunkMeta.compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
+    endOffsetInGroup = std::min(endOffsetInGroup, chunkMeta.numValues);
+    // Constant chunks have no pages.
+    if (chunkMeta.numPages == 0 || numValuesPerPage == UINT64_MAX ||
+        startOffsetInGroup >= endOffsetInGroup) {
+        return;
+    }
+    auto startPageIdx = startOffsetInGroup / numValuesPerPage;
+    auto endPageIdx = std::min<uint64_t>(
+        (endOffsetInGroup + numValuesPerPage - 1) / numValuesPerPage, chunkMeta.numPages);
+    if (startPageIdx >= endPageIdx) {
+        return;
+    }
+    if (async) {
+        bufferManager->prefetchPagesAsync(
+            *dataFH, chunkMeta.pageIdx + startPageIdx, endPageIdx - startPageIdx);
+    } else {
+        bufferManager->prefetchPages(
+            *dataFH, chunkMeta.pageIdx + startPageIdx, endPageIdx - startPageIdx);
+    }
+}
+
+void Column::readAhead(const ColumnChunkMetadata& chunkMeta, offset_t offsetInChunk) {
+    if (offsetInChunk % PREFETCH_WINDOW_SIZE != 0) {
+        return;
+    }
+    if (offsetInChunk == 0) {
+        prefetchPages(chunkMeta, 0, PREFETCH_WINDOW_SIZE, false /* async */);
+    }
+    prefetchPages(chunkMeta, offsetInChunk + PREFETCH_WINDOW_SIZE,
+        offsetInChunk + 2 * PREFETCH_WINDOW_SIZE, true /* async */);
+}
+
 static bool sanityCheckForWrites(const ColumnChunkMetadata& metadata, const LogicalType& dataType) {
     if (metadata.compMeta.compression == CompressionType::CONSTANT) {
         return metadata.numPages == 0;
@@ -484,13 +740,19 @@ void Column::write(node_group_idx_t nodeGroupIdx, offset_t offsetInChunk,
     ValueVector* vectorToWriteFrom, uint32_t posInVectorToWriteFrom) {
     bool isNull = vectorToWriteFrom->isNull(posInVectorToWriteFrom);
     auto chunkMeta = metadataDA->get(nodeGroupIdx, TransactionType::WRITE);
+    bool metadataChanged = false;
     if (!isNull) {
         writeValue(
             chunkMeta, nodeGroupIdx, offsetInChunk, vectorToWriteFrom, posInVectorToWriteFrom);
+        metadataChanged = chunkMeta.stats.update(
+            vectorToWriteFrom->getData(), posInVectorToWriteFrom, dataType.getPhysicalType());
     }
     if (offsetInChunk >= chunkMeta.numValues) {
         chunkMeta.numValues = offsetInChunk + 1;
         KU_ASSERT(sanityCheckForWrites(chunkMeta, dataType));
+        metadataChanged = true;
+    }
+    if (metadataChanged) {
         metadataDA->update(nodeGroupIdx, chunkMeta);
     }
 }
@@ -509,9 +771,20 @@ void Column::write(node_group_idx_t nodeGroupIdx, offset_t offsetInChunk, Column
     offset_t dataOffset, length_t numValues) {
     auto state = getReadState(TransactionType::WRITE, nodeGroupIdx);
     writeValues(state, offsetInChunk, data->getData(), dataOffset, numValues);
+    bool metadataChanged = false;
+    for (auto i = 0u; i < numValues; i++) {
+        if (data->getNullChunk() && data->getNullChunk()->isNull(dataOffset + i)) {
+            continue;
+        }
+        metadataChanged |= state.metadata.stats.update(
+            data->getData(), dataOffset + i, dataType.getPhysicalType());
+    }
     if (offsetInChunk + numValues > state.metadata.numValues) {
         state.metadata.numValues = offsetInChunk + numValues;
         KU_ASSERT(sanityCheckForWrites(state.metadata, dataType));
+        metadataChanged = true;
+    }
+    if (metadataChanged) {
         metadataDA->update(nodeGroupIdx, state.metadata);
     }
 }
@@ -539,6 +812,9 @@ offset_t Column::appendValues(
     auto startOffset = state.metadata.numValues;
     auto numPages = dataFH->getNumPages();
     writeValues(state, state.metadata.numValues, data, 0 /*dataOffset*/, numValues);
+    for (auto i = 0u; i < numValues; i++) {
+        state.metadata.stats.update(data, i, dataType.getPhysicalType());
+    }
     auto newNumPages = dataFH->getNumPages();
     state.metadata.numValues += numValues;
     state.metadata.numPages += (newNumPages - numPages);
@@ -5,6 +5,8 @@
 #include "common/types/internal_id_t.h"
 #include "common/types/types.h"
 #include "storage/compression/compression.h"
+#include "storage/compression/float_compression.h"
+#include "storage/compression/run_length_encoding.h"
 #include "storage/storage_utils.h"
 #include "storage/store/string_column_chunk.h"
 #include "storage/store/struct_column_chunk.h"
@@ -36,18 +38,35 @@ ColumnChunkMetadata booleanGetMetadata(
         numValues, CompressionMetadata(CompressionType::BOOLEAN_BITPACKING));
 }
 
+using compression_algs_t = std::vector<std::shared_ptr<CompressionAlg>>;
+
+// Returns the algorithm used to compress data with the given metadata. The algorithms fall back to
+// storing values uncompressed when compression wouldn't save space, which is handled by the first
+// (default) algorithm.
+static const CompressionAlg& getCompressionAlg(
+    const compression_algs_t& algs, CompressionType compression) {
+    KU_ASSERT(!algs.empty());
+    for (auto& alg : algs) {
+        if (alg->getCompressionType() == compression) {
+            return *alg;
+        }
+    }
+    return *algs[0];
+}
+
 class CompressedFlushBuffer {
-    std::shared_ptr<CompressionAlg> alg;
+    compression_algs_t algs;
     const LogicalType& dataType;
 
 public:
-    CompressedFlushBuffer(std::shared_ptr<CompressionAlg> alg, LogicalType& dataType)
-        : alg{std::move(alg)}, dataType{dataType} {}
+    CompressedFlushBuffer(compression_algs_t algs, LogicalType& dataType)
+        : algs{std::move(algs)}, dataType{dataType} {}
 
     CompressedFlushBuffer(const CompressedFlushBuffer& other) = default;
 
     ColumnChunkMetadata operator()(const uint8_t* buffer, uint64_t /*bufferSize*/,
         BMFileHandle* dataFH, page_idx_t startPageIdx, const ColumnChunkMetadata& metadata) {
+        auto& alg = getCompressionAlg(algs, metadata.compMeta.compression);
         auto valuesRemaining = metadata.numValues;
         const uint8_t* bufferStart = buffer;
         auto compressedBuffer = std::make_unique<uint8_t[]>(BufferPoolConstants::PAGE_4KB_SIZE);
@@ -56,7 +75,7 @@ public:
             metadata.compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
         KU_ASSERT(numValuesPerPage * metadata.numPages >= metadata.numValues);
         while (valuesRemaining > 0) {
-            auto compressedSize = alg->compressNextPage(bufferStart, valuesRemaining,
+            auto compressedSize = alg.compressNextPage(bufferStart, valuesRemaining,
                 compressedBuffer.get(), BufferPoolConstants::PAGE_4KB_SIZE, metadata.compMeta);
             // Avoid underflows (when data is compressed to nothing, numValuesPerPage may be
             // UINT64_MAX)
@@ -89,58 +108,97 @@ public:
 };
 
 class GetCompressionMetadata {
-    std::shared_ptr<CompressionAlg> alg;
+    compression_algs_t algs;
     const LogicalType& dataType;
+    // Chunks using a compression which can never be updated in place need to be rewritten on
+    // every update, so it is only chosen if it needs at most 1/N of the pages of the best
+    // alternative.
+    static constexpr uint64_t MIN_PAGE_RATIO_FOR_OUT_OF_PLACE_UPDATES = 2;
 
 public:
-    GetCompressionMetadata(std::shared_ptr<CompressionAlg> alg, LogicalType& dataType)
-        : alg{std::move(alg)}, dataType{dataType} {}
+    GetCompressionMetadata(compression_algs_t algs, LogicalType& dataType)
+        : algs{std::move(algs)}, dataType{dataType} {}
 
     GetCompressionMetadata(const GetCompressionMetadata& other) = default;
 
     ColumnChunkMetadata operator()(
         const uint8_t* buffer, uint64_t /*bufferSize*/, uint64_t capacity, uint64_t numValues) {
-        auto metadata = alg->getCompressionMetadata(buffer, numValues);
+        KU_ASSERT(!algs.empty());
+        auto bestMetadata = getMetadata(*algs[0], buffer, capacity, numValues);
+        for (auto i = 1u; i < algs.size(); i++) {
+            auto metadata = getMetadata(*algs[i], buffer, capacity, numValues);
+            auto isBetter =
+                metadata.compMeta.canNeverUpdateInPlace() ?
+                    metadata.numPages * MIN_PAGE_RATIO_FOR_OUT_OF_PLACE_UPDATES <=
+                        bestMetadata.numPages :
+                    metadata.numPages < bestMetadata.numPages;
+            if (isBetter) {
+                bestMetadata = metadata;
+            }
+        }
+        return bestMetadata;
+    }
+
+private:
+    ColumnChunkMetadata getMetadata(
+        const CompressionAlg& alg, const uint8_t* buffer, uint64_t capacity, uint64_t numValues) {
+        auto metadata = alg.getCompressionMetadata(buffer, numValues);
         auto numValuesPerPage = metadata.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
         auto numPages = capacity / numValuesPerPage + (capacity % numValuesPerPage == 0 ? 0 : 1);
         return ColumnChunkMetadata(INVALID_PAGE_IDX, numPages, numValues, metadata);
     }
 };
 
-static std::shared_ptr<CompressionAlg> getCompression(
-    const LogicalType& dataType, bool enableCompression) {
+template<typename T>
+static compression_algs_t getIntegerCompressionAlgs() {
+    // IntegerBitpacking must be first, since it is the default and handles uncompressed data.
+    return {std::make_shared<IntegerBitpacking<T>>(), std::make_shared<FrameOfReference<T>>(),
+        std::make_shared<DeltaBitpacking<T>>(), std::make_shared<RunLengthEncoding>(sizeof(T))};
+}
+
+static compression_algs_t getCompression(const LogicalType& dataType, bool enableCompression) {
     if (!enableCompression) {
-        return std::make_shared<Uncompressed>(dataType);
+        return {std::make_shared<Uncompressed>(dataType)};
     }
     switch (dataType.getPhysicalType()) {
     case PhysicalTypeID::INT64: {
-        return std::make_shared<IntegerBitpacking<int64_t>>();
+        return getIntegerCompressionAlgs<int64_t>();
     }
     case PhysicalTypeID::INT32: {
-        return std::make_shared<IntegerBitpacking<int32_t>>();
+        return getIntegerCompressionAlgs<int32_t>();
     }
     case PhysicalTypeID::INT16: {
-        return std::make_shared<IntegerBitpacking<int16_t>>();
+        return getIntegerCompressionAlgs<int16_t>();
     }
     case PhysicalTypeID::INT8: {
-        return std::make_shared<IntegerBitpacking<int8_t>>();
+        return getIntegerCompressionAlgs<int8_t>();
     }
     case PhysicalTypeID::VAR_LIST:
     case PhysicalTypeID::UINT64: {
-        return std::make_shared<IntegerBitpacking<uint64_t>>();
+        return getIntegerCompressionAlgs<uint64_t>();
     }
     case PhysicalTypeID::STRING:
     case PhysicalTypeID::UINT32: {
-        return std::make_shared<IntegerBitpacking<uint32_t>>();
+        return getIntegerCompressionAlgs<uint32_t>();
     }
     case PhysicalTypeID::UINT16: {
-        return std::make_shared<IntegerBitpacking<uint16_t>>();
+        return getIntegerCompressionAlgs<uint16_t>();
     }
     case PhysicalTypeID::UINT8: {
-        return std::make_shared<IntegerBitpacking<uint8_t>>();
+        return getIntegerCompressionAlgs<uint8_t>();
+    }
+    case PhysicalTypeID::DOUBLE: {
+        return {std::make_shared<Uncompressed>(dataType),
+            std::make_shared<FloatCompression<double>>(),
+            std::make_shared<RunLengthEncoding>(sizeof(double))};
+    }
+    case PhysicalTypeID::FLOAT: {
+        return {std::make_shared<Uncompressed>(dataType),
+            std::make_shared<FloatCompression<float>>(),
+            std::make_shared<RunLengthEncoding>(sizeof(float))};
     }
     default: {
-        return std::make_shared<Uncompressed>(dataType);
+        return {std::make_shared<Uncompressed>(dataType)};
     }
     }
 }
@@ -186,6 +244,8 @@ void ColumnChunk::initializeFunction() {
     case PhysicalTypeID::UINT32:
     case PhysicalTypeID::UINT16:
     case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
     case PhysicalTypeID::INT128: {
         auto compression = getCompression(this->dataType, enableCompression);
         flushBufferFunction = CompressedFlushBuffer(compression, this->dataType);
@@ -369,22 +429,45 @@ bool ColumnChunk::numValuesSanityCheck() const {
 
 ColumnChunkMetadata ColumnChunk::getMetadataToFlush() const {
     KU_ASSERT(numValues <= capacity);
+    ColumnChunkMetadata metadata;
     if (enableCompression) {
         // Determine if we can make use of constant compression
         auto constantMetadata = ConstantCompression::analyze(*this);
         if (constantMetadata) {
-            return ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *constantMetadata);
+            metadata = ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *constantMetadata);
+            metadata.stats = computeStats();
+            return metadata;
         }
     }
     KU_ASSERT(bufferSize == getBufferSize(capacity));
-    return getMetadataFunction(buffer.get(), bufferSize, capacity, numValues);
+    metadata = getMetadataFunction(buffer.get(), bufferSize, capacity, numValues);
+    metadata.stats = computeStats();
+    return metadata;
+}
+
+ColumnChunkStats ColumnChunk::computeStats() const {
+    auto physicalType = dataType.getPhysicalType();
+    if (!ColumnChunkStats::isSupported(physicalType)) {
+        return ColumnChunkStats();
+    }
+    auto stats = ColumnChunkStats::empty();
+    for (auto i = 0u; i < numValues; i++) {
+        if (nullChunk && nullChunk->isNull(i)) {
+            continue;
+        }
+        stats.update(buffer.get(), i, physicalType);
+    }
+    return stats;
 }
 
 ColumnChunkMetadata ColumnChunk::flushBuffer(
     BMFileHandle* dataFH, page_idx_t startPageIdx, const ColumnChunkMetadata& metadata) {
     if (!metadata.compMeta.isConstant()) {
         KU_ASSERT(bufferSize == getBufferSize(capacity));
-        return flushBufferFunction(buffer.get(), bufferSize, dataFH, startPageIdx, metadata);
+        auto flushedMetadata =
+            flushBufferFunction(buffer.get(), bufferSize, dataFH, startPageIdx, metadata);
+        flushedMetadata.stats = metadata.stats;
+        return flushedMetadata;
     }
     return metadata;
 }
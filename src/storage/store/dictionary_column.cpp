@@ -1,5 +1,6 @@
 #include "storage/store/dictionary_column.h"
 
+#include <algorithm>
 #include <bit>
 
 using namespace kuzu::common;
@@ -11,9 +12,33 @@ namespace storage {
 using string_index_t = DictionaryChunk::string_index_t;
 using string_offset_t = DictionaryChunk::string_offset_t;
 
+// The symbol table takes up to FSSTSymbolTable::MAX_SERIALIZED_SIZE bytes, so smaller string data
+// is unlikely to take fewer pages when compressed.
+static constexpr uint64_t MIN_DATA_SIZE_FOR_FSST = BufferPoolConstants::PAGE_4KB_SIZE;
+
+bool StringColumnPredicate::evaluate(std::string_view value) const {
+    switch (type) {
+    case Type::EQUALS: {
+        KU_ASSERT(values.size() == 1);
+        return value == values[0];
+    }
+    case Type::IN: {
+        return std::find(values.begin(), values.end(), value) != values.end();
+    }
+    case Type::STARTS_WITH: {
+        KU_ASSERT(values.size() == 1);
+        return value.starts_with(values[0]);
+    }
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
 DictionaryColumn::DictionaryColumn(const std::string& name, const MetadataDAHInfo& metaDAHeaderInfo,
     BMFileHandle* dataFH, BMFileHandle* metadataFH, BufferManager* bufferManager, WAL* wal,
-    transaction::Transaction* transaction, RWPropertyStats stats, bool enableCompression) {
+    transaction::Transaction* transaction, RWPropertyStats stats, bool enableCompression)
+    : enableCompression{enableCompression} {
     auto dataColName = StorageUtils::getColumnName(name, StorageUtils::ColumnType::DATA, "");
     dataColumn = std::make_unique<Column>(dataColName, *LogicalType::UINT8(),
         *metaDAHeaderInfo.childrenInfos[0], dataFH, metadataFH, bufferManager, wal, transaction,
@@ -26,6 +51,23 @@ DictionaryColumn::DictionaryColumn(const std::string& name, const MetadataDAHInf
 
 void DictionaryColumn::append(node_group_idx_t nodeGroupIdx, const DictionaryChunk& dictChunk) {
     KU_ASSERT(dictChunk.sanityCheck());
+    if (enableCompression &&
+        dictChunk.getStringDataChunk()->getNumValues() >= MIN_DATA_SIZE_FOR_FSST) {
+        auto dataChunk = ColumnChunkFactory::createColumnChunk(
+            *LogicalType::UINT8(), false /*enableCompression*/, 0 /*capacity*/);
+        // Keep the same capacity, so that there is space for in-place updates
+        auto offsetChunk = ColumnChunkFactory::createColumnChunk(*LogicalType::UINT64(),
+            enableCompression, dictChunk.getOffsetChunk()->getCapacity());
+        if (compressData(dictChunk, *dataChunk, *offsetChunk)) {
+            dataColumn->append(dataChunk.get(), nodeGroupIdx);
+            offsetColumn->append(offsetChunk.get(), nodeGroupIdx);
+            // The data is flushed as-is, so the encoding needs to be recorded separately
+            auto metadata = dataColumn->getMetadata(nodeGroupIdx, TransactionType::WRITE);
+            metadata.compMeta = CompressionMetadata(CompressionType::FSST);
+            dataColumn->getMetadataDA()->update(nodeGroupIdx, metadata);
+            return;
+        }
+    }
     dataColumn->append(dictChunk.getStringDataChunk(), nodeGroupIdx);
     offsetColumn->append(dictChunk.getOffsetChunk(), nodeGroupIdx);
 }
@@ -47,6 +89,9 @@ void DictionaryColumn::scan(
         offsetChunk->resize(std::bit_ceil(offsetMetadata.numValues));
     }
     offsetColumn->scan(transaction, nodeGroupIdx, offsetChunk);
+    if (dataMetadata.compMeta.compression == CompressionType::FSST) {
+        decompressData(dictChunk);
+    }
 }
 
 void DictionaryColumn::scan(Transaction* transaction, node_group_idx_t nodeGroupIdx,
@@ -82,12 +127,13 @@ void DictionaryColumn::scan(Transaction* transaction, node_group_idx_t nodeGroup
     std::vector<string_offset_t> offsets(numOffsetsToScan + 1);
     scanOffsets(transaction, offsetState, offsets.data(), firstOffsetToScan, numOffsetsToScan,
         dataState.metadata.numValues);
+    auto symbolTable = readSymbolTable(transaction, dataState);
 
     for (auto pos = 0u; pos < offsetsToScan.size(); pos++) {
         auto startOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan];
         auto endOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan + 1];
         scanValueToVector(transaction, dataState, startOffset, endOffset, resultVector,
-            offsetsToScan[pos].second);
+            offsetsToScan[pos].second, symbolTable ? &*symbolTable : nullptr);
         auto& scannedString = resultVector->getValue<ku_string_t>(offsetsToScan[pos].second);
         // For each string which has the same index in the dictionary as the one we scanned,
         // copy the scanned string to its position in the result vector
@@ -99,7 +145,45 @@ void DictionaryColumn::scan(Transaction* transaction, node_group_idx_t nodeGroup
     }
 }
 
+void DictionaryColumn::evaluate(Transaction* transaction, node_group_idx_t nodeGroupIdx,
+    const StringColumnPredicate& predicate, std::vector<bool>& result) {
+    auto offsetState = offsetColumn->getReadState(transaction->getType(), nodeGroupIdx);
+    auto dataState = dataColumn->getReadState(transaction->getType(), nodeGroupIdx);
+    auto numStrings = offsetState.metadata.numValues;
+    result.clear();
+    if (numStrings == 0) {
+        return;
+    }
+    std::vector<string_offset_t> offsets(numStrings + 1);
+    scanOffsets(transaction, offsetState, offsets.data(), 0 /*index*/, numStrings,
+        dataState.metadata.numValues);
+    std::string data(dataState.metadata.numValues, '\0');
+    dataColumn->scan(
+        transaction, dataState, 0, dataState.metadata.numValues, (uint8_t*)data.data());
+    auto symbolTable = readSymbolTable(transaction, dataState);
+    std::string decoded;
+    result.resize(numStrings);
+    for (auto i = 0u; i < numStrings; i++) {
+        KU_ASSERT(offsets[i + 1] >= offsets[i]);
+        auto value = std::string_view(data).substr(offsets[i], offsets[i + 1] - offsets[i]);
+        if (symbolTable) {
+            decoded.resize(symbolTable->getDecodedSize((const uint8_t*)value.data(), value.size()));
+            symbolTable->decode(
+                (const uint8_t*)value.data(), value.size(), (uint8_t*)decoded.data());
+            value = decoded;
+        }
+        result[i] = predicate.evaluate(value);
+    }
+}
+
 string_index_t DictionaryColumn::append(node_group_idx_t nodeGroupIdx, std::string_view val) {
+    auto dataState = dataColumn->getReadState(TransactionType::WRITE, nodeGroupIdx);
+    auto symbolTable = readSymbolTable(&DUMMY_WRITE_TRANSACTION, dataState);
+    std::string encoded;
+    if (symbolTable) {
+        symbolTable->encode(val, encoded);
+        val = encoded;
+    }
     auto startOffset = dataColumn->appendValues(
         nodeGroupIdx, reinterpret_cast<const uint8_t*>(val.data()), val.size());
     return offsetColumn->appendValues(
@@ -131,8 +215,20 @@ void DictionaryColumn::scanOffsets(Transaction* transaction, const Column::ReadS
 
 void DictionaryColumn::scanValueToVector(Transaction* transaction,
     const Column::ReadState& dataState, uint64_t startOffset, uint64_t endOffset,
-    ValueVector* resultVector, uint64_t offsetInVector) {
+    ValueVector* resultVector, uint64_t offsetInVector, const FSSTSymbolTable* symbolTable) {
     KU_ASSERT(endOffset >= startOffset);
+    if (symbolTable) {
+        // Only the bytes of this string need to be read and decoded
+        std::vector<uint8_t> encoded(endOffset - startOffset);
+        dataColumn->scan(transaction, dataState, startOffset, endOffset, encoded.data());
+        auto& kuString = StringVector::reserveString(resultVector, offsetInVector,
+            symbolTable->getDecodedSize(encoded.data(), encoded.size()));
+        symbolTable->decode(encoded.data(), encoded.size(), (uint8_t*)kuString.getData());
+        if (!ku_string_t::isShortString(kuString.len)) {
+            memcpy(kuString.prefix, kuString.getData(), ku_string_t::PREFIX_LENGTH);
+        }
+        return;
+    }
     // Add string to vector first and read directly into the vector
     auto& kuString =
         StringVector::reserveString(resultVector, offsetInVector, endOffset - startOffset);
@@ -145,6 +241,11 @@ void DictionaryColumn::scanValueToVector(Transaction* transaction,
 
 bool DictionaryColumn::canCommitInPlace(Transaction* transaction, node_group_idx_t nodeGroupIdx,
     uint64_t numNewStrings, uint64_t totalStringLengthToAdd) {
+    auto dataColumnMetadata = dataColumn->getMetadata(nodeGroupIdx, transaction->getType());
+    if (dataColumnMetadata.compMeta.compression == CompressionType::FSST) {
+        // Encoded strings are larger than the original if most bytes need to be escaped
+        totalStringLengthToAdd *= FSSTSymbolTable::MAX_ENCODED_SIZE_FACTOR;
+    }
     if (!canDataCommitInPlace(transaction, nodeGroupIdx, totalStringLengthToAdd)) {
         return false;
     }
@@ -173,7 +274,7 @@ bool DictionaryColumn::canOffsetCommitInPlace(Transaction* transaction,
     auto dataColumnMetadata = dataColumn->getMetadata(nodeGroupIdx, transaction->getType());
     auto totalStringOffsetsAfterUpdate = dataColumnMetadata.numValues + totalStringLengthToAdd;
     auto offsetCapacity = offsetColumnMetadata.compMeta.numValues(
-                              BufferPoolConstants::PAGE_4KB_SIZE, dataColumn->getDataType()) *
+                              BufferPoolConstants::PAGE_4KB_SIZE, offsetColumn->getDataType()) *
                           offsetColumnMetadata.numPages;
     auto numStringsAfterUpdate = offsetColumnMetadata.numValues + numNewStrings;
     if (numStringsAfterUpdate > offsetCapacity) {
@@ -202,6 +303,70 @@ bool DictionaryColumn::canOffsetCommitInPlace(Transaction* transaction,
     return true;
 }
 
+std::optional<FSSTSymbolTable> DictionaryColumn::readSymbolTable(
+    Transaction* transaction, const Column::ReadState& dataState) {
+    if (dataState.metadata.compMeta.compression != CompressionType::FSST) {
+        return std::nullopt;
+    }
+    auto size = std::min(FSSTSymbolTable::MAX_SERIALIZED_SIZE, dataState.metadata.numValues);
+    std::vector<uint8_t> buffer(size);
+    dataColumn->scan(transaction, dataState, 0, size, buffer.data());
+    return FSSTSymbolTable::deserialize(buffer.data());
+}
+
+bool DictionaryColumn::compressData(
+    const DictionaryChunk& dictChunk, ColumnChunk& dataChunk, ColumnChunk& offsetChunk) const {
+    auto numStrings = dictChunk.getOffsetChunk()->getNumValues();
+    std::vector<std::string_view> strings;
+    strings.reserve(numStrings);
+    for (auto i = 0u; i < numStrings; i++) {
+        strings.push_back(dictChunk.getString(i));
+    }
+    auto symbolTable = FSSTSymbolTable::build(strings);
+    std::string encoded(symbolTable.getSerializedSize(), '\0');
+    symbolTable.serialize((uint8_t*)encoded.data());
+    for (auto i = 0u; i < numStrings; i++) {
+        offsetChunk.setValue<string_offset_t>(encoded.size(), i);
+        symbolTable.encode(strings[i], encoded);
+    }
+    if (encoded.size() >= dictChunk.getStringDataChunk()->getNumValues()) {
+        return false;
+    }
+    offsetChunk.setNumValues(numStrings);
+    // Like DictionaryChunk::appendString, leave space to append strings during in-place updates
+    dataChunk.resize(std::bit_ceil(encoded.size()));
+    memcpy(dataChunk.getData(), encoded.data(), encoded.size());
+    dataChunk.setNumValues(encoded.size());
+    return true;
+}
+
+void DictionaryColumn::decompressData(DictionaryChunk& dictChunk) {
+    auto dataChunk = dictChunk.getStringDataChunk();
+    auto offsetChunk = dictChunk.getOffsetChunk();
+    auto data = dataChunk->getData();
+    auto dataSize = dataChunk->getNumValues();
+    auto symbolTable = FSSTSymbolTable::deserialize(data);
+    auto numStrings = offsetChunk->getNumValues();
+    std::vector<uint8_t> decoded;
+    for (auto i = 0u; i < numStrings; i++) {
+        // The offset of the next string is read before it is overwritten in the next iteration
+        auto startOffset = offsetChunk->getValue<string_offset_t>(i);
+        auto endOffset =
+            i + 1 < numStrings ? offsetChunk->getValue<string_offset_t>(i + 1) : dataSize;
+        KU_ASSERT(endOffset >= startOffset);
+        auto decodedOffset = decoded.size();
+        decoded.resize(
+            decodedOffset + symbolTable.getDecodedSize(data + startOffset, endOffset - startOffset));
+        symbolTable.decode(data + startOffset, endOffset - startOffset, &decoded[decodedOffset]);
+        offsetChunk->setValue<string_offset_t>(decodedOffset, i);
+    }
+    if (decoded.size() > dataChunk->getCapacity()) {
+        dataChunk->resize(std::bit_ceil(decoded.size()));
+    }
+    memcpy(dataChunk->getData(), decoded.data(), decoded.size());
+    dataChunk->setNumValues(decoded.size());
+}
+
 uint64_t DictionaryColumn::getNumValuesInOffsets(
     Transaction* transaction, node_group_idx_t nodeGroupIdx) {
     return offsetColumn->getMetadata(nodeGroupIdx, transaction->getType()).numValues;
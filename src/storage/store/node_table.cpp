@@ -46,6 +46,17 @@ void NodeTable::read(Transaction* transaction, TableReadState& readState, ValueV
     }
 }
 
+bool NodeTable::canSkipScan(Transaction* transaction, ValueVector* nodeIDVector,
+    const std::vector<ColumnPredicate>& predicates) {
+    // Only sequential scans are guaranteed to stay within a single node group.
+    if (predicates.empty() || !nodeIDVector->isSequential()) {
+        return false;
+    }
+    auto startNodeOffset = nodeIDVector->readNodeOffset(0);
+    return tableData->canSkipNodeGroup(
+        transaction, StorageUtils::getNodeGroupIdx(startNodeOffset), predicates);
+}
+
 common::offset_t NodeTable::validateUniquenessConstraint(
     Transaction* tx, const std::vector<common::ValueVector*>& propertyVectors) {
     if (pkIndex == nullptr) {
@@ -63,12 +74,13 @@ common::offset_t NodeTable::validateUniquenessConstraint(
 
 offset_t NodeTable::insert(Transaction* transaction, ValueVector* nodeIDVector,
     const std::vector<common::ValueVector*>& propertyVectors) {
+    transaction->lockTableForWrite(tableID);
     auto maxNodeOffset = 0u;
     for (auto i = 0u; i < nodeIDVector->state->selVector->selectedSize; i++) {
         auto pos = nodeIDVector->state->selVector->selectedPositions[i];
         auto offset =
             ku_dynamic_cast<TablesStatistics*, NodesStoreStatsAndDeletedIDs*>(tablesStatistics)
-                ->addNode(tableID);
+                ->addNode(transaction, tableID);
         if (offset > maxNodeOffset) {
             maxNodeOffset = offset;
         }
@@ -88,6 +100,7 @@ void NodeTable::update(transaction::Transaction* transaction, common::column_id_
     // We should optimize this to take unflat input later.
     KU_ASSERT(nodeIDVector->state->selVector->selectedSize == 1 &&
               propertyVector->state->selVector->selectedSize == 1);
+    transaction->lockTableForWrite(tableID);
     if (columnID == pkColumnID && pkIndex) {
         updatePK(transaction, columnID, nodeIDVector, propertyVector);
     }
@@ -96,6 +109,7 @@ void NodeTable::update(transaction::Transaction* transaction, common::column_id_
 
 void NodeTable::delete_(
     Transaction* transaction, ValueVector* nodeIDVector, ValueVector* pkVector) {
+    transaction->lockTableForWrite(tableID);
     auto readState = std::make_unique<TableReadState>();
     tableData->initializeReadState(transaction, {pkColumnID}, nodeIDVector, readState.get());
     read(transaction, *readState, nodeIDVector, {pkVector});
@@ -111,7 +125,7 @@ void NodeTable::delete_(
         }
         auto nodeOffset = nodeIDVector->readNodeOffset(pos);
         ku_dynamic_cast<TablesStatistics*, NodesStoreStatsAndDeletedIDs*>(tablesStatistics)
-            ->deleteNode(tableID, nodeOffset);
+            ->deleteNode(transaction, tableID, nodeOffset);
     }
     tableData->delete_(transaction, nodeIDVector);
 }
@@ -121,7 +135,7 @@ void NodeTable::addColumn(transaction::Transaction* transaction, const catalog::
     auto nodesStats =
         ku_dynamic_cast<TablesStatistics*, NodesStoreStatsAndDeletedIDs*>(tablesStatistics);
     nodesStats->setPropertyStatisticsForTable(tableID, property.getPropertyID(),
-        PropertyStatistics(!defaultValueVector->hasNoNullsGuarantee()));
+        getDefaultValueStatistics(property, defaultValueVector));
     nodesStats->addMetadataDAHInfo(tableID, *property.getDataType());
     tableData->addColumn(transaction, "", tableData->getColumn(pkColumnID)->getMetadataDA(),
         *nodesStats->getMetadataDAHInfo(transaction, tableID, tableData->getNumColumns()), property,
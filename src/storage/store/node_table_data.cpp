@@ -4,6 +4,7 @@
 #include "storage/local_storage/local_node_table.h"
 #include "storage/local_storage/local_table.h"
 #include "storage/stats/nodes_store_statistics.h"
+#include "storage/store/string_column.h"
 
 using namespace kuzu::catalog;
 using namespace kuzu::common;
@@ -34,22 +35,111 @@ NodeTableData::NodeTableData(BMFileHandle* dataFH, BMFileHandle* metadataFH,
 void NodeTableData::scan(Transaction* transaction, TableReadState& readState,
     ValueVector* nodeIDVector, const std::vector<ValueVector*>& outputVectors) {
     KU_ASSERT(readState.columnIDs.size() == outputVectors.size() && !nodeIDVector->state->isFlat());
+    auto localTableData = transaction->isWriteTransaction() ?
+                              transaction->getLocalStorage()->getLocalTableData(tableID) :
+                              nullptr;
+    std::vector<bool> isColumnScanned(readState.columnIDs.size(), false);
+    for (auto& outputVector : outputVectors) {
+        outputVector->setConstant(false);
+    }
+    // Uncommitted local changes may change whether a node satisfies the filters.
+    if (!localTableData) {
+        for (auto& filter : readState.dictionaryFilters) {
+            auto it = std::find(
+                readState.columnIDs.begin(), readState.columnIDs.end(), filter.predicate.columnID);
+            if (it == readState.columnIDs.end()) {
+                continue;
+            }
+            auto idx = it - readState.columnIDs.begin();
+            KU_ASSERT(columns[*it]->getDataType().getPhysicalType() == PhysicalTypeID::STRING);
+            auto column = ku_dynamic_cast<Column*, StringColumn*>(columns[*it].get());
+            column->scan(transaction, nodeIDVector, outputVectors[idx], filter);
+            isColumnScanned[idx] = true;
+            if (nodeIDVector->state->selVector->selectedSize == 0) {
+                return;
+            }
+        }
+        for (auto& predicate : readState.columnPredicates) {
+            auto it = std::find(
+                readState.columnIDs.begin(), readState.columnIDs.end(), predicate.columnID);
+            if (it == readState.columnIDs.end()) {
+                continue;
+            }
+            auto idx = it - readState.columnIDs.begin();
+            auto& dataType = columns[*it]->getDataType();
+            // Serial columns have no values on disk
+            if (isColumnScanned[idx] || dataType.getLogicalTypeID() == LogicalTypeID::SERIAL ||
+                !ColumnChunkStats::isSupported(dataType.getPhysicalType())) {
+                continue;
+            }
+            columns[*it]->scan(transaction, nodeIDVector, outputVectors[idx], predicate);
+            isColumnScanned[idx] = true;
+            if (nodeIDVector->state->selVector->selectedSize == 0) {
+                return;
+            }
+        }
+    }
+    auto useLookups = readState.lateMaterialization &&
+                      nodeIDVector->state->selVector->selectedSize <=
+                          nodeIDVector->state->getOriginalSize() *
+                              StorageConstants::MAX_SPARSE_LOOKUP_SELECTIVITY;
     for (auto i = 0u; i < readState.columnIDs.size(); i++) {
+        if (isColumnScanned[i]) {
+            continue;
+        }
         if (readState.columnIDs[i] == INVALID_COLUMN_ID) {
             outputVectors[i]->setAllNull();
+            continue;
+        }
+        KU_ASSERT(readState.columnIDs[i] < columns.size());
+        auto column = columns[readState.columnIDs[i]].get();
+        if (useLookups && canLookup(column->getDataType())) {
+            column->lookup(transaction, nodeIDVector, outputVectors[i]);
         } else {
-            KU_ASSERT(readState.columnIDs[i] < columns.size());
-            columns[readState.columnIDs[i]]->scan(transaction, nodeIDVector, outputVectors[i]);
+            column->scan(transaction, nodeIDVector, outputVectors[i]);
         }
     }
-    if (transaction->isWriteTransaction()) {
-        auto localTableData = transaction->getLocalStorage()->getLocalTableData(tableID);
-        if (localTableData) {
-            auto localRelTableData =
-                ku_dynamic_cast<LocalTableData*, LocalNodeTableData*>(localTableData);
-            localRelTableData->scan(nodeIDVector, readState.columnIDs, outputVectors);
+    if (localTableData) {
+        auto localRelTableData =
+            ku_dynamic_cast<LocalTableData*, LocalNodeTableData*>(localTableData);
+        localRelTableData->scan(nodeIDVector, readState.columnIDs, outputVectors);
+        // Local changes may break up runs of values
+        for (auto& outputVector : outputVectors) {
+            outputVector->setConstant(false);
+        }
+    }
+}
+
+bool NodeTableData::canLookup(const LogicalType& dataType) {
+    switch (dataType.getPhysicalType()) {
+    // Lookups of nested types don't support multiple positions in the same vector
+    case PhysicalTypeID::VAR_LIST:
+    case PhysicalTypeID::STRUCT:
+        return false;
+    default:
+        return true;
+    }
+}
+
+bool NodeTableData::canSkipNodeGroup(Transaction* transaction, node_group_idx_t nodeGroupIdx,
+    const std::vector<ColumnPredicate>& predicates) {
+    if (transaction->isWriteTransaction() &&
+        transaction->getLocalStorage()->getLocalTableData(tableID)) {
+        // Uncommitted local changes are not reflected in the zone maps.
+        return false;
+    }
+    for (auto& predicate : predicates) {
+        KU_ASSERT(predicate.columnID < columns.size());
+        auto column = columns[predicate.columnID].get();
+        if (nodeGroupIdx >= column->getNumNodeGroups(transaction)) {
+            return false;
+        }
+        auto metadata = column->getMetadata(nodeGroupIdx, transaction->getType());
+        if (metadata.stats.canSkip(predicate, column->getDataType().getPhysicalType())) {
+            return true;
         }
     }
+    return false;
 }
 
 void NodeTableData::insert(Transaction* transaction, ValueVector* nodeIDVector,
@@ -101,12 +191,23 @@ void NodeTableData::append(kuzu::storage::NodeGroup* nodeGroup) {
     for (auto columnID = 0u; columnID < columns.size(); columnID++) {
         auto columnChunk = nodeGroup->getColumnChunkUnsafe(columnID);
         KU_ASSERT(columnID < columns.size());
-        columns[columnID]->append(columnChunk, nodeGroup->getNodeGroupIdx());
+        auto column = columns[columnID].get();
+        column->append(columnChunk, nodeGroup->getNodeGroupIdx());
+        if (hasPropertyStatistics(*column)) {
+            auto collector = PropertyStatisticsCollector(column->getDataType().getPhysicalType());
+            collector.add(*columnChunk, 0 /* startOffset */, columnChunk->getNumValues());
+            column->getPropertyStatistics().update(collector.finalize());
+        }
     }
 }
 
 void NodeTableData::prepareLocalTableToCommit(
     Transaction* transaction, LocalTableData* localTable) {
+    std::vector<PropertyStatisticsCollector> collectors;
+    collectors.reserve(columns.size());
+    for (auto& column : columns) {
+        collectors.emplace_back(column->getDataType().getPhysicalType());
+    }
     for (auto& [nodeGroupIdx, nodeGroup] : localTable->nodeGroups) {
         for (auto columnID = 0u; columnID < columns.size(); columnID++) {
             auto column = columns[columnID].get();
@@ -115,11 +216,31 @@ void NodeTableData::prepareLocalTableToCommit(
                 continue;
             }
             auto localNodeGroup = ku_dynamic_cast<LocalNodeGroup*, LocalNodeNG*>(nodeGroup.get());
-            column->prepareCommitForChunk(transaction, nodeGroupIdx, columnChunk,
-                localNodeGroup->getInsertInfoRef(columnID),
-                localNodeGroup->getUpdateInfoRef(columnID), {} /* deleteInfo */);
+            auto& insertInfo = localNodeGroup->getInsertInfoRef(columnID);
+            auto& updateInfo = localNodeGroup->getUpdateInfoRef(columnID);
+            column->prepareCommitForChunk(transaction, nodeGroupIdx, columnChunk, insertInfo,
+                updateInfo, {} /* deleteInfo */);
+            if (hasPropertyStatistics(*column)) {
+                for (auto info : {&insertInfo, &updateInfo}) {
+                    for (auto& [offset, rowIdx] : *info) {
+                        auto localVector = columnChunk->getLocalVector(rowIdx);
+                        collectors[columnID].add(*localVector->getVector(),
+                            rowIdx & (DEFAULT_VECTOR_CAPACITY - 1));
+                    }
+                }
+            }
         }
     }
+    for (auto columnID = 0u; columnID < columns.size(); columnID++) {
+        if (hasPropertyStatistics(*columns[columnID])) {
+            columns[columnID]->getPropertyStatistics().update(collectors[columnID].finalize());
+        }
+    }
+}
+
+bool NodeTableData::hasPropertyStatistics(const Column& column) {
+    // Serial values are generated from node offsets and aren't tracked in statistics
+    return column.getDataType().getLogicalTypeID() != LogicalTypeID::SERIAL;
 }
 
 } // namespace storage
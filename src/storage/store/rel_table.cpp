@@ -23,7 +23,8 @@ RelDetachDeleteState::RelDetachDeleteState() {
 RelTable::RelTable(BMFileHandle* dataFH, BMFileHandle* metadataFH, RelsStoreStats* relsStoreStats,
     MemoryManager* memoryManager, RelTableCatalogEntry* relTableEntry, WAL* wal,
     bool enableCompression)
-    : Table{relTableEntry, relsStoreStats, memoryManager, wal} {
+    : Table{relTableEntry, relsStoreStats, memoryManager, wal},
+      srcTableID{relTableEntry->getSrcTableID()}, dstTableID{relTableEntry->getDstTableID()} {
     fwdRelTableData = std::make_unique<RelTableData>(dataFH, metadataFH, bufferManager, wal,
         relTableEntry, relsStoreStats, RelDataDirection::FWD, enableCompression);
     bwdRelTableData = std::make_unique<RelTableData>(dataFH, metadataFH, bufferManager, wal,
@@ -38,21 +39,27 @@ void RelTable::read(Transaction* transaction, TableReadState& readState,
 
 void RelTable::insert(Transaction* transaction, ValueVector* srcNodeIDVector,
     ValueVector* dstNodeIDVector, const std::vector<ValueVector*>& propertyVectors) {
+    transaction->lockTableForWrite(tableID);
+    // The nodes of the rel must not be deleted by another transaction.
+    transaction->lockTableForRead(srcTableID);
+    transaction->lockTableForRead(dstTableID);
     fwdRelTableData->insert(transaction, srcNodeIDVector, dstNodeIDVector, propertyVectors);
     bwdRelTableData->insert(transaction, dstNodeIDVector, srcNodeIDVector, propertyVectors);
     auto relsStats = ku_dynamic_cast<TablesStatistics*, RelsStoreStats*>(tablesStatistics);
-    relsStats->updateNumRelsByValue(tableID, 1);
+    relsStats->updateNumRelsByValue(transaction, tableID, 1);
 }
 
 void RelTable::update(transaction::Transaction* transaction, column_id_t columnID,
     ValueVector* srcNodeIDVector, ValueVector* dstNodeIDVector, ValueVector* relIDVector,
     ValueVector* propertyVector) {
+    transaction->lockTableForWrite(tableID);
     fwdRelTableData->update(transaction, columnID, srcNodeIDVector, relIDVector, propertyVector);
     bwdRelTableData->update(transaction, columnID, dstNodeIDVector, relIDVector, propertyVector);
 }
 
 void RelTable::delete_(Transaction* transaction, ValueVector* srcNodeIDVector,
     ValueVector* dstNodeIDVector, ValueVector* relIDVector) {
+    transaction->lockTableForWrite(tableID);
     auto fwdDeleted =
         fwdRelTableData->delete_(transaction, srcNodeIDVector, dstNodeIDVector, relIDVector);
     auto bwdDeleted =
@@ -60,13 +67,14 @@ void RelTable::delete_(Transaction* transaction, ValueVector* srcNodeIDVector,
     KU_ASSERT(fwdDeleted == bwdDeleted);
     if (fwdDeleted && bwdDeleted) {
         auto relsStats = ku_dynamic_cast<TablesStatistics*, RelsStoreStats*>(tablesStatistics);
-        relsStats->updateNumRelsByValue(tableID, -1);
+        relsStats->updateNumRelsByValue(transaction, tableID, -1);
     }
 }
 
 void RelTable::detachDelete(Transaction* transaction, RelDataDirection direction,
     ValueVector* srcNodeIDVector, RelDetachDeleteState* deleteState) {
     KU_ASSERT(srcNodeIDVector->state->selVector->selectedSize == 1);
+    transaction->lockTableForWrite(tableID);
     auto tableData =
         direction == RelDataDirection::FWD ? fwdRelTableData.get() : bwdRelTableData.get();
     auto reverseTableData =
@@ -76,12 +84,14 @@ void RelTable::detachDelete(Transaction* transaction, RelDataDirection direction
     row_idx_t numRelsDeleted = detachDeleteForCSRRels(transaction, tableData, reverseTableData,
         srcNodeIDVector, relDataReadState.get(), deleteState);
     auto relsStats = ku_dynamic_cast<TablesStatistics*, RelsStoreStats*>(tablesStatistics);
-    relsStats->updateNumRelsByValue(tableID, -numRelsDeleted);
+    relsStats->updateNumRelsByValue(transaction, tableID, -numRelsDeleted);
 }
 
 void RelTable::checkIfNodeHasRels(
     Transaction* transaction, RelDataDirection direction, ValueVector* srcNodeIDVector) {
     KU_ASSERT(srcNodeIDVector->state->isFlat());
+    // No rel of the node must be inserted by another transaction once the check passed.
+    transaction->lockTableForRead(tableID);
     auto nodeIDPos = srcNodeIDVector->state->selVector->selectedPositions[0];
     auto nodeOffset = srcNodeIDVector->getValue<nodeID_t>(nodeIDPos).offset;
     auto res = direction == common::RelDataDirection::FWD ?
@@ -129,7 +139,7 @@ void RelTable::addColumn(
     Transaction* transaction, const Property& property, ValueVector* defaultValueVector) {
     auto relsStats = ku_dynamic_cast<TablesStatistics*, RelsStoreStats*>(tablesStatistics);
     relsStats->setPropertyStatisticsForTable(tableID, property.getPropertyID(),
-        PropertyStatistics{!defaultValueVector->hasNoNullsGuarantee()});
+        getDefaultValueStatistics(property, defaultValueVector));
     relsStats->addMetadataDAHInfo(tableID, *property.getDataType());
     fwdRelTableData->addColumn(transaction,
         RelDataDirectionUtils::relDirectionToString(RelDataDirection::FWD),
@@ -15,7 +15,7 @@ namespace storage {
 
 RelDataReadState::RelDataReadState()
     : startNodeOffset{0}, numNodes{0}, currentNodeOffset{0}, posInCurrentCSR{0},
-      readFromLocalStorage{false}, localNodeGroup{nullptr} {
+      prefetchedCSROffset{0}, readFromLocalStorage{false}, localNodeGroup{nullptr} {
     csrListEntries.resize(StorageConstants::NODE_GROUP_SIZE, {0, 0});
 }
 
@@ -189,6 +189,7 @@ void RelTableData::initializeReadState(Transaction* transaction, std::vector<col
                   readState->csrHeaderChunks.length->getNumValues());
         readState->numNodes = readState->csrHeaderChunks.offset->getNumValues();
         readState->populateCSRListEntries();
+        readState->prefetchedCSROffset = 0;
         if (transaction->isWriteTransaction()) {
             readState->localNodeGroup = getLocalNodeGroup(transaction, nodeGroupIdx);
         }
@@ -196,6 +197,38 @@ void RelTableData::initializeReadState(Transaction* transaction, std::vector<col
     if (nodeOffset != readState->currentNodeOffset) {
         readState->currentNodeOffset = nodeOffset;
     }
+    if (!readState->isOutOfRange(nodeOffset)) {
+        prefetchCSRList(transaction, *readState);
+    }
+}
+
+void RelTableData::prefetchCSRList(Transaction* transaction, RelDataReadState& readState) {
+    auto& csrListEntry =
+        readState.csrListEntries[readState.currentNodeOffset - readState.startNodeOffset];
+    auto csrListEndOffset = csrListEntry.offset + csrListEntry.size;
+    if (csrListEndOffset <= readState.prefetchedCSROffset) {
+        return;
+    }
+    auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(readState.currentNodeOffset);
+    auto prefetchColumns = [&](offset_t startOffset, offset_t endOffset, bool async) {
+        adjColumn->prefetch(transaction, nodeGroupIdx, startOffset, endOffset, async);
+        for (auto columnID : readState.columnIDs) {
+            if (columnID != INVALID_COLUMN_ID) {
+                columns[columnID]->prefetch(
+                    transaction, nodeGroupIdx, startOffset, endOffset, async);
+            }
+        }
+    };
+    auto isSequential = csrListEntry.offset <= readState.prefetchedCSROffset;
+    auto startOffset = std::max(csrListEntry.offset, readState.prefetchedCSROffset);
+    if (csrListEndOffset - startOffset > DEFAULT_VECTOR_CAPACITY) {
+        prefetchColumns(startOffset, csrListEndOffset, false /* async */);
+    }
+    readState.prefetchedCSROffset = csrListEndOffset;
+    if (isSequential) {
+        readState.prefetchedCSROffset += Column::PREFETCH_WINDOW_SIZE;
+        prefetchColumns(csrListEndOffset, readState.prefetchedCSROffset, true /* async */);
+    }
 }
 
 void RelTableData::scan(Transaction* transaction, TableReadState& readState,
@@ -306,9 +339,25 @@ void RelTableData::append(NodeGroup* nodeGroup) {
     csrHeaderColumns.append(csrNodeGroup->getCSRHeader(), nodeGroup->getNodeGroupIdx());
     adjColumn->append(nodeGroup->getColumnChunkUnsafe(0), nodeGroup->getNodeGroupIdx());
     for (auto columnID = 0u; columnID < columns.size(); columnID++) {
-        columns[columnID]->append(
-            nodeGroup->getColumnChunkUnsafe(columnID + 1), nodeGroup->getNodeGroupIdx());
+        auto columnChunk = nodeGroup->getColumnChunkUnsafe(columnID + 1);
+        columns[columnID]->append(columnChunk, nodeGroup->getNodeGroupIdx());
+        // Both directions store the same properties, so statistics are only collected once.
+        if (direction == RelDataDirection::FWD) {
+            updatePropertyStatistics(
+                *columns[columnID], *columnChunk, csrNodeGroup->getCSRHeader());
+        }
+    }
+}
+
+void RelTableData::updatePropertyStatistics(
+    Column& column, const ColumnChunk& columnChunk, const CSRHeaderChunks& header) {
+    auto collector = PropertyStatisticsCollector(column.getDataType().getPhysicalType());
+    // Skip the gaps left between the rels of consecutive nodes
+    for (auto nodeOffset = 0u; nodeOffset < header.offset->getNumValues(); nodeOffset++) {
+        collector.add(
+            columnChunk, header.getStartCSROffset(nodeOffset), header.getCSRLength(nodeOffset));
     }
+    column.getPropertyStatistics().update(collector.finalize());
 }
 
 static length_t getGapSizeForNode(const CSRHeaderChunks& header, offset_t nodeOffset) {
@@ -362,9 +411,35 @@ offset_t RelTableData::findCSROffsetInRegion(
 
 void RelTableData::prepareLocalTableToCommit(Transaction* transaction, LocalTableData* localTable) {
     auto localRelTableData = ku_dynamic_cast<LocalTableData*, LocalRelTableData*>(localTable);
+    std::vector<PropertyStatisticsCollector> collectors;
+    collectors.reserve(columns.size());
+    for (auto& column : columns) {
+        collectors.emplace_back(column->getDataType().getPhysicalType());
+    }
     for (auto& [nodeGroupIdx, nodeGroup] : localRelTableData->nodeGroups) {
         auto relNG = ku_dynamic_cast<LocalNodeGroup*, LocalRelNG*>(nodeGroup.get());
         prepareCommitNodeGroup(transaction, nodeGroupIdx, relNG);
+        if (direction != RelDataDirection::FWD) {
+            continue;
+        }
+        for (auto columnID = 0u; columnID < columns.size(); columnID++) {
+            auto localChunk = relNG->getPropertyChunk(columnID);
+            auto relNGInfo = relNG->getRelNGInfo();
+            for (auto info :
+                {&relNGInfo->getInsertInfo(columnID), &relNGInfo->getUpdateInfo(columnID)}) {
+                for (auto& [srcOffset, rowIdxPerRel] : *info) {
+                    for (auto& [relOffset, rowIdx] : rowIdxPerRel) {
+                        collectors[columnID].add(*localChunk->getLocalVector(rowIdx)->getVector(),
+                            rowIdx & (DEFAULT_VECTOR_CAPACITY - 1));
+                    }
+                }
+            }
+        }
+    }
+    if (direction == RelDataDirection::FWD) {
+        for (auto columnID = 0u; columnID < columns.size(); columnID++) {
+            columns[columnID]->getPropertyStatistics().update(collectors[columnID].finalize());
+        }
     }
 }
 
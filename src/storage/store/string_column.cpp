@@ -31,6 +31,44 @@ void StringColumn::scan(Transaction* transaction, node_group_idx_t nodeGroupIdx,
         offsetInVector);
 }
 
+void StringColumn::scan(Transaction* transaction, ValueVector* nodeIDVector,
+    ValueVector* resultVector, DictionaryFilter& filter) {
+    auto startNodeOffset = nodeIDVector->readNodeOffset(0);
+    KU_ASSERT(startNodeOffset % DEFAULT_VECTOR_CAPACITY == 0);
+    auto [nodeGroupIdx, startOffsetInGroup] =
+        StorageUtils::getNodeGroupIdxAndOffsetInChunk(startNodeOffset);
+    if (filter.nodeGroupIdx != nodeGroupIdx) {
+        filter.nodeGroupIdx = nodeGroupIdx;
+        auto numValues = getMetadata(nodeGroupIdx, transaction->getType()).numValues;
+        auto numStrings = dictionary.getNumValuesInOffsets(transaction, nodeGroupIdx);
+        // Same threshold as in DictionaryColumn::scan: only worthwhile if at least 50% of the
+        // strings are duplicates. Otherwise evaluating the whole dictionary may read more string
+        // data than the scan itself.
+        filter.useDictionary = numStrings <= numValues / 2;
+        if (filter.useDictionary) {
+            dictionary.evaluate(transaction, nodeGroupIdx, filter.predicate, filter.matchingIndices);
+        }
+    }
+    nullColumn->scan(transaction, nodeIDVector, resultVector);
+    if (filter.useDictionary) {
+        scanMatchingIndices(transaction, nodeGroupIdx, startOffsetInGroup, nodeIDVector,
+            resultVector, filter.matchingIndices);
+        return;
+    }
+    scanInternal(transaction, nodeIDVector, resultVector);
+    auto selVector = nodeIDVector->state->selVector.get();
+    auto selectedPositionsBuffer = selVector->getSelectedPositionsBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < selVector->selectedSize; i++) {
+        auto pos = selVector->selectedPositions[i];
+        if (!resultVector->isNull(pos) &&
+            filter.predicate.evaluate(resultVector->getValue<ku_string_t>(pos).getAsStringView())) {
+            selectedPositionsBuffer[numSelected++] = pos;
+        }
+    }
+    selVector->resetSelectorToValuePosBufferWithSize(numSelected);
+}
+
 void StringColumn::scan(Transaction* transaction, node_group_idx_t nodeGroupIdx,
     ColumnChunk* columnChunk, offset_t startOffset, offset_t endOffset) {
     Column::scan(transaction, nodeGroupIdx, columnChunk, startOffset, endOffset);
@@ -143,6 +181,44 @@ void StringColumn::scanFiltered(transaction::Transaction* transaction,
     dictionary.scan(transaction, nodeGroupIdx, offsetsToScan, resultVector, indexState.metadata);
 }
 
+void StringColumn::scanMatchingIndices(transaction::Transaction* transaction,
+    node_group_idx_t nodeGroupIdx, offset_t startOffsetInGroup, ValueVector* nodeIDVector,
+    ValueVector* resultVector, const std::vector<bool>& matchingIndices) {
+    auto selVector = nodeIDVector->state->selVector.get();
+    if (selVector->selectedSize == 0) {
+        return;
+    }
+    // Selected positions are sorted, so the indices are scanned up to the last one.
+    auto numValuesToRead = selVector->selectedPositions[selVector->selectedSize - 1] + 1;
+    auto indices = std::make_unique<string_index_t[]>(numValuesToRead);
+    auto indexState = getReadState(transaction->getType(), nodeGroupIdx);
+    Column::scan(transaction, indexState, startOffsetInGroup, startOffsetInGroup + numValuesToRead,
+        (uint8_t*)indices.get());
+
+    std::vector<std::pair<string_index_t, uint64_t>> offsetsToScan;
+    // Selected positions are only ever moved forward, so this is safe even if selectedPositions
+    // already points to the buffer.
+    auto selectedPositionsBuffer = selVector->getSelectedPositionsBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < selVector->selectedSize; i++) {
+        auto pos = selVector->selectedPositions[i];
+        if (resultVector->isNull(pos)) {
+            continue;
+        }
+        KU_ASSERT(indices[pos] < matchingIndices.size());
+        if (matchingIndices[indices[pos]]) {
+            selectedPositionsBuffer[numSelected++] = pos;
+            offsetsToScan.emplace_back(indices[pos], pos);
+        }
+    }
+    selVector->resetSelectorToValuePosBufferWithSize(numSelected);
+    if (offsetsToScan.size() == 0) {
+        // No value satisfies the filter
+        return;
+    }
+    dictionary.scan(transaction, nodeGroupIdx, offsetsToScan, resultVector, indexState.metadata);
+}
+
 void StringColumn::lookupInternal(
     Transaction* transaction, ValueVector* nodeIDVector, ValueVector* resultVector) {
     KU_ASSERT(dataType.getPhysicalType() == PhysicalTypeID::STRING);
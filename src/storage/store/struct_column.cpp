@@ -67,6 +67,8 @@ void StructColumn::scanInternal(
     for (auto i = 0u; i < childColumns.size(); i++) {
         auto fieldVector = StructVector::getFieldVector(resultVector, i).get();
         childColumns[i]->scan(transaction, nodeIDVector, fieldVector);
+        // Field vectors aren't reset when local changes are applied to the struct vector
+        fieldVector->setConstant(false);
     }
 }
 
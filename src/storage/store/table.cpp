@@ -0,0 +1,21 @@
+#include "storage/store/table.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+PropertyStatistics Table::getDefaultValueStatistics(
+    const catalog::Property& property, ValueVector* defaultValueVector) {
+    auto collector = PropertyStatisticsCollector(property.getDataType()->getPhysicalType());
+    collector.add(*defaultValueVector, defaultValueVector->state->selVector->selectedPositions[0],
+        getNumTuples());
+    auto stats = collector.finalize();
+    if (!defaultValueVector->hasNoNullsGuarantee()) {
+        stats.setHasNull();
+    }
+    return stats;
+}
+
+} // namespace storage
+} // namespace kuzu
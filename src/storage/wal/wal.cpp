@@ -14,7 +14,8 @@ namespace storage {
 WAL::WAL(const std::string& directory, bool readOnly, BufferManager& bufferManager,
     VirtualFileSystem* vfs)
     : logger{LoggerUtils::getLogger(LoggerConstants::LoggerEnum::WAL)}, directory{directory},
-      bufferManager{bufferManager}, isLastLoggedRecordCommit_{false} {
+      bufferManager{bufferManager}, isLastLoggedRecordCommit_{false},
+      hasRecordAppliedByCheckpoint{false} {
     fileHandle = bufferManager.getBMFileHandle(
         vfs->joinPath(directory, std::string(StorageConstants::WAL_FILE_SUFFIX)),
         readOnly ? FileHandle::O_PERSISTENT_FILE_READ_ONLY :
@@ -23,33 +24,103 @@ WAL::WAL(const std::string& directory, bool readOnly, BufferManager& bufferManag
     initCurrentPage();
 }
 
-page_idx_t WAL::logPageUpdateRecord(DBFileID dbFileID, page_idx_t pageIdxInOriginalFile) {
+page_idx_t WAL::logPageUpdateRecord(BMFileHandle& originalFileHandle, DBFileID dbFileID,
+    page_idx_t pageIdxInOriginalFile, bool isNewPage) {
     lock_t lck{mtx};
     auto pageIdxInWAL = fileHandle->addNewPage();
     WALRecord walRecord =
         WALRecord::newPageUpdateRecord(dbFileID, pageIdxInOriginalFile, pageIdxInWAL);
     addNewWALRecordNoLock(walRecord);
+    pageVersions.push_back(WALPageVersion{
+        &originalFileHandle, dbFileID, pageIdxInOriginalFile, pageIdxInWAL, isNewPage});
     return pageIdxInWAL;
 }
 
-page_idx_t WAL::logPageInsertRecord(DBFileID dbFileID, page_idx_t pageIdxInOriginalFile) {
+page_idx_t WAL::logPageInsertRecord(
+    BMFileHandle& originalFileHandle, DBFileID dbFileID, page_idx_t pageIdxInOriginalFile) {
     lock_t lck{mtx};
     auto pageIdxInWAL = fileHandle->addNewPage();
     WALRecord walRecord =
         WALRecord::newPageInsertRecord(dbFileID, pageIdxInOriginalFile, pageIdxInWAL);
     addNewWALRecordNoLock(walRecord);
+    pageVersions.push_back(WALPageVersion{&originalFileHandle, dbFileID, pageIdxInOriginalFile,
+        pageIdxInWAL, true /* isNewPage */});
     return pageIdxInWAL;
 }
 
 void WAL::logCommit(uint64_t transactionID) {
     lock_t lck{mtx};
-    // Flush all pages before committing to make sure that commits only show up in the file when
-    // their data is also written.
+    logPageDeltasNoLock();
+    // Flush the header pages before committing to make sure that commits only show up in the
+    // file when their page deltas are also written.
     flushAllPages();
     WALRecord walRecord = WALRecord::newCommitRecord(transactionID);
     addNewWALRecordNoLock(walRecord);
 }
 
+void WAL::logPageDeltasNoLock() {
+    // Small updates change a few bytes of each page, so only the range of bytes between the first
+    // and the last byte that differs from the original version of the page is logged.
+    auto walPage = std::make_unique<uint8_t[]>(BufferPoolConstants::PAGE_4KB_SIZE);
+    auto originalPage = std::make_unique<uint8_t[]>(BufferPoolConstants::PAGE_4KB_SIZE);
+    std::vector<uint8_t> buffer;
+    std::vector<PendingPageDelta> pendingDeltas;
+    for (auto& pageVersion : pageVersions) {
+        bufferManager.optimisticRead(*fileHandle, pageVersion.pageIdxInWAL, [&](uint8_t* frame) {
+            memcpy(walPage.get(), frame, BufferPoolConstants::PAGE_4KB_SIZE);
+        });
+        uint64_t startOffset = 0;
+        uint64_t endOffset = BufferPoolConstants::PAGE_4KB_SIZE;
+        if (!pageVersion.isNewPage) {
+            bufferManager.optimisticRead(*pageVersion.originalFileHandle,
+                pageVersion.pageIdxInOriginalFile, [&](uint8_t* frame) {
+                    memcpy(originalPage.get(), frame, BufferPoolConstants::PAGE_4KB_SIZE);
+                });
+            while (startOffset < endOffset && walPage[startOffset] == originalPage[startOffset]) {
+                startOffset++;
+            }
+            while (endOffset > startOffset &&
+                   walPage[endOffset - 1] == originalPage[endOffset - 1]) {
+                endOffset--;
+            }
+            if (startOffset == endOffset) {
+                continue;
+            }
+        }
+        auto numBytes = endOffset - startOffset;
+        if (buffer.size() + numBytes > WAL_PAGE_DELTA_BUFFER_SIZE) {
+            writePageDeltasNoLock(buffer, pendingDeltas);
+        }
+        pendingDeltas.push_back(PendingPageDelta{
+            &pageVersion, buffer.size(), (uint16_t)startOffset, (uint16_t)numBytes});
+        buffer.insert(buffer.end(), walPage.get() + startOffset, walPage.get() + endOffset);
+    }
+    writePageDeltasNoLock(buffer, pendingDeltas);
+}
+
+void WAL::writePageDeltasNoLock(
+    std::vector<uint8_t>& buffer, std::vector<PendingPageDelta>& pendingDeltas) {
+    if (pendingDeltas.empty()) {
+        return;
+    }
+    auto numPages =
+        StorageUtils::divideAndRoundUpTo(buffer.size(), BufferPoolConstants::PAGE_4KB_SIZE);
+    auto startOffsetInWAL =
+        (uint64_t)fileHandle->addNewPages(numPages) * BufferPoolConstants::PAGE_4KB_SIZE;
+    buffer.resize(numPages * BufferPoolConstants::PAGE_4KB_SIZE);
+    // The pages of the deltas are never cached, so they are written directly to the WAL file.
+    fileHandle->getFileInfo()->writeFile(buffer.data(), buffer.size(), startOffsetInWAL);
+    for (auto& pendingDelta : pendingDeltas) {
+        auto pageVersion = pendingDelta.pageVersion;
+        WALRecord walRecord = WALRecord::newPageDeltaRecord(pageVersion->dbFileID,
+            pageVersion->pageIdxInOriginalFile, startOffsetInWAL + pendingDelta.offsetInBuffer,
+            pendingDelta.offsetInPage, pendingDelta.numBytes);
+        addNewWALRecordNoLock(walRecord);
+    }
+    buffer.clear();
+    pendingDeltas.clear();
+}
+
 // TODO(Guodong): Turn the boolean into enum, TableType.
 void WAL::logTableStatisticsRecord(bool isNodeTable) {
     lock_t lck{mtx};
@@ -116,18 +187,19 @@ void WAL::clearWAL() {
     initCurrentPage();
     StorageUtils::removeAllWALFiles(directory);
     updatedTables.clear();
+    pageVersions.clear();
 }
 
 void WAL::flushAllPages() {
     if (!isEmptyWAL()) {
         flushHeaderPages();
-        bufferManager.flushAllDirtyPagesInFrames(*fileHandle);
     }
 }
 
 void WAL::initCurrentPage() {
     currentHeaderPageIdx = 0;
     isLastLoggedRecordCommit_ = false;
+    hasRecordAppliedByCheckpoint = false;
     if (fileHandle->getNumPages() == 0) {
         fileHandle->addNewPage();
         resetCurrentHeaderPagePrefix();
@@ -155,6 +227,15 @@ void WAL::addNewWALRecordNoLock(WALRecord& walRecord) {
     incrementNumRecordsInCurrentHeaderPage();
     walRecord.writeWALRecordToBytes(currentHeaderPageBuffer.get(), offsetInCurrentHeaderPage);
     isLastLoggedRecordCommit_ = (WALRecordType::COMMIT_RECORD == walRecord.recordType);
+    switch (walRecord.recordType) {
+    case WALRecordType::PAGE_UPDATE_OR_INSERT_RECORD:
+    case WALRecordType::PAGE_DELTA_RECORD:
+    case WALRecordType::TABLE_STATISTICS_RECORD:
+    case WALRecordType::COMMIT_RECORD:
+        break;
+    default:
+        hasRecordAppliedByCheckpoint = true;
+    }
 }
 
 void WAL::setIsLastRecordCommit() {
@@ -44,6 +44,9 @@ bool WALRecord::operator==(const WALRecord& rhs) const {
     case WALRecordType::PAGE_UPDATE_OR_INSERT_RECORD: {
         return pageInsertOrUpdateRecord == rhs.pageInsertOrUpdateRecord;
     }
+    case WALRecordType::PAGE_DELTA_RECORD: {
+        return pageDeltaRecord == rhs.pageDeltaRecord;
+    }
     case WALRecordType::TABLE_STATISTICS_RECORD: {
         return tableStatisticsRecord == rhs.tableStatisticsRecord;
     }
@@ -83,6 +86,9 @@ std::string walRecordTypeToString(WALRecordType walRecordType) {
     case WALRecordType::PAGE_UPDATE_OR_INSERT_RECORD: {
         return "PAGE_UPDATE_OR_INSERT_RECORD";
     }
+    case WALRecordType::PAGE_DELTA_RECORD: {
+        return "PAGE_DELTA_RECORD";
+    }
     case WALRecordType::TABLE_STATISTICS_RECORD: {
         return "TABLE_STATISTICS_RECORD";
     }
@@ -140,6 +146,15 @@ WALRecord WALRecord::newPageInsertRecord(
         dbFileID, pageIdxInOriginalFile, pageIdxInWAL, true /* is insert */);
 }
 
+WALRecord WALRecord::newPageDeltaRecord(DBFileID dbFileID, uint64_t pageIdxInOriginalFile,
+    uint64_t offsetInWAL, uint16_t offsetInPage, uint16_t numBytes) {
+    WALRecord retVal;
+    retVal.recordType = WALRecordType::PAGE_DELTA_RECORD;
+    retVal.pageDeltaRecord =
+        PageDeltaRecord(dbFileID, pageIdxInOriginalFile, offsetInWAL, offsetInPage, numBytes);
+    return retVal;
+}
+
 WALRecord WALRecord::newCommitRecord(uint64_t transactionID) {
     WALRecord retVal;
     retVal.recordType = WALRecordType::COMMIT_RECORD;
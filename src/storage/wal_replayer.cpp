@@ -2,6 +2,7 @@
 
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "common/exception/storage.h"
+#include "common/task_system/task_scheduler.h"
 #include "storage/storage_manager.h"
 #include "storage/storage_utils.h"
 #include "storage/wal_replayer_utils.h"
@@ -19,16 +20,19 @@ namespace storage {
 // ROLLBACK:            isCheckpoint = false, isRecovering = false
 // RECOVERY_CHECKPOINT: isCheckpoint = true,  isRecovering = true
 WALReplayer::WALReplayer(WAL* wal, StorageManager* storageManager, BufferManager* bufferManager,
-    Catalog* catalog, WALReplayMode replayMode, common::VirtualFileSystem* vfs)
+    Catalog* catalog, WALReplayMode replayMode, common::VirtualFileSystem* vfs,
+    TaskScheduler* taskScheduler)
     : isRecovering{replayMode == WALReplayMode::RECOVERY_CHECKPOINT},
       isCheckpoint{replayMode != WALReplayMode::ROLLBACK}, storageManager{storageManager},
-      bufferManager{bufferManager}, vfs{vfs}, wal{wal}, catalog{catalog} {
+      bufferManager{bufferManager}, vfs{vfs}, taskScheduler{taskScheduler}, wal{wal},
+      catalog{catalog} {
     init();
 }
 
 void WALReplayer::init() {
     walFileHandle = wal->fileHandle;
-    pageBuffer = std::make_unique<uint8_t[]>(BufferPoolConstants::PAGE_4KB_SIZE);
+    pageBuffer = std::make_unique<uint8_t[]>(
+        MAX_NUM_PENDING_PAGE_WRITES * BufferPoolConstants::PAGE_4KB_SIZE);
 }
 
 void WALReplayer::replay() {
@@ -38,13 +42,24 @@ void WALReplayer::replay() {
         throw StorageException(
             "Cannot checkpointInMemory WAL because last logged record is not a commit record.");
     }
+    // Pages prefetched asynchronously by earlier scans must be cached before the pages on disk
+    // and in the BM are updated.
+    bufferManager->waitForPrefetches();
     if (!wal->isEmptyWAL()) {
         auto walIterator = wal->getIterator();
         WALRecord walRecord;
         while (walIterator->hasNextRecord()) {
             walIterator->getNextRecord(walRecord);
+            if (walRecord.recordType != WALRecordType::PAGE_UPDATE_OR_INSERT_RECORD &&
+                walRecord.recordType != WALRecordType::PAGE_DELTA_RECORD) {
+                // Other records may read the database files.
+                flushPendingPageWrites();
+                replayPendingPageDeltas();
+            }
             replayWALRecord(walRecord);
         }
+        flushPendingPageWrites();
+        replayPendingPageDeltas();
     }
     // We next perform an in-memory checkpointing or rolling back of node/relTables.
     if (!wal->getUpdatedTables().empty()) {
@@ -61,6 +76,9 @@ void WALReplayer::replayWALRecord(WALRecord& walRecord) {
     case WALRecordType::PAGE_UPDATE_OR_INSERT_RECORD: {
         replayPageUpdateOrInsertRecord(walRecord);
     } break;
+    case WALRecordType::PAGE_DELTA_RECORD: {
+        replayPageDeltaRecord(walRecord);
+    } break;
     case WALRecordType::TABLE_STATISTICS_RECORD: {
         replayTableStatisticsRecord(walRecord);
     } break;
@@ -95,27 +113,185 @@ void WALReplayer::replayWALRecord(WALRecord& walRecord) {
 }
 
 void WALReplayer::replayPageUpdateOrInsertRecord(const kuzu::storage::WALRecord& walRecord) {
-    // 1. As the first step we copy over the page on disk, regardless of if we are recovering
-    // (and checkpointing) or checkpointing while during regular execution.
+    if (isRecovering) {
+        // The WAL version of the page is only in the WAL file if it was evicted from the buffer
+        // pool, so recovery replays the page delta records logged at commit instead.
+        return;
+    }
+    // 1. As the first step we copy over the page on disk if we are checkpointing. The page is
+    // written together with the pages of the following records.
     auto dbFileID = walRecord.pageInsertOrUpdateRecord.dbFileID;
-    std::unique_ptr<FileInfo> fileInfoOfDBFile =
-        StorageUtils::getFileInfoForReadWrite(wal->getDirectory(), dbFileID, vfs);
+    uint8_t* walPage = nullptr;
     if (isCheckpoint) {
         if (!wal->isLastLoggedRecordCommit()) {
             // Nothing to undo.
             return;
         }
-        walFileHandle->readPage(pageBuffer.get(), walRecord.pageInsertOrUpdateRecord.pageIdxInWAL);
-        fileInfoOfDBFile->writeFile(pageBuffer.get(), BufferPoolConstants::PAGE_4KB_SIZE,
+        walPage = addPendingPageWrite(dbFileID,
             walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile *
                 BufferPoolConstants::PAGE_4KB_SIZE);
+        bufferManager->optimisticRead(*walFileHandle,
+            walRecord.pageInsertOrUpdateRecord.pageIdxInWAL, [&](uint8_t* frame) {
+                memcpy(walPage, frame, BufferPoolConstants::PAGE_4KB_SIZE);
+            });
+    }
+    // 2: We do any in-memory checkpointing or rolling back work to make sure that the system's
+    // in-memory structures are consistent with what is on disk. For example, we update the BM's
+    // image of the pages or InMemDiskArrays used by lists or the WALVersion pageIdxs of pages for
+    // VersionedFileHandles.
+    checkpointOrRollbackVersionedFileHandleAndBufferManager(walRecord, dbFileID, walPage);
+}
+
+void WALReplayer::replayPageDeltaRecord(const WALRecord& walRecord) {
+    // Page deltas are only replayed when recovering. Otherwise, the WAL versions of the pages are
+    // copied by their page update or insert records.
+    if (!isRecovering || !wal->isLastLoggedRecordCommit()) {
+        return;
+    }
+    pendingPageDeltas.push_back(walRecord.pageDeltaRecord);
+}
+
+uint8_t* WALReplayer::addPendingPageWrite(const DBFileID& dbFileID, uint64_t offset) {
+    auto fileInfo = StorageUtils::getFileInfoForReadWrite(wal->getDirectory(), dbFileID, vfs);
+    // Writes of a batch must not overlap.
+    for (auto& pendingPageWrite : pendingPageWrites) {
+        if (pendingPageWrite.offset == offset &&
+            pendingPageWrite.fileInfo->path == fileInfo->path) {
+            flushPendingPageWrites();
+            break;
+        }
+    }
+    if (pendingPageWrites.size() == MAX_NUM_PENDING_PAGE_WRITES) {
+        flushPendingPageWrites();
+    }
+    auto page = pageBuffer.get() + pendingPageWrites.size() * BufferPoolConstants::PAGE_4KB_SIZE;
+    pendingPageWrites.push_back(PendingPageWrite{std::move(fileInfo), offset});
+    return page;
+}
+
+void WALReplayer::flushPendingPageWrites() {
+    if (pendingPageWrites.empty()) {
+        return;
     }
-    if (!isRecovering) {
-        // 2: If we are not recovering, we do any in-memory checkpointing or rolling back work
-        // to make sure that the system's in-memory structures are consistent with what is on
-        // disk. For example, we update the BM's image of the pages or InMemDiskArrays used by
-        // lists or the WALVersion pageIdxs of pages for VersionedFileHandles.
-        checkpointOrRollbackVersionedFileHandleAndBufferManager(walRecord, dbFileID);
+    std::vector<FileIORequest> requests;
+    requests.reserve(pendingPageWrites.size());
+    for (auto i = 0u; i < pendingPageWrites.size(); i++) {
+        requests.push_back(FileIORequest{FileIOType::WRITE, pendingPageWrites[i].fileInfo.get(),
+            pageBuffer.get() + i * BufferPoolConstants::PAGE_4KB_SIZE,
+            BufferPoolConstants::PAGE_4KB_SIZE, pendingPageWrites[i].offset});
+    }
+    vfs->executeIORequests(requests);
+    pendingPageWrites.clear();
+}
+
+namespace {
+
+// Replays the partitions of the pending page deltas, each on a single thread.
+class PageDeltaReplayTask : public Task {
+public:
+    PageDeltaReplayTask(uint64_t numPartitions, std::function<void(uint64_t)> replayPartition)
+        : Task{numPartitions}, numPartitions{numPartitions},
+          replayPartition{std::move(replayPartition)}, nextPartitionIdx{0} {}
+
+    void run() override {
+        auto partitionIdx = nextPartitionIdx.fetch_add(1);
+        while (partitionIdx < numPartitions) {
+            replayPartition(partitionIdx);
+            partitionIdx = nextPartitionIdx.fetch_add(1);
+        }
+    }
+
+private:
+    uint64_t numPartitions;
+    std::function<void(uint64_t)> replayPartition;
+    std::atomic<uint64_t> nextPartitionIdx;
+};
+
+} // namespace
+
+void WALReplayer::replayPendingPageDeltas() {
+    if (pendingPageDeltas.empty()) {
+        return;
+    }
+    std::vector<FilePageDeltas> filesPageDeltas;
+    for (auto& pageDelta : pendingPageDeltas) {
+        auto it = std::find_if(filesPageDeltas.begin(), filesPageDeltas.end(),
+            [&](const auto& fileDeltas) { return fileDeltas.dbFileID == pageDelta.dbFileID; });
+        if (it == filesPageDeltas.end()) {
+            filesPageDeltas.push_back(FilePageDeltas{pageDelta.dbFileID,
+                StorageUtils::getFileInfoForReadWrite(wal->getDirectory(), pageDelta.dbFileID, vfs),
+                std::vector<PageDeltaRecord>{}});
+            it = filesPageDeltas.end() - 1;
+        }
+        it->pageDeltas.push_back(pageDelta);
+    }
+    pendingPageDeltas.clear();
+    std::vector<PageDeltaPartition> partitions;
+    for (auto& filePageDeltas : filesPageDeltas) {
+        auto& pageDeltas = filePageDeltas.pageDeltas;
+        // The sort is stable, so that the deltas of a page are replayed in the order of the WAL.
+        std::stable_sort(pageDeltas.begin(), pageDeltas.end(), [](const auto& a, const auto& b) {
+            return a.pageIdxInOriginalFile < b.pageIdxInOriginalFile;
+        });
+        uint64_t startIdx = 0;
+        while (startIdx < pageDeltas.size()) {
+            auto rangeIdx =
+                pageDeltas[startIdx].pageIdxInOriginalFile >> PAGE_DELTA_PARTITION_NUM_PAGES_LOG2;
+            auto endIdx = startIdx + 1;
+            while (endIdx < pageDeltas.size() &&
+                   (pageDeltas[endIdx].pageIdxInOriginalFile >>
+                       PAGE_DELTA_PARTITION_NUM_PAGES_LOG2) == rangeIdx) {
+                endIdx++;
+            }
+            partitions.push_back(PageDeltaPartition{&filePageDeltas, startIdx, endIdx});
+            startIdx = endIdx;
+        }
+    }
+    if (taskScheduler == nullptr || partitions.size() == 1) {
+        for (auto& partition : partitions) {
+            replayPageDeltaPartition(partition);
+        }
+        return;
+    }
+    auto task = std::make_shared<PageDeltaReplayTask>(partitions.size(),
+        [&](uint64_t partitionIdx) { replayPageDeltaPartition(partitions[partitionIdx]); });
+    taskScheduler->scheduleTaskAndWaitOrError(task, nullptr /* context */);
+}
+
+void WALReplayer::replayPageDeltaPartition(const PageDeltaPartition& partition) const {
+    auto fileInfo = partition.filePageDeltas->fileInfo.get();
+    auto& pageDeltas = partition.filePageDeltas->pageDeltas;
+    auto walFileInfo = walFileHandle->getFileInfo();
+    auto buffer = std::make_unique<uint8_t[]>(
+        MAX_NUM_PENDING_PAGE_WRITES * BufferPoolConstants::PAGE_4KB_SIZE);
+    std::vector<FileIORequest> originalPageReads;
+    std::vector<FileIORequest> pageDeltaReads;
+    std::vector<FileIORequest> pageWrites;
+    auto idx = partition.startIdx;
+    while (idx < partition.endIdx) {
+        // The pages of a batch are distinct, so that its reads and writes do not overlap.
+        do {
+            auto& pageDelta = pageDeltas[idx];
+            auto page = buffer.get() + pageWrites.size() * BufferPoolConstants::PAGE_4KB_SIZE;
+            auto offset = pageDelta.pageIdxInOriginalFile * BufferPoolConstants::PAGE_4KB_SIZE;
+            if (pageDelta.numBytes < BufferPoolConstants::PAGE_4KB_SIZE) {
+                originalPageReads.push_back(FileIORequest{FileIOType::READ, fileInfo, page,
+                    BufferPoolConstants::PAGE_4KB_SIZE, offset});
+            }
+            pageDeltaReads.push_back(FileIORequest{FileIOType::READ, walFileInfo,
+                page + pageDelta.offsetInPage, pageDelta.numBytes, pageDelta.offsetInWAL});
+            pageWrites.push_back(FileIORequest{
+                FileIOType::WRITE, fileInfo, page, BufferPoolConstants::PAGE_4KB_SIZE, offset});
+            idx++;
+        } while (idx < partition.endIdx && pageWrites.size() < MAX_NUM_PENDING_PAGE_WRITES &&
+                 pageDeltas[idx].pageIdxInOriginalFile !=
+                     pageDeltas[idx - 1].pageIdxInOriginalFile);
+        vfs->executeIORequests(originalPageReads);
+        vfs->executeIORequests(pageDeltaReads);
+        vfs->executeIORequests(pageWrites);
+        originalPageReads.clear();
+        pageDeltaReads.clear();
+        pageWrites.clear();
     }
 }
 
@@ -338,16 +514,16 @@ void WALReplayer::truncateFileIfInsertion(
 }
 
 void WALReplayer::checkpointOrRollbackVersionedFileHandleAndBufferManager(
-    const WALRecord& walRecord, const DBFileID& dbFileID) {
+    const WALRecord& walRecord, const DBFileID& dbFileID, uint8_t* walPage) {
     BMFileHandle* fileHandle = getVersionedFileHandleIfWALVersionAndBMShouldBeCleared(dbFileID);
     if (fileHandle) {
         fileHandle->clearWALPageIdxIfNecessary(
             walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile);
         if (isCheckpoint) {
             // Update the page in buffer manager if it is in a frame. Note that we assume
-            // that the pageBuffer currently contains the contents of the WALVersion, so the
-            // caller needs to make sure that this assumption holds.
-            bufferManager->updateFrameIfPageIsInFrameWithoutLock(*fileHandle, pageBuffer.get(),
+            // that the walPage contains the contents of the WALVersion, so the caller needs to
+            // make sure that this assumption holds.
+            bufferManager->updateFrameIfPageIsInFrameWithoutLock(*fileHandle, walPage,
                 walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile);
         } else {
             truncateFileIfInsertion(fileHandle, walRecord.pageInsertOrUpdateRecord);
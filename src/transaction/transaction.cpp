@@ -0,0 +1,43 @@
+#include "transaction/transaction.h"
+
+#include "transaction/transaction_manager.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace transaction {
+
+void Transaction::lockTableForWrite(table_id_t tableID) {
+    if (!isConcurrentWriteTransaction()) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    if (lockedTableIDs.contains(tableID)) {
+        return;
+    }
+    transactionManager->lockTableForWrite(this, tableID);
+    lockedTableIDs.insert(tableID);
+}
+
+void Transaction::lockTableForRead(table_id_t tableID) {
+    if (!isConcurrentWriteTransaction()) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    if (lockedTableIDs.contains(tableID) || readLockedTableIDs.contains(tableID)) {
+        return;
+    }
+    transactionManager->lockTableForRead(this, tableID);
+    readLockedTableIDs.insert(tableID);
+}
+
+bool Transaction::ownsTable(table_id_t tableID) {
+    if (!isConcurrentWriteTransaction()) {
+        return true;
+    }
+    std::unique_lock lck{mtx};
+    return lockedTableIDs.contains(tableID);
+}
+
+} // namespace transaction
+} // namespace kuzu
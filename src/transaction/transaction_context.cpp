@@ -14,7 +14,18 @@ TransactionContext::TransactionContext(main::Database* database)
     : database{database}, mode{TransactionMode::AUTO} {}
 
 TransactionContext::~TransactionContext() {
+    unlockStatement();
     if (activeTransaction) {
+        if (activeTransaction->isConcurrentWriteTransaction()) {
+            // The tables written by the transaction can be written by other transactions once it
+            // ends, so its local changes, e.g., to the local storage of the indexes, are rolled
+            // back first.
+            try {
+                database->rollback(activeTransaction.get(), false /* skipCheckpointing */);
+                return;
+            } catch (std::exception&) { // LCOV_EXCL_START
+            } // LCOV_EXCL_STOP
+        }
         database->transactionManager->rollback(activeTransaction.get());
     }
 }
@@ -22,25 +33,28 @@ TransactionContext::~TransactionContext() {
 void TransactionContext::beginReadTransaction() {
     std::unique_lock<std::mutex> lck{mtx};
     mode = TransactionMode::MANUAL;
-    beginTransactionInternal(TransactionType::READ_ONLY);
+    beginTransactionInternal(TransactionType::READ_ONLY, false /* exclusive */);
 }
 
 void TransactionContext::beginWriteTransaction() {
     std::unique_lock<std::mutex> lck{mtx};
     mode = TransactionMode::MANUAL;
-    beginTransactionInternal(TransactionType::WRITE);
+    // Manual transactions can only run queries.
+    beginTransactionInternal(TransactionType::WRITE, false /* exclusive */);
 }
 
-void TransactionContext::beginAutoTransaction(bool readOnlyStatement) {
+void TransactionContext::beginAutoTransaction(
+    bool readOnlyStatement, bool allowConcurrentWriteTransaction) {
     if (mode == TransactionMode::AUTO && hasActiveTransaction()) {
         activeTransaction.reset();
     }
     beginTransactionInternal(
-        readOnlyStatement ? TransactionType::READ_ONLY : TransactionType::WRITE);
+        readOnlyStatement ? TransactionType::READ_ONLY : TransactionType::WRITE,
+        !allowConcurrentWriteTransaction);
 }
 
 void TransactionContext::validateManualTransaction(
-    bool allowActiveTransaction, bool readOnlyStatement) {
+    bool allowActiveTransaction, bool readOnlyStatement, bool allowConcurrentWriteTransaction) {
     KU_ASSERT(hasActiveTransaction());
     if (activeTransaction->isReadOnly() && !readOnlyStatement) {
         throw ConnectionException("Can't execute a write query inside a read-only transaction.");
@@ -51,6 +65,25 @@ void TransactionContext::validateManualTransaction(
             "or rollback your previous transaction if there is any and issue the query without "
             "beginning a transaction");
     }
+    if (activeTransaction->isConcurrentWriteTransaction() && !readOnlyStatement &&
+        !allowConcurrentWriteTransaction) {
+        throw ConnectionException(
+            "Only queries can write in a transaction running concurrently with other write "
+            "transactions.");
+    }
+}
+
+void TransactionContext::lockStatement() {
+    if (activeTransaction && activeTransaction->isConcurrentWriteTransaction() &&
+        !statementLck.owns_lock()) {
+        statementLck = database->transactionManager->lockStatement();
+    }
+}
+
+void TransactionContext::unlockStatement() {
+    if (statementLck.owns_lock()) {
+        statementLck.unlock();
+    }
 }
 
 void TransactionContext::commit() {
@@ -70,6 +103,7 @@ void TransactionContext::rollbackSkipCheckPointing() {
 }
 
 void TransactionContext::commitInternal(bool skipCheckPointing) {
+    unlockStatement();
     if (!hasActiveTransaction()) {
         return;
     }
@@ -79,6 +113,7 @@ void TransactionContext::commitInternal(bool skipCheckPointing) {
 }
 
 void TransactionContext::rollbackInternal(bool skipCheckPointing) {
+    unlockStatement();
     if (!hasActiveTransaction()) {
         return;
     }
@@ -87,7 +122,7 @@ void TransactionContext::rollbackInternal(bool skipCheckPointing) {
     mode = TransactionMode::AUTO;
 }
 
-void TransactionContext::beginTransactionInternal(TransactionType transactionType) {
+void TransactionContext::beginTransactionInternal(TransactionType transactionType, bool exclusive) {
     if (activeTransaction) {
         throw TransactionManagerException(
             "Connection already has an active transaction. Applications can have one "
@@ -100,7 +135,7 @@ void TransactionContext::beginTransactionInternal(TransactionType transactionTyp
         activeTransaction = database->transactionManager->beginReadOnlyTransaction();
     } break;
     case TransactionType::WRITE: {
-        activeTransaction = database->transactionManager->beginWriteTransaction();
+        activeTransaction = database->transactionManager->beginWriteTransaction(exclusive);
     } break;
     default:
         KU_UNREACHABLE;
@@ -1,28 +1,181 @@
 #include "transaction/transaction_manager.h"
 
-#include <thread>
-
+#include "common/assert.h"
 #include "common/exception/transaction_manager.h"
+#include "common/string_format.h"
 
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace transaction {
 
-std::unique_ptr<Transaction> TransactionManager::beginWriteTransaction() {
-    // We obtain the lock for starting new transactions. In case this cannot be obtained this
-    // ensures calls to other public functions is not restricted.
-    lock_t newTransactionLck{mtxForStartingNewTransactions};
+TransactionManager::~TransactionManager() {
+    stopCheckpointThread();
+}
+
+std::unique_ptr<Transaction> TransactionManager::beginWriteTransaction(bool exclusive) {
+    if (!exclusive && enableConcurrentWriteTransactions) {
+        return beginConcurrentWriteTransaction();
+    }
+    lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+    auto ticket = nextWriteTransactionTicket++;
+    waitingWriteTransactions.push_back(ticket);
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::microseconds(writeTransactionWaitTimeoutInMicros);
+    while (true) {
+        if (!transactionsChanged.wait_until(publicFunctionLck, deadline, [&]() {
+                return !hasActiveWriteTransactionNoLock() &&
+                       activeConcurrentWriteTransactionIDs.empty() &&
+                       waitingWriteTransactions.front() == ticket;
+            })) {
+            leaveWriteTransactionQueueNoLock(ticket);
+            throw TransactionManagerException(
+                "Cannot start a new write transaction in the system. Only one write transaction "
+                "at a time is allowed in the system.");
+        }
+        publicFunctionLck.unlock();
+        // The WAL can only hold the changes of a single write transaction, so the deferred
+        // checkpoint of the last one is run first.
+        try {
+            checkpointDeferredTransaction();
+        } catch (std::exception&) {
+            publicFunctionLck.lock();
+            leaveWriteTransactionQueueNoLock(ticket);
+            throw;
+        }
+        // We obtain the lock for starting new transactions. In case this cannot be obtained this
+        // ensures calls to other public functions is not restricted.
+        lock_t newTransactionLck{mtxForStartingNewTransactions};
+        publicFunctionLck.lock();
+        if (hasActiveWriteTransactionNoLock() || !activeConcurrentWriteTransactionIDs.empty() ||
+            hasDeferredCheckpoint_) {
+            continue;
+        }
+        leaveWriteTransactionQueueNoLock(ticket);
+        auto transaction =
+            std::make_unique<Transaction>(TransactionType::WRITE, ++lastTransactionID, mm);
+        activeWriteTransactionID = lastTransactionID;
+        return transaction;
+    }
+}
+
+std::unique_ptr<Transaction> TransactionManager::beginConcurrentWriteTransaction() {
+    lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::microseconds(writeTransactionWaitTimeoutInMicros);
+    while (true) {
+        // Exclusive write transactions waiting to start go first, so that they are not starved.
+        if (!transactionsChanged.wait_until(publicFunctionLck, deadline, [&]() {
+                return !hasActiveExclusiveWriteTransactionNoLock() &&
+                       waitingWriteTransactions.empty();
+            })) {
+            throw TransactionManagerException(
+                "Cannot start a new write transaction in the system. An exclusive write "
+                "transaction is active or waiting to start.");
+        }
+        publicFunctionLck.unlock();
+        lock_t newTransactionLck{mtxForStartingNewTransactions};
+        publicFunctionLck.lock();
+        if (hasActiveExclusiveWriteTransactionNoLock() || !waitingWriteTransactions.empty()) {
+            continue;
+        }
+        auto transaction =
+            std::make_unique<Transaction>(TransactionType::WRITE, ++lastTransactionID, mm);
+        transaction->transactionManager = this;
+        transaction->startCommitID = lastCommitID;
+        activeConcurrentWriteTransactionIDs.insert(transaction->getID());
+        return transaction;
+    }
+}
+
+void TransactionManager::startCommitOrRollback(Transaction* transaction) {
+    KU_ASSERT(transaction->isConcurrentWriteTransaction());
     lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
-    if (hasActiveWriteTransactionNoLock()) {
+    while (true) {
+        transactionsChanged.wait(
+            publicFunctionLck, [&]() { return !hasActiveWriteTransactionNoLock(); });
+        publicFunctionLck.unlock();
+        // The WAL can only hold the changes of a single write transaction.
+        checkpointDeferredTransaction();
+        publicFunctionLck.lock();
+        if (!hasActiveWriteTransactionNoLock() && !hasDeferredCheckpoint_) {
+            activeWriteTransactionID = transaction->getID();
+            break;
+        }
+    }
+    publicFunctionLck.unlock();
+    mtxForStatements.lock();
+}
+
+void TransactionManager::lockTableForWrite(Transaction* transaction, table_id_t tableID) {
+    lock_t lck{mtxForSerializingPublicFunctionCalls};
+    KU_ASSERT(activeConcurrentWriteTransactionIDs.contains(transaction->getID()));
+    if (tableWriteLocks.contains(tableID) && tableWriteLocks.at(tableID) != transaction->getID()) {
+        throw TransactionManagerException(stringFormat(
+            "Write-write conflict on table {}, which is written by another write transaction.",
+            tableID));
+    }
+    if (tableReadLocks.contains(tableID)) {
+        for (auto transactionID : tableReadLocks.at(tableID)) {
+            if (transactionID != transaction->getID()) {
+                throw TransactionManagerException(
+                    stringFormat("Write-read conflict on table {}, which is read by another write "
+                                 "transaction depending on it.",
+                        tableID));
+            }
+        }
+    }
+    if (lastCommitIDPerTable.contains(tableID) &&
+        lastCommitIDPerTable.at(tableID) > transaction->startCommitID) {
         throw TransactionManagerException(
-            "Cannot start a new write transaction in the system. Only one write transaction at a "
-            "time is allowed in the system.");
+            stringFormat("Write-write conflict on table {}, which was written by a write "
+                         "transaction committed after the current transaction started.",
+                tableID));
     }
-    auto transaction =
-        std::make_unique<Transaction>(TransactionType::WRITE, ++lastTransactionID, mm);
-    activeWriteTransactionID = lastTransactionID;
-    return transaction;
+    tableWriteLocks[tableID] = transaction->getID();
+}
+
+void TransactionManager::lockTableForRead(Transaction* transaction, table_id_t tableID) {
+    lock_t lck{mtxForSerializingPublicFunctionCalls};
+    KU_ASSERT(activeConcurrentWriteTransactionIDs.contains(transaction->getID()));
+    if (tableWriteLocks.contains(tableID) && tableWriteLocks.at(tableID) != transaction->getID()) {
+        throw TransactionManagerException(stringFormat(
+            "Read-write conflict on table {}, which is written by another write transaction.",
+            tableID));
+    }
+    if (lastCommitIDPerTable.contains(tableID) &&
+        lastCommitIDPerTable.at(tableID) > transaction->startCommitID) {
+        throw TransactionManagerException(
+            stringFormat("Read-write conflict on table {}, which was written by a write "
+                         "transaction committed after the current transaction started.",
+                tableID));
+    }
+    tableReadLocks[tableID].insert(transaction->getID());
+}
+
+std::shared_lock<std::shared_mutex> TransactionManager::lockStatement() {
+    return std::shared_lock{mtxForStatements};
+}
+
+void TransactionManager::endConcurrentWriteTransactionNoLock(Transaction* transaction) {
+    for (auto tableID : transaction->lockedTableIDs) {
+        KU_ASSERT(tableWriteLocks.at(tableID) == transaction->getID());
+        tableWriteLocks.erase(tableID);
+    }
+    for (auto tableID : transaction->readLockedTableIDs) {
+        auto& transactionIDs = tableReadLocks.at(tableID);
+        transactionIDs.erase(transaction->getID());
+        if (transactionIDs.empty()) {
+            tableReadLocks.erase(tableID);
+        }
+    }
+    activeConcurrentWriteTransactionIDs.erase(transaction->getID());
+    transactionsChanged.notify_all();
+}
+
+void TransactionManager::leaveWriteTransactionQueueNoLock(uint64_t ticket) {
+    std::erase(waitingWriteTransactions, ticket);
+    transactionsChanged.notify_all();
 }
 
 std::unique_ptr<Transaction> TransactionManager::beginReadOnlyTransaction() {
@@ -30,8 +183,8 @@ std::unique_ptr<Transaction> TransactionManager::beginReadOnlyTransaction() {
     // ensures calls to other public functions is not restricted.
     lock_t newTransactionLck{mtxForStartingNewTransactions};
     lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
-    auto transaction =
-        std::make_unique<Transaction>(TransactionType::READ_ONLY, ++lastTransactionID, mm);
+    auto transaction = std::make_unique<Transaction>(TransactionType::READ_ONLY,
+        ++lastTransactionID, mm, hasDeferredCheckpoint_ /* readsWriteVersion */);
     activeReadOnlyTransactionIDs.insert(transaction->getID());
     return transaction;
 }
@@ -50,12 +203,16 @@ void TransactionManager::manuallyClearActiveWriteTransaction(Transaction* transa
 void TransactionManager::commitOrRollbackNoLock(Transaction* transaction, bool isCommit) {
     if (transaction->isReadOnly()) {
         activeReadOnlyTransactionIDs.erase(transaction->getID());
+        transactionsChanged.notify_all();
         return;
     }
     assertActiveWriteTransactionIsCorrectNoLock(transaction);
     if (isCommit) {
         wal.logCommit(transaction->getID());
         lastCommitID++;
+        for (auto tableID : transaction->lockedTableIDs) {
+            lastCommitIDPerTable[tableID] = lastCommitID;
+        }
     }
 }
 
@@ -77,6 +234,13 @@ void TransactionManager::commit(Transaction* transaction) {
 
 void TransactionManager::rollback(Transaction* transaction) {
     lock_t lck{mtxForSerializingPublicFunctionCalls};
+    if (transaction->isConcurrentWriteTransaction() &&
+        activeWriteTransactionID != transaction->getID()) {
+        // The transaction ends without being rolled back by the database, e.g., when its
+        // connection is closed.
+        endConcurrentWriteTransactionNoLock(transaction);
+        return;
+    }
     commitOrRollbackNoLock(transaction, false /* is rollback */);
     clearActiveWriteTransactionIfWriteTransactionNoLock(transaction);
 }
@@ -88,22 +252,109 @@ void TransactionManager::allowReceivingNewTransactions() {
 void TransactionManager::stopNewTransactionsAndWaitUntilAllReadTransactionsLeave() {
     mtxForStartingNewTransactions.lock();
     lock_t lck{mtxForSerializingPublicFunctionCalls};
-    uint64_t numTimesWaited = 0;
-    while (true) {
+    if (!transactionsChanged.wait_for(lck,
+            std::chrono::microseconds(checkPointWaitTimeoutForTransactionsToLeaveInMicros),
+            [&]() { return activeReadOnlyTransactionIDs.empty(); })) {
+        mtxForStartingNewTransactions.unlock();
+        throw TransactionManagerException(
+            "Timeout waiting for read transactions to leave the system before checkpointing "
+            "a committed write transaction. If you have an open read transaction close and try "
+            "again.");
+    }
+}
+
+void TransactionManager::startCheckpointThread(std::function<void()> checkpointFunc_) {
+    KU_ASSERT(!checkpointThread.joinable());
+    checkpointFunc = std::move(checkpointFunc_);
+    stopCheckpointThread_ = false;
+    checkpointThread = std::thread([this]() { runCheckpointThread(); });
+}
+
+void TransactionManager::stopCheckpointThread() {
+    {
+        lock_t lck{mtxForSerializingPublicFunctionCalls};
+        stopCheckpointThread_ = true;
+        transactionsChanged.notify_all();
+    }
+    if (checkpointThread.joinable()) {
+        checkpointThread.join();
+    }
+}
+
+void TransactionManager::deferCheckpoint(Transaction* transaction) {
+    lock_t lck{mtxForSerializingPublicFunctionCalls};
+    assertActiveWriteTransactionIsCorrectNoLock(transaction);
+    KU_ASSERT(checkpointFunc && !hasDeferredCheckpoint_);
+    clearActiveWriteTransactionIfWriteTransactionNoLock(transaction);
+    hasDeferredCheckpoint_ = true;
+    numDeferredCheckpoints++;
+    transactionsChanged.notify_all();
+}
+
+void TransactionManager::checkpointDeferredTransaction() {
+    tryCheckpointDeferredTransaction(true /* waitForReadTransactions */);
+}
+
+bool TransactionManager::tryCheckpointDeferredTransaction(bool waitForReadTransactions) {
+    lock_t checkpointLck{mtxForCheckpointing};
+    if (!hasDeferredCheckpoint()) {
+        return true;
+    }
+    // Read-only transactions may read the original version of the database, which is updated by
+    // the checkpoint, so new transactions are stopped until it is done.
+    if (waitForReadTransactions) {
+        stopNewTransactionsAndWaitUntilAllReadTransactionsLeave();
+    } else {
+        mtxForStartingNewTransactions.lock();
+        lock_t lck{mtxForSerializingPublicFunctionCalls};
         if (!activeReadOnlyTransactionIDs.empty()) {
-            numTimesWaited++;
-            if (numTimesWaited * THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS >
-                checkPointWaitTimeoutForTransactionsToLeaveInMicros) {
-                mtxForStartingNewTransactions.unlock();
-                throw TransactionManagerException(
-                    "Timeout waiting for read transactions to leave the system before committing "
-                    "and checkpointing a write transaction. If you have an open read transaction "
-                    "close and try again.");
-            }
-            std::this_thread::sleep_for(
-                std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
-        } else {
-            break;
+            mtxForStartingNewTransactions.unlock();
+            return false;
+        }
+    }
+    try {
+        std::unique_lock statementLck{mtxForStatements};
+        checkpointFunc();
+    } catch (std::exception&) {
+        allowReceivingNewTransactions();
+        throw;
+    }
+    {
+        lock_t lck{mtxForSerializingPublicFunctionCalls};
+        hasDeferredCheckpoint_ = false;
+        transactionsChanged.notify_all();
+    }
+    allowReceivingNewTransactions();
+    return true;
+}
+
+void TransactionManager::runCheckpointThread() {
+    lock_t lck{mtxForSerializingPublicFunctionCalls};
+    while (true) {
+        transactionsChanged.wait(lck, [&]() {
+            return stopCheckpointThread_ ||
+                   (hasDeferredCheckpoint_ && activeReadOnlyTransactionIDs.empty());
+        });
+        if (stopCheckpointThread_) {
+            return;
+        }
+        auto deferredCheckpoint = numDeferredCheckpoints;
+        lck.unlock();
+        auto checkpointFailed = false;
+        try {
+            tryCheckpointDeferredTransaction(false /* waitForReadTransactions */);
+        } catch (std::exception&) {
+            checkpointFailed = true;
+        }
+        lck.lock();
+        if (checkpointFailed) {
+            // The checkpoint is retried by the next write transaction, which reports the error, so
+            // wait for it instead of retrying here. A write transaction may have already done so
+            // and deferred its own checkpoint, which is left to this thread.
+            transactionsChanged.wait(lck, [&]() {
+                return stopCheckpointThread_ || !hasDeferredCheckpoint_ ||
+                       numDeferredCheckpoints != deferredCheckpoint;
+            });
         }
     }
 }
@@ -94,6 +94,23 @@ TEST_F(ApiTest, TimeOut) {
     ASSERT_EQ(result->getErrorMessage(), "Interrupted.");
 }
 
+TEST_F(ApiTest, QueryMemoryLimit) {
+    auto query = "MATCH (a:person)-[:knows]->(b:person) RETURN a.fName, b.fName ORDER BY a.ID;";
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_GT(result->getQuerySummary()->getPeakMemory(), 0);
+    conn->setQueryMemoryLimit(1 /* numBytes */);
+    ASSERT_EQ(conn->getQueryMemoryLimit(), 1);
+    result = conn->query(query);
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_TRUE(result->getErrorMessage().starts_with(
+        "Buffer manager exception: The query exceeded its memory limit of 1 bytes"));
+    ASSERT_TRUE(conn->query("CALL query_memory_limit=0")->isSuccess());
+    result = conn->query(std::string("PROFILE ") + query);
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_NE(result->getNext()->getValue(0)->toString().find("Peak memory: "), std::string::npos);
+}
+
 TEST_F(ApiTest, MultipleQueryExplain) {
     auto result = conn->query("EXPLAIN MATCH (a:person)-[:knows]->(b:person), "
                               "(b)-[:knows]->(a) RETURN a.fName, b.fName ORDER BY a.ID; MATCH "
@@ -48,6 +48,42 @@ TEST_F(OptimizerTest, FilterPushDownTest) {
     ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::SCAN_NODE_PROPERTY);
 }
 
+TEST_F(OptimizerTest, ZoneMapPredicatePushDownTest) {
+    auto op = getRoot("MATCH (a:person) WHERE 30 < a.age AND a.fName='Alice' RETURN a.gender;");
+    ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::PROJECTION);
+    op = op->getChild(0);
+    ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::SCAN_NODE_PROPERTY);
+    op = op->getChild(0);
+    ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::FILTER);
+    op = op->getChild(0);
+    ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::SCAN_NODE_PROPERTY);
+    auto scanAge = (planner::LogicalScanNodeProperty*)op.get();
+    ASSERT_EQ(scanAge->getProperties().size(), 1);
+    ASSERT_EQ(scanAge->getPropertyPredicates().size(), 1);
+}
+
+TEST_F(OptimizerTest, LateMaterializationTest) {
+    // Statistics show that no person is older than 100
+    auto op = getRoot("MATCH (a:person) WHERE a.age > 100 RETURN a.gender, a.fName;");
+    ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::PROJECTION);
+    op = op->getChild(0);
+    ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::SCAN_NODE_PROPERTY);
+    auto scanPayload = (planner::LogicalScanNodeProperty*)op.get();
+    ASSERT_EQ(scanPayload->getProperties().size(), 2);
+    ASSERT_TRUE(scanPayload->isLateMaterialization());
+    op = op->getChild(0);
+    ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::FILTER);
+    op = op->getChild(0);
+    ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::SCAN_NODE_PROPERTY);
+    ASSERT_FALSE(((planner::LogicalScanNodeProperty*)op.get())->isLateMaterialization());
+
+    // About half of the persons are older than 30
+    op = getRoot("MATCH (a:person) WHERE a.age > 30 RETURN a.gender;");
+    op = op->getChild(0);
+    ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::SCAN_NODE_PROPERTY);
+    ASSERT_FALSE(((planner::LogicalScanNodeProperty*)op.get())->isLateMaterialization());
+}
+
 TEST_F(OptimizerTest, IndexScanTest) {
     auto op = getRoot("MATCH (a:person) WHERE a.ID = 0 AND a.fName='Alice' RETURN a.gender;");
     ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::PROJECTION);
@@ -1,5 +1,13 @@
+#include <random>
+
+#include "common/constants.h"
 #include "gtest/gtest.h"
+#include "storage/compression/bitpacking_simd.h"
 #include "storage/compression/compression.h"
+#include "storage/compression/float_compression.h"
+#include "storage/compression/fsst.h"
+#include "storage/compression/run_length_encoding.h"
+#include "storage/storage_utils.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -132,12 +140,14 @@ TEST(CompressionTests, CopyMultiPage) {
     ASSERT_EQ((int64_t*)srcCursor - src.data(), numValues);
 }
 
-template<typename T>
-void integerPackingMultiPage(const std::vector<T>& src) {
-    auto alg = IntegerBitpacking<T>();
+template<typename T, typename Alg = IntegerBitpacking<T>>
+void integerPackingMultiPage(
+    const std::vector<T>& src, LogicalTypeID typeID = LogicalTypeID::INT64) {
+    auto alg = Alg();
     auto pageSize = 4096;
     auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
-    auto numValuesPerPage = metadata.numValues(pageSize, LogicalType(LogicalTypeID::INT64));
+    EXPECT_EQ(metadata.compression, alg.getCompressionType());
+    auto numValuesPerPage = metadata.numValues(pageSize, LogicalType(typeID));
     int64_t numValuesRemaining = src.size();
     const uint8_t* srcCursor = (uint8_t*)src.data();
     auto pages = src.size() / numValuesPerPage + 1;
@@ -288,3 +298,573 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+// Checks that every unpacking kernel supported by the CPU produces the same values as the packed
+// source for all bit widths, with and without sign extension and offsets
+template<typename T>
+void unpackAllBitWidths() {
+    std::mt19937_64 random(0);
+    // Enough chunks that even 1-bit values fill the minimum page size of compressNextPage
+    auto numChunks = 8u;
+    std::vector<T> values(numChunks * BitpackingUtils::CHUNK_SIZE);
+    std::vector<T> result(values.size());
+    auto alg = IntegerBitpacking<T>();
+    for (uint8_t bitWidth = 1; bitWidth < sizeof(T) * 8; bitWidth++) {
+        for (auto hasNegative : {false, true}) {
+            auto valueBits = hasNegative ? bitWidth - 1 : bitWidth;
+            for (auto& value : values) {
+                value = (T)(random() & (valueBits == 0 ? 0 : UINT64_MAX >> (64 - valueBits)));
+                if (hasNegative && random() % 2) {
+                    value = -value;
+                }
+            }
+            auto header = BitpackHeader{bitWidth, hasNegative, 0 /*offset*/};
+            auto metadata =
+                CompressionMetadata(CompressionType::INTEGER_BITPACKING, header.getData());
+            // Sized exactly so that reading past the end is caught by the sanitizers
+            std::vector<uint8_t> packed(values.size() * bitWidth / 8);
+            auto srcCursor = (const uint8_t*)values.data();
+            alg.compressNextPage(srcCursor, values.size(), packed.data(), packed.size(), metadata);
+            for (auto level : {SIMDLevel::SCALAR, SIMDLevel::AVX2, SIMDLevel::AVX512}) {
+                if (level > BitpackingUtils::getSupportedSIMDLevel()) {
+                    continue;
+                }
+                BitpackingUtils::unpackChunks(packed.data(), result.data(), numChunks, header,
+                    level);
+                EXPECT_EQ(result, values) << "bit width " << (int)bitWidth << " with "
+                                          << BitpackingUtils::toString(level);
+                header.offset = (uint64_t)(T)-3;
+                BitpackingUtils::unpackChunks(packed.data(), result.data(), numChunks, header,
+                    level);
+                for (auto i = 0u; i < values.size(); i++) {
+                    EXPECT_EQ(result[i], (T)(values[i] - 3));
+                }
+                header.offset = 0;
+            }
+        }
+    }
+}
+
+TEST(CompressionTests, BitpackingUnpackKernels32) {
+    unpackAllBitWidths<int32_t>();
+    unpackAllBitWidths<uint32_t>();
+}
+
+TEST(CompressionTests, BitpackingUnpackKernels64) {
+    unpackAllBitWidths<int64_t>();
+    unpackAllBitWidths<uint64_t>();
+}
+
+TEST(CompressionTests, FrameOfReferenceTest32) {
+    std::vector<int32_t> src(128, -6);
+    src[5] = 20;
+    auto alg = FrameOfReference<int32_t>();
+    test_compression(alg, src);
+}
+
+TEST(CompressionTests, FrameOfReferenceMultiPageNegative64) {
+    int64_t numValues = 10000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = -10000000 - i;
+    }
+    auto bitpackingHeader =
+        IntegerBitpacking<int64_t>().getBitWidth((uint8_t*)src.data(), src.size());
+    auto forHeader = FrameOfReference<int64_t>().getBitWidth((uint8_t*)src.data(), src.size());
+    EXPECT_LT(forHeader.bitWidth, bitpackingHeader.bitWidth);
+    EXPECT_EQ((int64_t)forHeader.offset, -10000000 - numValues + 1);
+
+    integerPackingMultiPage<int64_t, FrameOfReference<int64_t>>(src);
+}
+
+TEST(CompressionTests, FrameOfReferenceMultiPageMixedSign32) {
+    int64_t numValues = 10000;
+    std::vector<int32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i % 2 == 0 ? -i : i;
+    }
+
+    integerPackingMultiPage<int32_t, FrameOfReference<int32_t>>(src, LogicalTypeID::INT32);
+}
+
+TEST(CompressionTests, FrameOfReferenceCanUpdateInPlace) {
+    std::vector<int16_t> src{-100, -50, 0, 27};
+    auto header = FrameOfReference<int16_t>().getBitWidth((uint8_t*)src.data(), src.size());
+    EXPECT_TRUE(FrameOfReference<int16_t>::canUpdateInPlace(-100, header));
+    EXPECT_TRUE(FrameOfReference<int16_t>::canUpdateInPlace(27, header));
+    EXPECT_FALSE(FrameOfReference<int16_t>::canUpdateInPlace(-101, header));
+    EXPECT_FALSE(FrameOfReference<int16_t>::canUpdateInPlace(1000, header));
+}
+
+// Compares the positions selected on the compressed page with those selected by evaluating each
+// comparison on the original values, for every value in src as well as the extremes of T
+template<typename T>
+void selectFromCompressedPage(const CompressionAlg& alg, const std::vector<T>& src) {
+    std::vector<uint8_t> page(BufferPoolConstants::PAGE_4KB_SIZE);
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    auto srcCursor = (const uint8_t*)src.data();
+    alg.compressNextPage(srcCursor, src.size(), page.data(), page.size(), metadata);
+    ASSERT_EQ(srcCursor, (const uint8_t*)(src.data() + src.size()));
+
+    std::vector<T> constants(src);
+    constants.push_back(std::numeric_limits<T>::min());
+    constants.push_back(std::numeric_limits<T>::max());
+    // Select from part of the page, to cover the chunks which are only partially selected
+    uint64_t srcOffset = 5, numValues = src.size() - 13;
+    sel_t posInResult = 3;
+    std::vector<sel_t> selected(numValues);
+    for (auto comparison : {ExpressionType::EQUALS, ExpressionType::NOT_EQUALS,
+             ExpressionType::LESS_THAN, ExpressionType::LESS_THAN_EQUALS,
+             ExpressionType::GREATER_THAN, ExpressionType::GREATER_THAN_EQUALS}) {
+        for (auto constant : constants) {
+            auto predicate = ColumnPredicate(0, comparison, StorageValue::create(constant));
+            auto numSelected = alg.selectFromPage(page.data(), srcOffset, numValues, predicate,
+                metadata, posInResult, selected.data());
+            ASSERT_TRUE(numSelected.has_value());
+            std::vector<sel_t> expected;
+            for (auto i = 0u; i < numValues; i++) {
+                auto value = src[srcOffset + i];
+                bool isSelected = false;
+                switch (comparison) {
+                case ExpressionType::EQUALS:
+                    isSelected = value == constant;
+                    break;
+                case ExpressionType::NOT_EQUALS:
+                    isSelected = value != constant;
+                    break;
+                case ExpressionType::LESS_THAN:
+                    isSelected = value < constant;
+                    break;
+                case ExpressionType::LESS_THAN_EQUALS:
+                    isSelected = value <= constant;
+                    break;
+                case ExpressionType::GREATER_THAN:
+                    isSelected = value > constant;
+                    break;
+                default:
+                    isSelected = value >= constant;
+                }
+                if (isSelected) {
+                    expected.push_back(posInResult + i);
+                }
+            }
+            selected.resize(*numSelected);
+            EXPECT_EQ(selected, expected)
+                << "comparison " << (int)comparison << " with " << std::to_string(constant);
+            selected.resize(numValues);
+        }
+    }
+}
+
+TEST(CompressionTests, SelectFromBitpackedPage32) {
+    std::vector<int32_t> src(300);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = (i * 37) % 101;
+    }
+    selectFromCompressedPage(IntegerBitpacking<int32_t>(), src);
+}
+
+TEST(CompressionTests, SelectFromBitpackedPageNegative64) {
+    std::vector<int64_t> src(300);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = i % 3 == 0 ? -(int64_t)i : (int64_t)i * 1000;
+    }
+    auto metadata = IntegerBitpacking<int64_t>().getCompressionMetadata(
+        (uint8_t*)src.data(), src.size());
+    EXPECT_TRUE(BitpackHeader::readHeader(metadata.data).hasNegative);
+    selectFromCompressedPage(IntegerBitpacking<int64_t>(), src);
+}
+
+TEST(CompressionTests, SelectFromFrameOfReferencePage) {
+    std::vector<int64_t> src(300);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = 1000000 + (i * 7) % 50;
+    }
+    auto header = FrameOfReference<int64_t>().getBitWidth((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(header.offset, 1000000);
+    selectFromCompressedPage(FrameOfReference<int64_t>(), src);
+
+    std::vector<uint8_t> unsignedSrc(300);
+    for (auto i = 0u; i < unsignedSrc.size(); i++) {
+        unsignedSrc[i] = 200 + i % 40;
+    }
+    selectFromCompressedPage(FrameOfReference<uint8_t>(), unsignedSrc);
+
+    std::vector<int16_t> negativeSrc(300);
+    for (auto i = 0u; i < negativeSrc.size(); i++) {
+        negativeSrc[i] = -20000 - (int16_t)(i % 100);
+    }
+    selectFromCompressedPage(FrameOfReference<int16_t>(), negativeSrc);
+}
+
+TEST(CompressionTests, SelectFromUncompressedPage) {
+    std::vector<double> src(300);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = (double)(i % 17) / 4 - 2;
+    }
+    selectFromCompressedPage(Uncompressed(LogicalType(LogicalTypeID::DOUBLE)), src);
+}
+
+TEST(CompressionTests, SelectFromUnsupportedPage) {
+    std::vector<int64_t> src(300);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = i * 3;
+    }
+    auto alg = DeltaBitpacking<int64_t>();
+    std::vector<uint8_t> page(BufferPoolConstants::PAGE_4KB_SIZE);
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    auto srcCursor = (const uint8_t*)src.data();
+    alg.compressNextPage(srcCursor, src.size(), page.data(), page.size(), metadata);
+    std::vector<sel_t> selected(src.size());
+    auto predicate =
+        ColumnPredicate(0, ExpressionType::GREATER_THAN, StorageValue::create<int64_t>(10));
+    EXPECT_FALSE(alg.selectFromPage(page.data(), 0 /*srcOffset*/, src.size(), predicate, metadata,
+                        0 /*posInResult*/, selected.data())
+                     .has_value());
+}
+
+TEST(CompressionTests, DeltaPackingFixedStride64) {
+    int64_t numValues = 100000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = 1700000000000 + 1000 * (int64_t)i;
+    }
+    auto header = DeltaBitpacking<int64_t>().getBitWidth((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(header.bitWidth, 0);
+    EXPECT_EQ(header.offset, 1000u);
+
+    integerPackingMultiPage<int64_t, DeltaBitpacking<int64_t>>(src);
+}
+
+TEST(CompressionTests, DeltaPackingJitter32) {
+    int64_t numValues = 10000;
+    std::vector<int32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = 10 * i + i % 7;
+    }
+    auto header = DeltaBitpacking<int32_t>().getBitWidth((uint8_t*)src.data(), src.size());
+    EXPECT_LT(header.bitWidth,
+        IntegerBitpacking<int32_t>().getBitWidth((uint8_t*)src.data(), src.size()).bitWidth);
+
+    integerPackingMultiPage<int32_t, DeltaBitpacking<int32_t>>(src, LogicalTypeID::INT32);
+}
+
+TEST(CompressionTests, DeltaPackingDecreasingUnsigned64) {
+    int64_t numValues = 10000;
+    std::vector<uint64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = 1000000 - i;
+    }
+    auto header = DeltaBitpacking<uint64_t>().getBitWidth((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(header.bitWidth, 0);
+
+    integerPackingMultiPage<uint64_t, DeltaBitpacking<uint64_t>>(src, LogicalTypeID::UINT64);
+}
+
+TEST(CompressionTests, DeltaPackingWrapAroundUnsigned64) {
+    int64_t numValues = 1000;
+    std::vector<uint64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        // Overflows half way through
+        src[i] = UINT64_MAX - 500 + i;
+    }
+    auto header = DeltaBitpacking<uint64_t>().getBitWidth((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(header.bitWidth, 0);
+
+    integerPackingMultiPage<uint64_t, DeltaBitpacking<uint64_t>>(src, LogicalTypeID::UINT64);
+}
+
+TEST(CompressionTests, DeltaPackingMultiPage8) {
+    int64_t numValues = 10000;
+    std::vector<int8_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i % 30 - 15;
+    }
+
+    integerPackingMultiPage<int8_t, DeltaBitpacking<int8_t>>(src, LogicalTypeID::INT8);
+}
+
+TEST(CompressionTests, DeltaPackingFixedStridePositionsPastUint16) {
+    int64_t numValues = 200000;
+    std::vector<int32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = 2 * i;
+    }
+    auto alg = DeltaBitpacking<int32_t>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::DELTA_BITPACKING);
+    ASSERT_EQ(BitpackHeader::readHeader(metadata.data).bitWidth, 0);
+    auto pageSize = 4096;
+    auto numValuesPerPage = metadata.numValues(pageSize, LogicalType(LogicalTypeID::INT32));
+    ASSERT_LE(numValuesPerPage, (uint64_t)UINT16_MAX + 1);
+    integerPackingMultiPage<int32_t, DeltaBitpacking<int32_t>>(src, LogicalTypeID::INT32);
+
+    // Values are located through a PageCursor, whose position in the page is a uint16_t.
+    std::vector<std::vector<uint8_t>> pages;
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    for (int64_t numValuesRemaining = numValues; numValuesRemaining > 0;
+         numValuesRemaining -= numValuesPerPage) {
+        pages.emplace_back(pageSize);
+        alg.compressNextPage(
+            srcCursor, numValuesRemaining, pages.back().data(), pageSize, metadata);
+    }
+    for (auto pos : {65535ul, 65536ul, 65537ul, 131071ul, 131072ul, 199999ul}) {
+        auto cursor = PageUtils::getPageCursorForPos(pos, numValuesPerPage);
+        int32_t value;
+        alg.decompressFromPage(pages[cursor.pageIdx].data(), cursor.elemPosInPage,
+            (uint8_t*)&value, 0, 1 /*numValues*/, metadata);
+        EXPECT_EQ(value, src[pos]);
+    }
+}
+
+TEST(CompressionTests, DeltaPackingCannotUpdateInPlace) {
+    std::vector<int64_t> src{1, 2, 3, 4};
+    auto alg = DeltaBitpacking<int64_t>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::DELTA_BITPACKING);
+    EXPECT_FALSE(metadata.canAlwaysUpdateInPlace());
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)src.data(), 0, PhysicalTypeID::INT64));
+}
+
+template<typename T>
+void floatCompressionMultiPage(const std::vector<T>& src, LogicalTypeID typeID) {
+    auto alg = FloatCompression<T>();
+    auto pageSize = 4096;
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::ALP);
+    auto numValuesPerPage = metadata.numValues(pageSize, LogicalType(typeID));
+    ASSERT_GT(numValuesPerPage, 0);
+    int64_t numValuesRemaining = src.size();
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    auto pages = src.size() / numValuesPerPage + 1;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    size_t pageNum = 0;
+    while (numValuesRemaining > 0) {
+        ASSERT_LT(pageNum, pages);
+        alg.compressNextPage(
+            srcCursor, numValuesRemaining, dest[pageNum++].data(), pageSize, metadata);
+        numValuesRemaining -= numValuesPerPage;
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    // Values are compared bitwise, since NaN != NaN and -0.0 == 0.0
+    for (auto i = 0u; i < src.size(); i++) {
+        auto page = i / numValuesPerPage;
+        auto indexInPage = i % numValuesPerPage;
+        T value;
+        alg.decompressFromPage(
+            dest[page].data(), indexInPage, (uint8_t*)&value, 0, 1 /*numValues*/, metadata);
+        EXPECT_EQ(memcmp(&src[i], &value, sizeof(T)), 0) << i;
+    }
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        auto page = i / numValuesPerPage;
+        alg.decompressFromPage(dest[page].data(), 0, (uint8_t*)decompressed.data(), i,
+            std::min(numValuesPerPage, (uint64_t)src.size() - i), metadata);
+    }
+    EXPECT_EQ(memcmp(decompressed.data(), src.data(), src.size() * sizeof(T)), 0);
+}
+
+TEST(CompressionTests, FloatCompressionDecimalDouble) {
+    int64_t numValues = 10000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (i * 37 % 100000) / 100.0;
+    }
+    auto metadata = FloatCompression<double>().getCompressionMetadata(
+        (uint8_t*)src.data(), src.size());
+    auto header = ALPHeader::readHeader(metadata.data);
+    EXPECT_EQ(header.exponent - header.factor, 2);
+    EXPECT_EQ(header.exceptionCapacity, 0);
+    EXPECT_LE(header.bitWidth, 17);
+
+    floatCompressionMultiPage(src, LogicalTypeID::DOUBLE);
+}
+
+TEST(CompressionTests, FloatCompressionExceptionsDouble) {
+    int64_t numValues = 10000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = -i / 10.0;
+    }
+    src[0] = -0.0;
+    src[5] = std::numeric_limits<double>::quiet_NaN();
+    src[6] = std::numeric_limits<double>::infinity();
+    src[4000] = 3.141592653589793;
+    src[9999] = 1e300;
+
+    floatCompressionMultiPage(src, LogicalTypeID::DOUBLE);
+}
+
+TEST(CompressionTests, FloatCompressionFloat) {
+    int64_t numValues = 10000;
+    std::vector<float> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (i % 2000) / 4.0f - 100.0f;
+    }
+    src[123] = 0.1f;
+
+    floatCompressionMultiPage(src, LogicalTypeID::FLOAT);
+}
+
+TEST(CompressionTests, FloatCompressionIncompressible) {
+    std::vector<double> src(1000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = 1.0 / (i + 3);
+    }
+    auto metadata = FloatCompression<double>().getCompressionMetadata(
+        (uint8_t*)src.data(), src.size());
+    EXPECT_EQ(metadata.compression, CompressionType::UNCOMPRESSED);
+}
+
+template<typename T>
+void runLengthEncodingMultiPage(const std::vector<T>& src, LogicalTypeID typeID) {
+    auto alg = RunLengthEncoding(sizeof(T));
+    auto pageSize = 4096;
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::RLE);
+    EXPECT_TRUE(metadata.canNeverUpdateInPlace());
+    auto numValuesPerPage = metadata.numValues(pageSize, LogicalType(typeID));
+    ASSERT_GT(numValuesPerPage, 0);
+    ASSERT_LE(numValuesPerPage, RunLengthEncoding::MAX_VALUES_PER_PAGE);
+    int64_t numValuesRemaining = src.size();
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    auto pages = src.size() / numValuesPerPage + 1;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    size_t pageNum = 0;
+    while (numValuesRemaining > 0) {
+        ASSERT_LT(pageNum, pages);
+        auto compressedSize = alg.compressNextPage(
+            srcCursor, numValuesRemaining, dest[pageNum++].data(), pageSize, metadata);
+        ASSERT_LE(compressedSize, pageSize);
+        numValuesRemaining -= numValuesPerPage;
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    for (auto i = 0u; i < src.size(); i++) {
+        auto page = i / numValuesPerPage;
+        auto indexInPage = i % numValuesPerPage;
+        T value;
+        alg.decompressFromPage(
+            dest[page].data(), indexInPage, (uint8_t*)&value, 0, 1 /*numValues*/, metadata);
+        EXPECT_EQ(value, src[i]) << i;
+    }
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        auto page = i / numValuesPerPage;
+        auto numValuesInPage = std::min(numValuesPerPage, (uint64_t)src.size() - i);
+        alg.decompressFromPage(dest[page].data(), 0, (uint8_t*)decompressed.data(), i,
+            numValuesInPage, metadata);
+        for (auto start = 0u; start < numValuesInPage; start += 97) {
+            for (auto length = 1u; start + length <= numValuesInPage; length *= 3) {
+                auto begin = src.begin() + i + start;
+                auto isSingleRun =
+                    std::all_of(begin, begin + length, [&](T value) { return value == *begin; });
+                EXPECT_EQ(alg.isSingleRun(dest[page].data(), start, length), isSingleRun)
+                    << i + start << " " << length;
+            }
+        }
+    }
+    EXPECT_EQ(decompressed, src);
+}
+
+TEST(CompressionTests, RunLengthEncodingSorted64) {
+    int64_t numValues = 100000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i / 1000 - 20;
+    }
+    auto metadata =
+        RunLengthEncoding(sizeof(int64_t)).getCompressionMetadata((uint8_t*)src.data(), numValues);
+    // Few enough runs that every page can hold the maximum number of values
+    EXPECT_EQ(metadata.numValues(4096, LogicalType(LogicalTypeID::INT64)),
+        RunLengthEncoding::MAX_VALUES_PER_PAGE);
+    EXPECT_EQ(metadata.toString(), "RLE[65536]");
+
+    runLengthEncodingMultiPage(src, LogicalTypeID::INT64);
+}
+
+TEST(CompressionTests, RunLengthEncodingShortRuns32) {
+    int64_t numValues = 10000;
+    std::vector<int32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        // Runs of varying length, including runs of a single value
+        src[i] = (i / (i % 7 + 1)) % 5;
+    }
+    runLengthEncodingMultiPage(src, LogicalTypeID::INT32);
+}
+
+TEST(CompressionTests, RunLengthEncodingNoRuns8) {
+    int64_t numValues = 3000;
+    std::vector<uint8_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i;
+    }
+    // Every value is its own run, so at most one run per 3 bytes fits in a page
+    auto metadata = RunLengthEncoding(sizeof(uint8_t))
+                        .getCompressionMetadata((uint8_t*)src.data(), numValues);
+    EXPECT_EQ(metadata.numValues(4096, LogicalType(LogicalTypeID::UINT8)), (4096 - 8) / 3);
+
+    runLengthEncodingMultiPage(src, LogicalTypeID::UINT8);
+}
+
+TEST(CompressionTests, RunLengthEncodingDouble) {
+    int64_t numValues = 10000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (i / 300) * 0.25;
+    }
+    runLengthEncodingMultiPage(src, LogicalTypeID::DOUBLE);
+}
+
+static void fsstRoundTrip(const FSSTSymbolTable& table, const std::vector<std::string>& strings) {
+    std::vector<uint8_t> serialized(table.getSerializedSize());
+    table.serialize(serialized.data());
+    EXPECT_LE(serialized.size(), FSSTSymbolTable::MAX_SERIALIZED_SIZE);
+    auto deserialized = FSSTSymbolTable::deserialize(serialized.data());
+    for (auto& value : strings) {
+        std::string encoded;
+        table.encode(value, encoded);
+        EXPECT_LE(encoded.size(), value.size() * FSSTSymbolTable::MAX_ENCODED_SIZE_FACTOR);
+        auto decodedSize = deserialized.getDecodedSize((uint8_t*)encoded.data(), encoded.size());
+        ASSERT_EQ(decodedSize, value.size());
+        std::string decoded(decodedSize, '\0');
+        deserialized.decode((uint8_t*)encoded.data(), encoded.size(), (uint8_t*)decoded.data());
+        EXPECT_EQ(decoded, value);
+    }
+}
+
+TEST(CompressionTests, FSSTUrls) {
+    std::vector<std::string> strings;
+    for (auto i = 0u; i < 5000; i++) {
+        strings.push_back("https://www.example.com/products/category-" + std::to_string(i % 50) +
+                          "/item?id=" + std::to_string(i));
+    }
+    auto table = FSSTSymbolTable::build({strings.begin(), strings.end()});
+    EXPECT_GT(table.getNumSymbols(), 0);
+    uint64_t size = 0, encodedSize = 0;
+    for (auto& value : strings) {
+        std::string encoded;
+        table.encode(value, encoded);
+        size += value.size();
+        encodedSize += encoded.size();
+    }
+    EXPECT_LT(encodedSize * 2, size);
+    // Strings which weren't part of the sample still round trip
+    strings.push_back("");
+    strings.push_back("ftp://\xff\xfe\x00\x01/unrelated");
+    fsstRoundTrip(table, strings);
+}
+
+TEST(CompressionTests, FSSTBinary) {
+    std::vector<std::string> strings;
+    for (auto i = 0u; i < 1000; i++) {
+        std::string value;
+        for (auto j = 0u; j < i % 37; j++) {
+            value.push_back((char)((i * 31 + j * 17) % 256));
+        }
+        strings.push_back(value);
+    }
+    auto table = FSSTSymbolTable::build({strings.begin(), strings.end()});
+    fsstRoundTrip(table, strings);
+    // An empty table escapes every byte
+    fsstRoundTrip(FSSTSymbolTable(), strings);
+}
@@ -0,0 +1,136 @@
+#include <thread>
+
+#include "common/exception/buffer_manager.h"
+#include "common/file_system/virtual_file_system.h"
+#include "gtest/gtest.h"
+#include "storage/buffer_manager/buffer_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+class EvictionPolicyTest : public ::testing::TestWithParam<EvictionPolicyType> {
+public:
+    static constexpr uint64_t NUM_BUFFER_POOL_PAGES = 64;
+    static constexpr uint64_t NUM_HOT_PAGES = 16;
+
+    void SetUp() override {
+        bm = std::make_unique<BufferManager>(
+            NUM_BUFFER_POOL_PAGES * BufferPoolConstants::PAGE_4KB_SIZE, 1ull << 30 /* maxDBSize */,
+            0 /* maxSpillSize */, GetParam());
+        fh = bm->getBMFileHandle("eviction_policy_test", FileHandle::O_IN_MEM_TEMP_FILE_4KB_PAGED,
+            BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, &vfs, PAGE_4KB);
+        fh->addNewPages(4096);
+    }
+    void TearDown() override {
+        fh.reset();
+        bm.reset();
+    }
+
+    void access(page_idx_t startPageIdx, page_idx_t endPageIdx) {
+        for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+            bm->pin(*fh, pageIdx, BufferManager::PageReadPolicy::DONT_READ_PAGE);
+            bm->unpin(*fh, pageIdx);
+        }
+    }
+
+public:
+    VirtualFileSystem vfs;
+    std::unique_ptr<BufferManager> bm;
+    std::unique_ptr<BMFileHandle> fh;
+};
+
+TEST_P(EvictionPolicyTest, HotPagesSurviveLargeScan) {
+    access(0, NUM_HOT_PAGES);
+    // A scan which evicts the hot pages.
+    access(1000, 1000 + NUM_BUFFER_POOL_PAGES);
+    // The hot pages are reloaded shortly after being evicted.
+    access(0, NUM_HOT_PAGES);
+    // A scan over many more pages than fit in the buffer pool.
+    access(2000, 4000);
+    auto statsBefore = fh->getCacheStats();
+    access(0, NUM_HOT_PAGES);
+    auto stats = fh->getCacheStats();
+    auto numHotPageMisses = stats.numCacheMisses - statsBefore.numCacheMisses;
+    if (GetParam() == EvictionPolicyType::TWO_QUEUE) {
+        ASSERT_EQ(numHotPageMisses, 0);
+        ASSERT_EQ(stats.numCacheHits - statsBefore.numCacheHits, NUM_HOT_PAGES);
+    } else {
+        ASSERT_EQ(numHotPageMisses, NUM_HOT_PAGES);
+    }
+}
+
+TEST_P(EvictionPolicyTest, CacheStats) {
+    access(0, NUM_BUFFER_POOL_PAGES);
+    access(0, NUM_BUFFER_POOL_PAGES);
+    access(NUM_BUFFER_POOL_PAGES, 2 * NUM_BUFFER_POOL_PAGES);
+    auto stats = fh->getCacheStats();
+    ASSERT_EQ(stats.numCacheMisses, 2 * NUM_BUFFER_POOL_PAGES);
+    ASSERT_EQ(stats.numCacheHits, NUM_BUFFER_POOL_PAGES);
+    ASSERT_EQ(stats.numEvictions, NUM_BUFFER_POOL_PAGES);
+    auto fileStats = bm->getFileCacheStats();
+    ASSERT_EQ(fileStats.size(), 1);
+    ASSERT_EQ(fileStats[0].filePath, "eviction_policy_test");
+    ASSERT_EQ(fileStats[0].stats.numEvictions, NUM_BUFFER_POOL_PAGES);
+}
+
+TEST_P(EvictionPolicyTest, ConcurrentEnqueue) {
+    static constexpr uint64_t NUM_THREADS = 8;
+    static constexpr uint64_t NUM_CANDIDATES_PER_THREAD = 10000;
+    EvictionQueue queue(EvictionPolicy::createEvictionPolicy(
+        GetParam(), NUM_BUFFER_POOL_PAGES * BufferPoolConstants::PAGE_4KB_SIZE));
+    // The candidates are evictable, so that they are not purged from the policy.
+    std::vector<PageState> pageStates(NUM_THREADS);
+    std::vector<std::thread> threads;
+    for (auto threadIdx = 0u; threadIdx < NUM_THREADS; threadIdx++) {
+        pageStates[threadIdx].tryMark(pageStates[threadIdx].getStateAndVersion());
+        threads.emplace_back([&, threadIdx]() {
+            for (auto i = 0u; i < NUM_CANDIDATES_PER_THREAD; i++) {
+                queue.enqueue(EvictionCandidate{fh.get(), i, &pageStates[threadIdx], 0});
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // The candidates of each thread are dequeued in the order in which they were enqueued.
+    std::vector<uint64_t> numDequeued(NUM_THREADS, 0);
+    EvictionCandidate candidate;
+    while (queue.dequeue(candidate)) {
+        auto threadIdx = candidate.pageState - pageStates.data();
+        ASSERT_EQ(candidate.pageIdx, numDequeued[threadIdx]);
+        numDequeued[threadIdx]++;
+    }
+    for (auto threadIdx = 0u; threadIdx < NUM_THREADS; threadIdx++) {
+        ASSERT_EQ(numDequeued[threadIdx], NUM_CANDIDATES_PER_THREAD);
+    }
+}
+
+TEST_P(EvictionPolicyTest, ConcurrentPinAndUnpin) {
+    static constexpr uint64_t NUM_THREADS = 8;
+    static constexpr uint64_t NUM_ACCESSES_PER_THREAD = 5000;
+    std::vector<std::thread> threads;
+    for (auto threadIdx = 0u; threadIdx < NUM_THREADS; threadIdx++) {
+        threads.emplace_back([&, threadIdx]() {
+            // Each thread accesses its own hot pages, and pages shared by all threads.
+            for (auto i = 0u; i < NUM_ACCESSES_PER_THREAD; i++) {
+                auto pageIdx = i % 2 == 0 ? threadIdx : (i * 7 + threadIdx) % 256;
+                access(pageIdx, pageIdx + 1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto stats = fh->getCacheStats();
+    ASSERT_EQ(stats.numCacheHits + stats.numCacheMisses, NUM_THREADS * NUM_ACCESSES_PER_THREAD);
+    ASSERT_LE(stats.numCacheMisses - stats.numEvictions, NUM_BUFFER_POOL_PAGES);
+}
+
+INSTANTIATE_TEST_SUITE_P(EvictionPolicies, EvictionPolicyTest,
+    ::testing::Values(EvictionPolicyType::FIFO, EvictionPolicyType::TWO_QUEUE));
+
+TEST(EvictionPolicyTypeTest, FromString) {
+    ASSERT_EQ(EvictionPolicyTypeUtils::fromString("2q"), EvictionPolicyType::TWO_QUEUE);
+    ASSERT_EQ(EvictionPolicyTypeUtils::fromString("FIFO"), EvictionPolicyType::FIFO);
+    ASSERT_THROW(EvictionPolicyTypeUtils::fromString("LRU"), BufferManagerException);
+}
@@ -0,0 +1,71 @@
+#include <fcntl.h>
+
+#include <cstring>
+
+#include "common/exception/exception.h"
+#include "common/file_system/virtual_file_system.h"
+#include "graph_test/graph_test.h"
+
+using namespace kuzu::common;
+using namespace kuzu::testing;
+
+class FileIOTest : public EmptyDBTest {
+public:
+    static constexpr uint64_t NUM_FILES = 3;
+    static constexpr uint64_t NUM_PAGES_PER_FILE = 100;
+    static constexpr uint64_t PAGE_SIZE = BufferPoolConstants::PAGE_4KB_SIZE;
+
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        vfs.createDir(databasePath);
+        for (auto i = 0u; i < NUM_FILES; i++) {
+            fileInfos.push_back(vfs.openFile(
+                databasePath + "/file_io_test_" + std::to_string(i), O_RDWR | O_CREAT));
+        }
+    }
+
+    // The batches are larger than the queue depth of an io_uring.
+    std::vector<FileIORequest> getRequests(FileIOType type, uint8_t* buffer) {
+        std::vector<FileIORequest> requests;
+        for (auto pageIdx = 0u; pageIdx < NUM_PAGES_PER_FILE; pageIdx++) {
+            for (auto i = 0u; i < NUM_FILES; i++) {
+                auto bufferOffset = (i * NUM_PAGES_PER_FILE + pageIdx) * PAGE_SIZE;
+                requests.push_back(FileIORequest{type, fileInfos[i].get(), buffer + bufferOffset,
+                    PAGE_SIZE, pageIdx * PAGE_SIZE});
+            }
+        }
+        return requests;
+    }
+
+public:
+    VirtualFileSystem vfs;
+    std::vector<std::unique_ptr<FileInfo>> fileInfos;
+};
+
+TEST_F(FileIOTest, BatchedWritesAndReads) {
+    auto numBytes = NUM_FILES * NUM_PAGES_PER_FILE * PAGE_SIZE;
+    auto data = std::make_unique<uint8_t[]>(numBytes);
+    for (auto i = 0u; i < numBytes; i++) {
+        data[i] = (uint8_t)(i % 251);
+    }
+    vfs.executeIORequests(getRequests(FileIOType::WRITE, data.get()));
+    for (auto i = 0u; i < NUM_FILES; i++) {
+        ASSERT_EQ(fileInfos[i]->getFileSize(), NUM_PAGES_PER_FILE * PAGE_SIZE);
+    }
+    auto readData = std::make_unique<uint8_t[]>(numBytes);
+    vfs.executeIORequests(getRequests(FileIOType::READ, readData.get()));
+    ASSERT_EQ(memcmp(data.get(), readData.get(), numBytes), 0);
+    // Requests may read up to the end of the file.
+    auto pages = std::make_unique<uint8_t[]>(3 * PAGE_SIZE);
+    std::vector<FileIORequest> requests{
+        FileIORequest{FileIOType::READ, fileInfos[0].get(), pages.get(), 2 * PAGE_SIZE,
+            (NUM_PAGES_PER_FILE - 1) * PAGE_SIZE},
+        FileIORequest{FileIOType::READ, fileInfos[1].get(), pages.get() + 2 * PAGE_SIZE,
+            PAGE_SIZE, 0}};
+    vfs.executeIORequests(requests);
+    ASSERT_EQ(
+        memcmp(pages.get(), data.get() + (NUM_PAGES_PER_FILE - 1) * PAGE_SIZE, PAGE_SIZE), 0);
+    ASSERT_EQ(memcmp(pages.get() + 2 * PAGE_SIZE, data.get() + NUM_PAGES_PER_FILE * PAGE_SIZE,
+                  PAGE_SIZE),
+        0);
+}
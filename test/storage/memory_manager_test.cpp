@@ -0,0 +1,171 @@
+#include <cstring>
+#include <thread>
+
+#include "common/exception/buffer_manager.h"
+#include "common/file_system/virtual_file_system.h"
+#include "gtest/gtest.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+class MemoryManagerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        bm = std::make_unique<BufferManager>(
+            64 * BufferPoolConstants::PAGE_256KB_SIZE, 1ull << 30 /* maxDBSize */);
+        mm = std::make_unique<MemoryManager>(bm.get(), &vfs);
+    }
+
+    MemoryAllocatorStats getStats(uint64_t bufferSize) const {
+        return mm->getStats()[MemoryManager::getSizeClassIdx(bufferSize)];
+    }
+
+public:
+    VirtualFileSystem vfs;
+    std::unique_ptr<BufferManager> bm;
+    std::unique_ptr<MemoryManager> mm;
+};
+
+TEST_F(MemoryManagerTest, SizeClasses) {
+    ASSERT_EQ(MemoryManager::getSizeClassIdx(1), 0);
+    ASSERT_EQ(MemoryManager::getSizeClassIdx(4096), 0);
+    ASSERT_EQ(MemoryManager::getSizeClassIdx(4097), 1);
+    ASSERT_EQ(MemoryManager::getSizeClassIdx(BufferPoolConstants::PAGE_256KB_SIZE), 6);
+    ASSERT_EQ(MemoryManager::getSizeClassIdx(MemoryManager::MAX_BUFFER_SIZE), 11);
+    for (auto size : {100ull, 5000ull, 100000ull, 300000ull, 8000000ull}) {
+        auto buffer = mm->allocateBuffer(true /* initializeToZero */, size);
+        auto bufferSize = buffer->allocator->getBufferSize();
+        ASSERT_GE(bufferSize, size);
+        ASSERT_LT(bufferSize, 2 * size + MemoryManager::MIN_BUFFER_SIZE);
+        // The whole buffer is contiguous and writable.
+        memset(buffer->buffer, 0xff, bufferSize);
+        ASSERT_EQ(getStats(bufferSize).numBuffersInUse, 1);
+    }
+    ASSERT_THROW(mm->allocateBuffer(false, MemoryManager::MAX_BUFFER_SIZE + 1),
+        BufferManagerException);
+}
+
+TEST_F(MemoryManagerTest, FreedBuffersAreReused) {
+    std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+    for (auto i = 0u; i < 8; i++) {
+        buffers.push_back(mm->allocateBuffer(false, 8192));
+        memset(buffers.back()->buffer, i, 8192);
+    }
+    buffers.clear();
+    for (auto i = 0u; i < 8; i++) {
+        buffers.push_back(mm->allocateBuffer(false, 8192));
+    }
+    auto stats = getStats(8192);
+    ASSERT_EQ(stats.numBuffers, 8);
+    ASSERT_EQ(stats.numBuffersInUse, 8);
+    ASSERT_EQ(stats.numAllocations, 16);
+}
+
+TEST_F(MemoryManagerTest, ThreadLocalCachesBatchSharedFreeListAccesses) {
+    constexpr uint64_t numThreads = 4;
+    constexpr uint64_t numIterations = 1000;
+    std::vector<std::thread> threads;
+    for (auto t = 0u; t < numThreads; t++) {
+        threads.emplace_back([&]() {
+            for (auto i = 0u; i < numIterations; i++) {
+                std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+                for (auto j = 0u; j < 4; j++) {
+                    buffers.push_back(mm->allocateBuffer(false, 4096));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto stats = getStats(4096);
+    ASSERT_EQ(stats.numBuffersInUse, 0);
+    ASSERT_EQ(stats.numAllocations, numThreads * numIterations * 4);
+    ASSERT_LE(stats.numBuffers, numThreads * 4);
+    // Each thread only accesses the shared free list when its cache runs empty.
+    ASSERT_LE(stats.numSharedFreeListAccesses, numThreads * 4);
+    // Buffers cached by the exited threads are handed back to the shared free list.
+    std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+    for (auto i = 0u; i < stats.numBuffers; i++) {
+        buffers.push_back(mm->allocateBuffer(false, 4096));
+    }
+    ASSERT_EQ(getStats(4096).numBuffers, stats.numBuffers);
+}
+
+TEST(VMRegionTest, HugePagesAndNUMAPolicies) {
+    ASSERT_EQ(NUMAPolicyUtils::fromString("interleave"), NUMAPolicy::INTERLEAVE);
+    ASSERT_EQ(NUMAPolicyUtils::toString(NUMAPolicy::LOCAL), "LOCAL");
+    ASSERT_THROW(NUMAPolicyUtils::fromString("remote"), BufferManagerException);
+    ASSERT_GE(VMRegion::getNumNUMANodes(), 1);
+    VirtualFileSystem vfs;
+    // The frames can be used with any config, even if the kernel ignores it.
+    for (auto policy : {NUMAPolicy::DEFAULT, NUMAPolicy::LOCAL, NUMAPolicy::INTERLEAVE}) {
+        BufferManager bm(16 * BufferPoolConstants::PAGE_256KB_SIZE, 1ull << 30 /* maxDBSize */,
+            0 /* maxSpillSize */, EvictionPolicyType::TWO_QUEUE,
+            VMRegionConfig{true /* useHugePages */, policy});
+        MemoryManager mm(&bm, &vfs);
+        std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+        for (auto i = 0u; i < 16; i++) {
+            buffers.push_back(mm.allocateBuffer(true /* initializeToZero */));
+            memset(buffers.back()->buffer, i, BufferPoolConstants::PAGE_256KB_SIZE);
+        }
+        for (auto i = 0u; i < 16; i++) {
+            ASSERT_EQ(buffers[i]->buffer[BufferPoolConstants::PAGE_256KB_SIZE - 1], i);
+        }
+    }
+}
+
+TEST_F(MemoryManagerTest, MemoryTracker) {
+    auto bufferSize = BufferPoolConstants::PAGE_256KB_SIZE;
+    auto tracker = std::make_shared<MemoryTracker>(4 * bufferSize);
+    std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+    {
+        MemoryTrackerScope scope{tracker.get()};
+        for (auto i = 0u; i < 4; i++) {
+            buffers.push_back(mm->allocateBuffer());
+        }
+        ASSERT_THROW(mm->allocateBuffer(), BufferManagerException);
+    }
+    ASSERT_EQ(tracker->getCurrentMemory(), 4 * bufferSize);
+    // Buffers are released to their tracker by any thread.
+    std::thread([&]() { buffers.pop_back(); }).join();
+    ASSERT_EQ(tracker->getCurrentMemory(), 3 * bufferSize);
+    // Allocations outside of the scope aren't tracked.
+    buffers.push_back(mm->allocateBuffer());
+    buffers.push_back(mm->allocateBuffer());
+    ASSERT_EQ(tracker->getCurrentMemory(), 3 * bufferSize);
+    buffers.clear();
+    ASSERT_EQ(tracker->getCurrentMemory(), 0);
+    ASSERT_EQ(tracker->getPeakMemory(), 4 * bufferSize);
+}
+
+TEST_F(MemoryManagerTest, MemoryTrackerOfPinnedPages) {
+    auto fh = bm->getBMFileHandle("memory_tracker_test", FileHandle::O_IN_MEM_TEMP_FILE_4KB_PAGED,
+        BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, &vfs, PAGE_4KB);
+    fh->addNewPages(3);
+    auto pageSize = BufferPoolConstants::PAGE_4KB_SIZE;
+    auto tracker = std::make_shared<MemoryTracker>();
+    {
+        MemoryTrackerScope scope{tracker.get()};
+        for (auto i = 0u; i < 3; i++) {
+            bm->pin(*fh, i, BufferManager::PageReadPolicy::DONT_READ_PAGE);
+        }
+        ASSERT_EQ(tracker->getCurrentMemory(), 3 * pageSize);
+        bm->unpin(*fh, 0);
+        ASSERT_EQ(tracker->getCurrentMemory(), 2 * pageSize);
+        // A page pinned in another scope isn't released by the scope unpinning it.
+        std::thread([&]() {
+            MemoryTrackerScope otherScope{tracker.get()};
+            bm->unpin(*fh, 1);
+        }).join();
+        ASSERT_EQ(tracker->getCurrentMemory(), 2 * pageSize);
+    }
+    // The pages still accounted to a scope are released when it ends.
+    ASSERT_EQ(tracker->getCurrentMemory(), 0);
+    bm->unpin(*fh, 2);
+    ASSERT_EQ(tracker->getCurrentMemory(), 0);
+    ASSERT_EQ(tracker->getPeakMemory(), 3 * pageSize);
+    fh.reset();
+}
@@ -0,0 +1,219 @@
+#include <fcntl.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include "common/file_system/virtual_file_system.h"
+#include "graph_test/graph_test.h"
+#include "storage/buffer_manager/buffer_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+using namespace kuzu::testing;
+
+class PrefetchTest : public EmptyDBTest {
+public:
+    static constexpr uint64_t NUM_FILE_PAGES = 300;
+
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        vfs.createDir(databasePath);
+        filePath = databasePath + "/prefetch_test";
+        // Each page of the file is filled with the last byte of its page idx.
+        auto fileInfo = vfs.openFile(filePath, O_WRONLY | O_CREAT);
+        auto page = std::make_unique<uint8_t[]>(BufferPoolConstants::PAGE_4KB_SIZE);
+        for (auto pageIdx = 0u; pageIdx < NUM_FILE_PAGES; pageIdx++) {
+            memset(page.get(), (uint8_t)pageIdx, BufferPoolConstants::PAGE_4KB_SIZE);
+            fileInfo->writeFile(page.get(), BufferPoolConstants::PAGE_4KB_SIZE,
+                pageIdx * BufferPoolConstants::PAGE_4KB_SIZE);
+        }
+    }
+    void TearDown() override {
+        fh.reset();
+        bm.reset();
+        EmptyDBTest::TearDown();
+    }
+
+    void openFile(uint64_t numBufferPoolPages) {
+        bm = std::make_unique<BufferManager>(
+            numBufferPoolPages * BufferPoolConstants::PAGE_4KB_SIZE, 1ull << 30 /* maxDBSize */);
+        fh = bm->getBMFileHandle(filePath, FileHandle::O_PERSISTENT_FILE_NO_CREATE,
+            BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, &vfs);
+        ASSERT_EQ(fh->getNumPages(), NUM_FILE_PAGES);
+    }
+
+    void checkPages(page_idx_t startPageIdx, page_idx_t endPageIdx) {
+        for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+            bm->optimisticRead(*fh, pageIdx, [&](uint8_t* frame) {
+                for (auto i = 0u; i < BufferPoolConstants::PAGE_4KB_SIZE; i++) {
+                    ASSERT_EQ(frame[i], (uint8_t)pageIdx);
+                }
+            });
+        }
+    }
+
+public:
+    VirtualFileSystem vfs;
+    std::string filePath;
+    std::unique_ptr<BufferManager> bm;
+    std::unique_ptr<BMFileHandle> fh;
+};
+
+TEST_F(PrefetchTest, PrefetchedPagesAreCached) {
+    openFile(NUM_FILE_PAGES);
+    // Cached pages are skipped.
+    bm->pin(*fh, 10);
+    bm->unpin(*fh, 10);
+    // The range is clamped to the pages of the file.
+    bm->prefetchPages(*fh, 0, NUM_FILE_PAGES + 100);
+    auto stats = fh->getCacheStats();
+    ASSERT_EQ(stats.numPrefetchedPages, NUM_FILE_PAGES - 1);
+    ASSERT_EQ(stats.numCacheMisses, 1);
+    checkPages(0, NUM_FILE_PAGES);
+    stats = fh->getCacheStats();
+    ASSERT_EQ(stats.numCacheMisses, 1);
+    ASSERT_EQ(stats.numCacheHits, NUM_FILE_PAGES);
+}
+
+TEST_F(PrefetchTest, PrefetchStopsWhenBufferPoolIsFull) {
+    openFile(16 /* numBufferPoolPages */);
+    for (auto pageIdx = 0u; pageIdx < 8; pageIdx++) {
+        bm->pin(*fh, pageIdx);
+    }
+    // The prefetched pages are locked until they are read, so only 8 of them fit in the buffer
+    // pool.
+    bm->prefetchPages(*fh, 100, 32);
+    ASSERT_EQ(fh->getCacheStats().numPrefetchedPages, 8);
+    for (auto pageIdx = 0u; pageIdx < 8; pageIdx++) {
+        bm->unpin(*fh, pageIdx);
+    }
+    checkPages(0, 8);
+    checkPages(100, 132);
+}
+
+TEST_F(PrefetchTest, AsyncPrefetch) {
+    openFile(NUM_FILE_PAGES);
+    bm->prefetchPagesAsync(*fh, 0, 100);
+    bm->prefetchPagesAsync(*fh, 200, 100);
+    bm->waitForPrefetches();
+    ASSERT_EQ(fh->getCacheStats().numPrefetchedPages, 200);
+    checkPages(0, NUM_FILE_PAGES);
+    ASSERT_EQ(fh->getCacheStats().numCacheMisses, 100);
+    // Destroying the file handle drops its pending requests.
+    bm->prefetchPagesAsync(*fh, 100, 100);
+    fh.reset();
+}
+
+TEST_F(PrefetchTest, ReadPagesAsExtents) {
+    openFile(NUM_FILE_PAGES);
+    bm->pin(*fh, 10);
+    bm->unpin(*fh, 10);
+    std::vector<page_idx_t> readPageIdxes;
+    auto readPages = [&](page_idx_t startPageIdx, page_idx_t numPages) {
+        readPageIdxes.clear();
+        bm->optimisticReadPages(*fh, startPageIdx, numPages,
+            [&](uint8_t* frame, page_idx_t firstPageIdx, page_idx_t numPagesToRead) {
+                for (auto i = 0u; i < numPagesToRead; i++) {
+                    auto pageFrame = frame + i * BufferPoolConstants::PAGE_4KB_SIZE;
+                    ASSERT_EQ(pageFrame[0], (uint8_t)(firstPageIdx + i));
+                    ASSERT_EQ(pageFrame[BufferPoolConstants::PAGE_4KB_SIZE - 1],
+                        (uint8_t)(firstPageIdx + i));
+                    readPageIdxes.push_back(firstPageIdx + i);
+                }
+            });
+    };
+    // The evicted pages of the extent are cached together, and the extent is read at once.
+    readPages(0, 64);
+    ASSERT_EQ(readPageIdxes.size(), 64);
+    auto stats = fh->getCacheStats();
+    ASSERT_EQ(stats.numPrefetchedPages, 63);
+    ASSERT_EQ(stats.numCacheHits, 64);
+    readPages(32, 32);
+    ASSERT_EQ(readPageIdxes.size(), 32);
+    ASSERT_EQ(fh->getCacheStats().numCacheMisses, 1);
+}
+
+TEST_F(PrefetchTest, ReadPagesFallsBackToSinglePages) {
+    openFile(16 /* numBufferPoolPages */);
+    for (auto pageIdx = 0u; pageIdx < 8; pageIdx++) {
+        bm->pin(*fh, pageIdx);
+    }
+    // Only 8 pages of the extent fit into the buffer pool, so its pages are read one at a time.
+    std::vector<page_idx_t> readPageIdxes;
+    bm->optimisticReadPages(*fh, 100, 32,
+        [&](uint8_t* frame, page_idx_t firstPageIdx, page_idx_t numPagesToRead) {
+            ASSERT_EQ(numPagesToRead, 1);
+            ASSERT_EQ(frame[0], (uint8_t)firstPageIdx);
+            readPageIdxes.push_back(firstPageIdx);
+        });
+    ASSERT_EQ(readPageIdxes.size(), 32);
+    for (auto i = 0u; i < 32; i++) {
+        ASSERT_EQ(readPageIdxes[i], 100 + i);
+    }
+    for (auto pageIdx = 0u; pageIdx < 8; pageIdx++) {
+        bm->unpin(*fh, pageIdx);
+    }
+}
+
+TEST_F(PrefetchTest, ScansPrefetchPages) {
+    auto csvPath = databasePath + "/nodes.csv";
+    std::ofstream csvFile{csvPath};
+    for (auto i = 0u; i < 200000; i++) {
+        csvFile << i << "\n";
+    }
+    csvFile.close();
+    createDBAndConn();
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE T(id INT64, PRIMARY KEY(id));")->isSuccess());
+    auto result = conn->query("COPY T FROM '" + csvPath + "';");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    // Reopen the database, so that no page is cached. The result holds memory of the database, so
+    // it is destroyed first.
+    result.reset();
+    createDBAndConn();
+    result = conn->query("MATCH (t:T) RETURN SUM(t.id);");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 199999ll * 200000 / 2);
+    result = conn->query("CALL buffer_manager_info() WHERE file_path ENDS WITH '/data.kz' RETURN "
+                         "num_prefetched_pages > 0;");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_TRUE(result->getNext()->getValue(0)->getValue<bool>());
+}
+
+TEST_F(PrefetchTest, WarmUpReloadsCachedPages) {
+    auto csvPath = databasePath + "/nodes.csv";
+    std::ofstream csvFile{csvPath};
+    for (auto i = 0u; i < 100000; i++) {
+        csvFile << i << "\n";
+    }
+    csvFile.close();
+    systemConfig->warmUpBufferPool = true;
+    createDBAndConn();
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE T(id INT64, PRIMARY KEY(id));")->isSuccess());
+    ASSERT_TRUE(conn->query("COPY T FROM '" + csvPath + "';")->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (t:T) RETURN SUM(t.id);")->isSuccess());
+    // Closing the database dumps the cached pages, which are loaded when it is reopened.
+    createDBAndConn();
+    std::string state;
+    for (auto i = 0u; i < 1000 && state != "DONE"; i++) {
+        auto result = conn->query("CALL buffer_pool_warm_up_info() RETURN state;");
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        state = result->getNext()->getValue(0)->getValue<std::string>();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(state, "DONE");
+    auto result = conn->query("CALL buffer_pool_warm_up_info() RETURN num_pages_to_load > 0 AND "
+                              "num_loaded_pages = num_pages_to_load;");
+    ASSERT_TRUE(result->getNext()->getValue(0)->getValue<bool>());
+    result = conn->query("MATCH (t:T) RETURN SUM(t.id);");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 99999ll * 100000 / 2);
+    result = conn->query("CALL buffer_manager_info() WHERE file_path ENDS WITH '/data.kz' RETURN "
+                         "num_prefetched_pages > 0, num_cache_misses;");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    auto tuple = result->getNext();
+    ASSERT_TRUE(tuple->getValue(0)->getValue<bool>());
+    ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), 0);
+}
@@ -0,0 +1,203 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "common/exception/buffer_manager.h"
+#include "common/file_system/virtual_file_system.h"
+#include "graph_test/graph_test.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+using namespace kuzu::testing;
+
+class SpillTest : public EmptyDBTest {
+public:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        spillDirectory = databasePath + "/spill";
+    }
+
+    std::unique_ptr<MemoryManager> createMemoryManager(
+        uint64_t numBufferPoolPages, uint64_t numSpillPages) {
+        auto pageSize = BufferPoolConstants::PAGE_256KB_SIZE;
+        bm = std::make_unique<BufferManager>(
+            numBufferPoolPages * pageSize, 1ull << 30 /* maxDBSize */, numSpillPages * pageSize);
+        return std::make_unique<MemoryManager>(
+            bm.get(), &vfs, spillDirectory, numSpillPages * pageSize);
+    }
+
+    uint64_t getSpillFileSize() {
+        return std::filesystem::file_size(getMemoryManager(*database)->getSpillFilePath());
+    }
+
+    static bool hasContent(const MemoryBuffer& buffer, uint8_t value) {
+        for (auto i = 0u; i < BufferPoolConstants::PAGE_256KB_SIZE; i++) {
+            if (buffer.buffer[i] != value) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    std::string spillDirectory;
+    VirtualFileSystem vfs;
+    std::unique_ptr<BufferManager> bm;
+};
+
+TEST_F(SpillTest, UnpinnedBuffersAreSpilledAndReadBack) {
+    auto mm = createMemoryManager(8 /* numBufferPoolPages */, 64 /* numSpillPages */);
+    std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+    for (auto i = 0u; i < 32; i++) {
+        auto buffer = mm->allocateBuffer();
+        memset(buffer->buffer, i, BufferPoolConstants::PAGE_256KB_SIZE);
+        buffer->unpin();
+        ASSERT_FALSE(buffer->isPinned());
+        buffers.push_back(std::move(buffer));
+    }
+    auto spillFilePath = mm->getSpillFilePath();
+    ASSERT_TRUE(vfs.fileOrPathExists(spillFilePath));
+    for (auto i = 0u; i < buffers.size(); i++) {
+        auto& buffer = buffers[i];
+        auto frame = buffer->buffer;
+        buffer->pin();
+        // Pointers into the buffer stay valid after it is pinned again.
+        ASSERT_EQ(buffer->buffer, frame);
+        ASSERT_TRUE(hasContent(*buffer, i)) << i;
+        buffer->unpin();
+    }
+    // Freed pages are reused without reading the spilled content back.
+    buffers.clear();
+    auto buffer = mm->allocateBuffer(true /* initializeToZero */);
+    ASSERT_TRUE(hasContent(*buffer, 0));
+    buffer.reset();
+    mm.reset();
+    ASSERT_FALSE(vfs.fileOrPathExists(spillFilePath));
+}
+
+TEST_F(SpillTest, MemoryManagersSharingSpillDirectoryUseSeparateFiles) {
+    // The first buffer manager outlives the memory manager and the buffers using it.
+    std::unique_ptr<BufferManager> bm1;
+    auto mm1 = createMemoryManager(4 /* numBufferPoolPages */, 16 /* numSpillPages */);
+    bm1 = std::move(bm);
+    auto buffer1 = mm1->allocateBuffer();
+    memset(buffer1->buffer, 1, BufferPoolConstants::PAGE_256KB_SIZE);
+    buffer1->unpin();
+    ASSERT_FALSE(buffer1->isPinned());
+    auto mm2 = createMemoryManager(4 /* numBufferPoolPages */, 16 /* numSpillPages */);
+    ASSERT_NE(mm1->getSpillFilePath(), mm2->getSpillFilePath());
+    ASSERT_TRUE(vfs.fileOrPathExists(mm1->getSpillFilePath()));
+    // Fill the second buffer pool so that the same page of the second spill file gets written.
+    std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+    for (auto i = 0u; i < 8; i++) {
+        auto buffer = mm2->allocateBuffer();
+        memset(buffer->buffer, 2, BufferPoolConstants::PAGE_256KB_SIZE);
+        buffer->unpin();
+        buffers.push_back(std::move(buffer));
+    }
+    // Evict the spilled buffer of the first memory manager and read it back.
+    std::vector<std::unique_ptr<MemoryBuffer>> buffers1;
+    for (auto i = 0u; i < 8; i++) {
+        auto buffer = mm1->allocateBuffer();
+        memset(buffer->buffer, 3, BufferPoolConstants::PAGE_256KB_SIZE);
+        buffer->unpin();
+        buffers1.push_back(std::move(buffer));
+    }
+    ASSERT_FALSE(buffer1->isPinned());
+    buffer1->pin();
+    ASSERT_TRUE(hasContent(*buffer1, 1));
+    buffers1.clear();
+    buffers.clear();
+    mm2.reset();
+    ASSERT_TRUE(vfs.fileOrPathExists(mm1->getSpillFilePath()));
+    buffer1.reset();
+    mm1.reset();
+    bm1.reset();
+}
+
+TEST_F(SpillTest, BuffersBeyondMaxSpillSizeStayPinned) {
+    auto mm = createMemoryManager(4 /* numBufferPoolPages */, 2 /* numSpillPages */);
+    std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+    for (auto i = 0u; i < 6; i++) {
+        auto buffer = mm->allocateBuffer();
+        buffer->unpin();
+        // Only the first two buffers fit in the spill file.
+        ASSERT_EQ(buffer->isPinned(), i >= 2) << i;
+        buffers.push_back(std::move(buffer));
+    }
+    ASSERT_THROW(mm->allocateBuffer(), BufferManagerException);
+}
+
+TEST_F(SpillTest, OrderByWithSpilling) {
+    systemConfig->spillDirectory = spillDirectory;
+    createDBAndConn();
+    // Sorted runs are unpinned while they wait to be merged, and the payload table is unpinned
+    // during the merge unless there are string keys.
+    auto result = conn->query("UNWIND range(1, 300000) AS x RETURN x, x * 2 ORDER BY x DESC;");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNumTuples(), 300000);
+    for (int64_t expected = 300000; expected > 299990; expected--) {
+        auto tuple = result->getNext();
+        ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), expected);
+        ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), expected * 2);
+    }
+    // Long string keys, whose ties are broken by reading the payload table during the merge.
+    result = conn->query("UNWIND range(1, 300000) AS x RETURN x ORDER BY "
+                         "concat('abcdefghijkl', to_string(x % 1000)) DESC, x;");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNumTuples(), 300000);
+    for (int64_t expected = 999; expected < 300000; expected += 1000) {
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), expected);
+    }
+}
+
+TEST_F(SpillTest, HashJoinAndAggregateWithSpilling) {
+    // The buffer pool fits the hash tables of the queries below, but not together with the
+    // thread-local tables waiting to be merged, which therefore get spilled.
+    systemConfig->bufferPoolSize = 32ull << 20;
+    systemConfig->maxNumThreads = 4;
+    systemConfig->spillDirectory = spillDirectory;
+    createDBAndConn();
+    auto nodeCSVPath = databasePath + "/nodes.csv";
+    auto relCSVPath = databasePath + "/rels.csv";
+    std::ofstream nodeCSVFile{nodeCSVPath};
+    std::ofstream relCSVFile{relCSVPath};
+    for (auto i = 1u; i <= 200000; i++) {
+        nodeCSVFile << i << "\n";
+        if (i < 200000) {
+            relCSVFile << i << "," << i + 1 << "\n";
+        }
+    }
+    nodeCSVFile.close();
+    relCSVFile.close();
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE T(id INT64, PRIMARY KEY (id));")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE R(FROM T TO T);")->isSuccess());
+    auto result = conn->query("COPY T FROM '" + nodeCSVPath + "';");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    result = conn->query("COPY R FROM '" + relCSVPath + "';");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    // Hash join tables are unpinned once they are built, until the hash slots are built.
+    result = conn->query("MATCH (a:T)-[:R]->(b:T) WHERE a.id > 0 AND b.id > 0 "
+                         "RETURN count(*), sum(a.id), sum(b.id);");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    auto tuple = result->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), 199999);
+    ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), 19999900000);
+    ASSERT_EQ(tuple->getValue(2)->getValue<int64_t>(), 20000099999);
+    // Aggregate hash tables are unpinned while they wait to be combined.
+    result = conn->query("MATCH (a:T) RETURN a.id % 100000 AS k, count(*), sum(a.id) "
+                         "ORDER BY k LIMIT 3;");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNumTuples(), 3);
+    std::vector<int64_t> expectedSums{300000, 100002, 100004};
+    for (auto k = 0; k < 3; k++) {
+        tuple = result->getNext();
+        ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), k);
+        ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), 2);
+        ASSERT_EQ(tuple->getValue(2)->getValue<int64_t>(), expectedSums[k]);
+    }
+    ASSERT_GT(getSpillFileSize(), 0);
+}
@@ -0,0 +1,94 @@
+#include <random>
+
+#include "gtest/gtest.h"
+#include "storage/stats/histogram.h"
+#include "storage/stats/hyperloglog.h"
+
+using namespace kuzu::storage;
+
+static HyperLogLog buildSketch(uint64_t start, uint64_t numValues) {
+    HyperLogLog sketch;
+    for (auto i = start; i < start + numValues; i++) {
+        sketch.add(HyperLogLog::hash(i));
+    }
+    return sketch;
+}
+
+TEST(StatisticsTests, HyperLogLogEstimate) {
+    ASSERT_EQ(HyperLogLog().estimate(), 0);
+    for (auto numValues : {10u, 1000u, 100000u}) {
+        auto estimate = (double)buildSketch(0, numValues).estimate();
+        EXPECT_NEAR(estimate, numValues, numValues * 0.05) << numValues;
+    }
+}
+
+TEST(StatisticsTests, HyperLogLogDuplicatesAndMerge) {
+    auto sketch = buildSketch(0, 50000);
+    auto estimate = sketch.estimate();
+    // Adding the same values again doesn't change the sketch
+    sketch.merge(buildSketch(0, 50000));
+    EXPECT_EQ(sketch.estimate(), estimate);
+    // Merging two disjoint sets of values gives an estimate of the union
+    sketch.merge(buildSketch(50000, 50000));
+    EXPECT_NEAR((double)sketch.estimate(), 100000, 5000);
+    // Strings
+    HyperLogLog stringSketch;
+    for (auto i = 0u; i < 20000; i++) {
+        stringSketch.add(HyperLogLog::hash(std::to_string(i % 5000)));
+    }
+    EXPECT_NEAR((double)stringSketch.estimate(), 5000, 250);
+}
+
+TEST(StatisticsTests, HistogramUniform) {
+    std::vector<double> values;
+    for (auto i = 0u; i < 10000; i++) {
+        values.push_back(i);
+    }
+    auto histogram = EquiDepthHistogram::build(values, values.size());
+    ASSERT_EQ(histogram.getNumValues(), 10000);
+    EXPECT_EQ(histogram.estimateFractionBelow(-1, true /* inclusive */), 0);
+    EXPECT_EQ(histogram.estimateFractionBelow(20000, false /* inclusive */), 1);
+    EXPECT_NEAR(histogram.estimateFractionBelow(2500, false /* inclusive */), 0.25, 0.01);
+    EXPECT_NEAR(histogram.estimateFractionBelow(7000, true /* inclusive */), 0.7, 0.01);
+}
+
+TEST(StatisticsTests, HistogramFrequentValue) {
+    // Half of the values are 7, the others are spread over [0, 1000)
+    std::mt19937 random(0);
+    std::vector<double> values;
+    for (auto i = 0u; i < 4000; i++) {
+        values.push_back(i % 2 == 0 ? 7 : random() % 1000);
+    }
+    auto histogram = EquiDepthHistogram::build(values, values.size());
+    auto equalFraction = histogram.estimateFractionBelow(7, true /* inclusive */) -
+                         histogram.estimateFractionBelow(7, false /* inclusive */);
+    EXPECT_NEAR(equalFraction, 0.5, 0.05);
+    EXPECT_NEAR(histogram.estimateFractionBelow(500, false /* inclusive */), 0.75, 0.05);
+}
+
+TEST(StatisticsTests, HistogramMerge) {
+    // Merging histograms of [0, 1000) and [1000, 4000) should give a histogram of [0, 4000)
+    std::vector<double> lower, upper;
+    for (auto i = 0u; i < 1000; i++) {
+        lower.push_back(i);
+    }
+    for (auto i = 1000u; i < 4000; i++) {
+        upper.push_back(i);
+    }
+    auto histogram = EquiDepthHistogram::build(lower, lower.size());
+    histogram.merge(EquiDepthHistogram::build(upper, upper.size()));
+    ASSERT_EQ(histogram.getNumValues(), 4000);
+    auto& boundaries = histogram.getBoundaries();
+    ASSERT_EQ(boundaries.size(), EquiDepthHistogram::NUM_BUCKETS + 1);
+    EXPECT_TRUE(std::is_sorted(boundaries.begin(), boundaries.end()));
+    EXPECT_EQ(boundaries.front(), 0);
+    EXPECT_EQ(boundaries.back(), 3999);
+    for (auto value : {500.0, 1000.0, 2000.0, 3500.0}) {
+        EXPECT_NEAR(histogram.estimateFractionBelow(value, false /* inclusive */), value / 4000,
+            0.02)
+            << value;
+    }
+    // Merging with an empty histogram doesn't change anything
+    histogram.merge(EquiDepthHistogram());
+    EXPECT_EQ(histogram.getNumValues(), 4000);
+}
@@ -0,0 +1,40 @@
+#include "graph_test/graph_test.h"
+#include "storage/wal/wal.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::testing;
+
+class WALTest : public DBTest {
+public:
+    std::string getInputDir() override {
+        return TestHelper::appendKuzuRootPath("dataset/tinysnb/");
+    }
+};
+
+TEST_F(WALTest, SmallUpdateIsLoggedAsPageDelta) {
+    conn->query("BEGIN TRANSACTION");
+    auto result = conn->query("MATCH (a:person) WHERE a.ID = 0 SET a.age = 36");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    conn->query("COMMIT_SKIP_CHECKPOINT");
+    auto walIterator = getWAL(*database)->getIterator();
+    WALRecord walRecord;
+    uint64_t numPageDeltas = 0;
+    uint64_t numPageDeltaBytes = 0;
+    while (walIterator->hasNextRecord()) {
+        walIterator->getNextRecord(walRecord);
+        if (walRecord.recordType == WALRecordType::PAGE_DELTA_RECORD) {
+            numPageDeltas++;
+            numPageDeltaBytes += walRecord.pageDeltaRecord.numBytes;
+        }
+    }
+    ASSERT_GT(numPageDeltas, 0);
+    ASSERT_LT(numPageDeltaBytes, numPageDeltas * BufferPoolConstants::PAGE_4KB_SIZE);
+    walIterator.reset();
+    result.reset();
+    // Recovery replays the page deltas.
+    createDBAndConn();
+    result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.age");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 36);
+}
@@ -1,8 +1,11 @@
+#include <thread>
+
 #include "common/exception/transaction_manager.h"
 #include "graph_test/graph_test.h"
 #include "transaction/transaction_manager.h"
 
 using namespace kuzu::common;
+using namespace kuzu::main;
 using namespace kuzu::testing;
 using namespace kuzu::transaction;
 using namespace kuzu::storage;
@@ -130,3 +133,357 @@ TEST_F(TransactionManagerTest, BasicOneWriteMultipleReadOnlyTransactions) {
     ASSERT_EQ(
         expectedReadOnlyTransactionSet, transactionManager->getActiveReadOnlyTransactionIDs());
 }
+
+static void waitForDeferredCheckpoint(TransactionManager& transactionManager) {
+    for (auto i = 0u; i < 1000 && transactionManager.hasDeferredCheckpoint(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+TEST_F(TransactionManagerTest, DeferredCheckpointDoesNotWaitForReadOnlyTransactions) {
+    std::atomic<uint64_t> numCheckpoints{0};
+    transactionManager->startCheckpointThread([&]() { numCheckpoints++; });
+    std::unique_ptr<Transaction> trx1 = transactionManager->beginReadOnlyTransaction();
+    std::unique_ptr<Transaction> trx2 = transactionManager->beginWriteTransaction();
+    transactionManager->commitButKeepActiveWriteTransaction(trx2.get());
+    transactionManager->deferCheckpoint(trx2.get());
+    ASSERT_FALSE(transactionManager->hasActiveWriteTransactionID());
+    ASSERT_TRUE(transactionManager->hasDeferredCheckpoint());
+    // Transactions started before the commit read the original version, and transactions started
+    // after it read the version of the committed write transaction until it is checkpointed.
+    std::unique_ptr<Transaction> trx3 = transactionManager->beginReadOnlyTransaction();
+    ASSERT_EQ(TransactionType::READ_ONLY, trx1->getType());
+    ASSERT_EQ(TransactionType::WRITE, trx3->getType());
+    ASSERT_TRUE(trx3->isReadOnly());
+    transactionManager->commit(trx1.get());
+    ASSERT_EQ(numCheckpoints.load(), 0);
+    transactionManager->commit(trx3.get());
+    // The checkpoint thread checkpoints once no transaction is active.
+    waitForDeferredCheckpoint(*transactionManager);
+    ASSERT_FALSE(transactionManager->hasDeferredCheckpoint());
+    ASSERT_EQ(numCheckpoints.load(), 1);
+    std::unique_ptr<Transaction> trx4 = transactionManager->beginReadOnlyTransaction();
+    ASSERT_EQ(TransactionType::READ_ONLY, trx4->getType());
+    transactionManager->stopCheckpointThread();
+}
+
+TEST_F(TransactionManagerTest, WriteTransactionCheckpointsDeferredCheckpoint) {
+    std::atomic<uint64_t> numCheckpoints{0};
+    transactionManager->startCheckpointThread([&]() { numCheckpoints++; });
+    transactionManager->setCheckPointWaitTimeoutForTransactionsToLeaveInMicros(10000 /* 10ms */);
+    // The read-only transaction starts first, so that the checkpoint thread cannot run the deferred
+    // checkpoint before it.
+    std::unique_ptr<Transaction> trx2 = transactionManager->beginReadOnlyTransaction();
+    std::unique_ptr<Transaction> trx1 = transactionManager->beginWriteTransaction();
+    transactionManager->commitButKeepActiveWriteTransaction(trx1.get());
+    transactionManager->deferCheckpoint(trx1.get());
+    // The deferred checkpoint waits for the read-only transaction to leave before a new write
+    // transaction can start.
+    try {
+        transactionManager->beginWriteTransaction();
+        FAIL();
+    } catch (TransactionManagerException& e) {}
+    ASSERT_TRUE(transactionManager->hasDeferredCheckpoint());
+    std::thread thread([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        transactionManager->commit(trx2.get());
+    });
+    transactionManager->setCheckPointWaitTimeoutForTransactionsToLeaveInMicros(
+        DEFAULT_CHECKPOINT_WAIT_TIMEOUT_FOR_TRANSACTIONS_TO_LEAVE_IN_MICROS);
+    std::unique_ptr<Transaction> trx3 = transactionManager->beginWriteTransaction();
+    thread.join();
+    ASSERT_FALSE(transactionManager->hasDeferredCheckpoint());
+    ASSERT_EQ(numCheckpoints.load(), 1);
+    ASSERT_EQ(trx3->getID(), transactionManager->getActiveWriteTransactionID());
+    transactionManager->stopCheckpointThread();
+}
+
+TEST_F(TransactionManagerTest, CheckpointThreadKeepsRunningAfterFailedCheckpoint) {
+    std::atomic<uint64_t> numCheckpointAttempts{0};
+    std::atomic<uint64_t> numCheckpoints{0};
+    transactionManager->startCheckpointThread([&]() {
+        if (numCheckpointAttempts++ == 0) {
+            throw std::runtime_error("Checkpoint failed.");
+        }
+        numCheckpoints++;
+    });
+    std::unique_ptr<Transaction> trx1 = transactionManager->beginWriteTransaction();
+    transactionManager->commitButKeepActiveWriteTransaction(trx1.get());
+    transactionManager->deferCheckpoint(trx1.get());
+    for (auto i = 0u; i < 1000 && numCheckpointAttempts.load() == 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    // The failed checkpoint is left to the next write transaction.
+    ASSERT_EQ(numCheckpointAttempts.load(), 1);
+    ASSERT_TRUE(transactionManager->hasDeferredCheckpoint());
+    std::unique_ptr<Transaction> trx2 = transactionManager->beginWriteTransaction();
+    ASSERT_FALSE(transactionManager->hasDeferredCheckpoint());
+    ASSERT_EQ(numCheckpoints.load(), 1);
+    // Later deferred checkpoints are still done by the checkpoint thread.
+    transactionManager->commitButKeepActiveWriteTransaction(trx2.get());
+    transactionManager->deferCheckpoint(trx2.get());
+    waitForDeferredCheckpoint(*transactionManager);
+    ASSERT_FALSE(transactionManager->hasDeferredCheckpoint());
+    ASSERT_EQ(numCheckpoints.load(), 2);
+    transactionManager->stopCheckpointThread();
+}
+
+class BackgroundCheckpointTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        systemConfig->checkpointInBackground = true;
+        createDBAndConn();
+        getTransactionManager(*database)->setCheckPointWaitTimeoutForTransactionsToLeaveInMicros(
+            10000 /* 10ms */);
+    }
+
+    int64_t countNodes(Connection& connection) {
+        auto result = connection.query("MATCH (p:Person) RETURN COUNT(*);");
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        return result->getNext()->getValue(0)->getValue<int64_t>();
+    }
+};
+
+TEST_F(BackgroundCheckpointTest, CommitDoesNotWaitForReadOnlyTransactions) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE Person(id INT64, PRIMARY KEY(id));")->isSuccess());
+    auto readConn = std::make_unique<Connection>(database.get());
+    ASSERT_TRUE(readConn->query("BEGIN TRANSACTION READ ONLY;")->isSuccess());
+    ASSERT_EQ(countNodes(*readConn), 0);
+    // Without checkpointing in the background, the commit would time out waiting for the open
+    // read-only transaction.
+    auto result = conn->query("CREATE (:Person {id: 1});");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_TRUE(getTransactionManager(*database)->hasDeferredCheckpoint());
+    ASSERT_EQ(countNodes(*readConn), 0);
+    ASSERT_EQ(countNodes(*conn), 1);
+    // The next write transaction checkpoints the committed one first, which waits for the open
+    // read-only transaction.
+    ASSERT_FALSE(conn->query("CREATE (:Person {id: 2});")->isSuccess());
+    ASSERT_TRUE(readConn->query("COMMIT;")->isSuccess());
+    result = conn->query("CREATE (:Person {id: 2});");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    waitForDeferredCheckpoint(*getTransactionManager(*database));
+    ASSERT_FALSE(getTransactionManager(*database)->hasDeferredCheckpoint());
+    ASSERT_EQ(countNodes(*readConn), 2);
+    result.reset();
+    readConn.reset();
+    createDBAndConn();
+    ASSERT_EQ(countNodes(*conn), 2);
+}
+
+TEST_F(TransactionManagerTest, WriteTransactionsWaitInArrivalOrder) {
+    transactionManager->setWriteTransactionWaitTimeoutInMicros(10000000 /* 10s */);
+    std::unique_ptr<Transaction> trx1 = transactionManager->beginWriteTransaction();
+    std::mutex mtx;
+    std::vector<uint64_t> startOrder;
+    std::vector<std::thread> threads;
+    for (auto i = 0u; i < 3; i++) {
+        threads.emplace_back([&, i]() {
+            auto trx = transactionManager->beginWriteTransaction();
+            {
+                std::unique_lock lck{mtx};
+                startOrder.push_back(i);
+            }
+            transactionManager->commit(trx.get());
+        });
+        // Each thread waits behind the previous ones before the next thread starts.
+        while (transactionManager->getNumWaitingWriteTransactions() < i + 1) {
+            std::this_thread::yield();
+        }
+    }
+    transactionManager->commit(trx1.get());
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(startOrder, (std::vector<uint64_t>{0, 1, 2}));
+    ASSERT_EQ(transactionManager->getNumWaitingWriteTransactions(), 0);
+    ASSERT_FALSE(transactionManager->hasActiveWriteTransactionID());
+}
+
+TEST_F(TransactionManagerTest, WriteTransactionWaitTimesOut) {
+    transactionManager->setWriteTransactionWaitTimeoutInMicros(10000 /* 10ms */);
+    std::unique_ptr<Transaction> trx1 = transactionManager->beginWriteTransaction();
+    try {
+        transactionManager->beginWriteTransaction();
+        FAIL();
+    } catch (TransactionManagerException& e) {}
+    ASSERT_EQ(transactionManager->getNumWaitingWriteTransactions(), 0);
+    transactionManager->commit(trx1.get());
+    std::unique_ptr<Transaction> trx2 = transactionManager->beginWriteTransaction();
+    ASSERT_EQ(trx2->getID(), transactionManager->getActiveWriteTransactionID());
+}
+
+class WriteTransactionQueueTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        systemConfig->writeTransactionWaitTimeoutInMicros = 60000000 /* 60s */;
+        createDBAndConn();
+    }
+};
+
+TEST_F(WriteTransactionQueueTest, ConcurrentAutoCommitInserts) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE Person(id INT64, PRIMARY KEY(id));")->isSuccess());
+    constexpr uint64_t numConnections = 4;
+    constexpr uint64_t numInsertsPerConnection = 50;
+    std::vector<std::thread> threads;
+    std::atomic<uint64_t> numFailures{0};
+    for (auto i = 0u; i < numConnections; i++) {
+        threads.emplace_back([&, i]() {
+            Connection connection(database.get());
+            for (auto j = 0u; j < numInsertsPerConnection; j++) {
+                auto id = std::to_string(i * numInsertsPerConnection + j);
+                if (!connection.query("CREATE (:Person {id: " + id + "});")->isSuccess()) {
+                    numFailures++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // Without waiting, inserts fail while another connection's insert is active.
+    ASSERT_EQ(numFailures.load(), 0);
+    auto result = conn->query("MATCH (p:Person) RETURN COUNT(*);");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(),
+        numConnections * numInsertsPerConnection);
+}
+
+class ConcurrentWriteTransactionTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        systemConfig->enableConcurrentWriteTransactions = true;
+        createDBAndConn();
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE A(id INT64, PRIMARY KEY(id));")->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE B(id INT64, PRIMARY KEY(id));")->isSuccess());
+    }
+
+    int64_t count(Connection& connection, const std::string& query) {
+        auto result = connection.query(query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        return result->getNext()->getValue(0)->getValue<int64_t>();
+    }
+};
+
+TEST_F(ConcurrentWriteTransactionTest, WritesToDisjointTablesRunConcurrently) {
+    auto conn1 = std::make_unique<Connection>(database.get());
+    auto conn2 = std::make_unique<Connection>(database.get());
+    ASSERT_TRUE(conn1->query("BEGIN TRANSACTION;")->isSuccess());
+    ASSERT_TRUE(conn2->query("BEGIN TRANSACTION;")->isSuccess());
+    auto result = conn1->query("CREATE (:A {id: 1});");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    result = conn2->query("CREATE (:B {id: 1}), (:B {id: 2});");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(getTransactionManager(*database)->getNumActiveConcurrentWriteTransactions(), 2);
+    // Each transaction only reads its own uncommitted changes.
+    ASSERT_EQ(count(*conn1, "MATCH (a:A) RETURN COUNT(*);"), 1);
+    ASSERT_EQ(count(*conn1, "MATCH (b:B) RETURN COUNT(*);"), 0);
+    ASSERT_EQ(count(*conn1, "MATCH (b:B {id: 1}) RETURN COUNT(*);"), 0);
+    ASSERT_EQ(count(*conn2, "MATCH (a:A) RETURN COUNT(*);"), 0);
+    ASSERT_EQ(count(*conn2, "MATCH (b:B) RETURN COUNT(*);"), 2);
+    // DDL statements run in exclusive write transactions.
+    ASSERT_FALSE(conn->query("CREATE NODE TABLE C(id INT64, PRIMARY KEY(id));")->isSuccess());
+    ASSERT_TRUE(conn1->query("COMMIT;")->isSuccess());
+    // Transactions don't read from a snapshot, so changes committed by others become visible.
+    ASSERT_EQ(count(*conn2, "MATCH (a:A {id: 1}) RETURN COUNT(*);"), 1);
+    ASSERT_TRUE(conn2->query("COMMIT;")->isSuccess());
+    ASSERT_EQ(getTransactionManager(*database)->getNumActiveConcurrentWriteTransactions(), 0);
+    ASSERT_EQ(count(*conn, "MATCH (a:A) RETURN COUNT(*);"), 1);
+    ASSERT_EQ(count(*conn, "MATCH (b:B) RETURN COUNT(*);"), 2);
+    result.reset();
+    conn1.reset();
+    conn2.reset();
+    createDBAndConn();
+    ASSERT_EQ(count(*conn, "MATCH (a:A) RETURN COUNT(*);"), 1);
+    ASSERT_EQ(count(*conn, "MATCH (b:B) RETURN COUNT(*);"), 2);
+}
+
+TEST_F(ConcurrentWriteTransactionTest, FirstWriterWins) {
+    auto conn1 = std::make_unique<Connection>(database.get());
+    auto conn2 = std::make_unique<Connection>(database.get());
+    ASSERT_TRUE(conn1->query("BEGIN TRANSACTION;")->isSuccess());
+    ASSERT_TRUE(conn2->query("BEGIN TRANSACTION;")->isSuccess());
+    ASSERT_TRUE(conn1->query("CREATE (:A {id: 1});")->isSuccess());
+    // The table is written by the active transaction of conn1, so the transaction of conn2 is
+    // rolled back.
+    ASSERT_FALSE(conn2->query("CREATE (:A {id: 2});")->isSuccess());
+    ASSERT_TRUE(conn2->query("BEGIN TRANSACTION;")->isSuccess());
+    ASSERT_TRUE(conn1->query("COMMIT;")->isSuccess());
+    // The table was written by a transaction committed after the transaction of conn2 started.
+    ASSERT_FALSE(conn2->query("MATCH (a:A) DELETE a;")->isSuccess());
+    // A transaction started after the commit can write to the table.
+    ASSERT_TRUE(conn2->query("CREATE (:A {id: 2});")->isSuccess());
+    ASSERT_EQ(count(*conn, "MATCH (a:A) RETURN COUNT(*);"), 2);
+}
+
+TEST_F(ConcurrentWriteTransactionTest, DeleteOfNodeConflictsWithInsertOfItsRels) {
+    ASSERT_TRUE(conn->query("CREATE REL TABLE R(FROM A TO B);")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (:A {id: 1}), (:B {id: 1});")->isSuccess());
+    auto deleteNode = "MATCH (a:A {id: 1}) DELETE a;";
+    auto insertRel = "MATCH (a:A {id: 1}), (b:B {id: 1}) CREATE (a)-[:R]->(b);";
+    auto conn1 = std::make_unique<Connection>(database.get());
+    auto conn2 = std::make_unique<Connection>(database.get());
+    // The node is deleted first, so no rel of it can be inserted until the deletion commits.
+    ASSERT_TRUE(conn1->query("BEGIN TRANSACTION;")->isSuccess());
+    ASSERT_TRUE(conn2->query("BEGIN TRANSACTION;")->isSuccess());
+    auto result = conn1->query(deleteNode);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_FALSE(conn2->query(insertRel)->isSuccess());
+    ASSERT_TRUE(conn1->query("COMMIT;")->isSuccess());
+    ASSERT_EQ(count(*conn, "MATCH (a:A) RETURN COUNT(*);"), 0);
+    ASSERT_EQ(count(*conn, "MATCH ()-[r:R]->() RETURN COUNT(*);"), 0);
+    // A rel of the node is inserted first, so the node cannot be deleted until the insertion
+    // commits.
+    ASSERT_TRUE(conn->query("CREATE (:A {id: 1});")->isSuccess());
+    ASSERT_TRUE(conn1->query("BEGIN TRANSACTION;")->isSuccess());
+    ASSERT_TRUE(conn2->query("BEGIN TRANSACTION;")->isSuccess());
+    result = conn1->query(insertRel);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_FALSE(conn2->query(deleteNode)->isSuccess());
+    ASSERT_TRUE(conn1->query("COMMIT;")->isSuccess());
+    // Once committed, the rel keeps the node from being deleted.
+    ASSERT_FALSE(conn2->query(deleteNode)->isSuccess());
+    ASSERT_EQ(count(*conn, "MATCH (a:A) RETURN COUNT(*);"), 1);
+    ASSERT_EQ(count(*conn, "MATCH (:A)-[r:R]->(:B) RETURN COUNT(*);"), 1);
+}
+
+TEST_F(ConcurrentWriteTransactionTest, RollbackReleasesTables) {
+    auto conn1 = std::make_unique<Connection>(database.get());
+    ASSERT_TRUE(conn1->query("BEGIN TRANSACTION;")->isSuccess());
+    ASSERT_TRUE(conn1->query("CREATE (:A {id: 1});")->isSuccess());
+    ASSERT_TRUE(conn1->query("ROLLBACK;")->isSuccess());
+    ASSERT_TRUE(conn1->query("BEGIN TRANSACTION;")->isSuccess());
+    ASSERT_TRUE(conn1->query("CREATE (:B {id: 1});")->isSuccess());
+    // Closing the connection rolls back its transaction.
+    conn1.reset();
+    auto result = conn->query("CREATE (:A {id: 1}), (:B {id: 1});");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(count(*conn, "MATCH (a:A) RETURN COUNT(*);"), 1);
+    ASSERT_EQ(count(*conn, "MATCH (b:B) RETURN COUNT(*);"), 1);
+}
+
+TEST_F(ConcurrentWriteTransactionTest, ConcurrentAutoCommitInsertsIntoDisjointTables) {
+    constexpr uint64_t numInserts = 50;
+    std::vector<std::thread> threads;
+    std::atomic<uint64_t> numFailures{0};
+    for (auto tableName : {"A", "B"}) {
+        threads.emplace_back([&, tableName]() {
+            Connection connection(database.get());
+            for (auto i = 0u; i < numInserts; i++) {
+                auto query =
+                    std::string("CREATE (:") + tableName + " {id: " + std::to_string(i) + "});";
+                if (!connection.query(query)->isSuccess()) {
+                    numFailures++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(numFailures.load(), 0);
+    ASSERT_EQ(count(*conn, "MATCH (a:A) RETURN COUNT(*);"), numInserts);
+    ASSERT_EQ(count(*conn, "MATCH (b:B) RETURN COUNT(*);"), numInserts);
+}
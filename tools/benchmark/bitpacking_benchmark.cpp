@@ -0,0 +1,122 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/string_utils.h"
+#include "storage/compression/bitpacking_simd.h"
+#include "storage/compression/compression.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+// Measures the throughput of unpacking bitpacked integers for each bit width with each of the
+// unpacking kernels supported by the CPU, as well as through IntegerBitpacking::decompressFromPage
+// (which picks the best kernel). Throughput is reported in GB/s of decompressed values.
+//
+// Usage: kuzu_bitpacking_benchmark [--values=<num values>] [--run=<num runs>] [--negative]
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+template<typename FUNC>
+static double measureGBPerSecond(uint64_t numBytes, uint64_t numRuns, FUNC func) {
+    // Warm up
+    func();
+    auto start = std::chrono::steady_clock::now();
+    for (auto i = 0u; i < numRuns; i++) {
+        func();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return (double)(numBytes * numRuns) / elapsed.count() / 1e9;
+}
+
+template<typename T>
+static void runBenchmark(uint64_t numValues, uint64_t numRuns, bool negative) {
+    std::vector<SIMDLevel> levels;
+    for (auto level : {SIMDLevel::SCALAR, SIMDLevel::AVX2, SIMDLevel::AVX512}) {
+        if (level <= BitpackingUtils::getSupportedSIMDLevel()) {
+            levels.push_back(level);
+        }
+    }
+    printf("INT%zu%s\n%9s", sizeof(T) * 8, negative ? " (with negative values)" : "", "bit width");
+    for (auto level : levels) {
+        printf(" %9s", BitpackingUtils::toString(level));
+    }
+    printf(" %9s\n", "scan");
+
+    std::mt19937_64 random(0);
+    std::vector<T> values(numValues);
+    std::vector<T> result(numValues);
+    auto alg = IntegerBitpacking<T>();
+    for (uint8_t bitWidth = 1; bitWidth < sizeof(T) * 8; bitWidth++) {
+        // With negative values one bit is used for the sign
+        auto valueBits = negative ? bitWidth - 1 : bitWidth;
+        auto mask = valueBits == 0 ? 0 : UINT64_MAX >> (64 - valueBits);
+        for (auto& value : values) {
+            value = (T)(random() & mask);
+            if (negative && random() % 2) {
+                value = -value;
+            }
+        }
+        auto header = BitpackHeader{bitWidth, negative, 0 /*offset*/};
+        auto metadata = CompressionMetadata(CompressionType::INTEGER_BITPACKING, header.getData());
+        std::vector<uint8_t> packed(numValues * bitWidth / 8);
+        auto srcCursor = (const uint8_t*)values.data();
+        alg.compressNextPage(srcCursor, numValues, packed.data(), packed.size(), metadata);
+
+        printf("%9d", bitWidth);
+        auto numBytes = numValues * sizeof(T);
+        for (auto level : levels) {
+            auto throughput = measureGBPerSecond(numBytes, numRuns, [&]() {
+                BitpackingUtils::unpackChunks(packed.data(), result.data(),
+                    numValues / BitpackingUtils::CHUNK_SIZE, header, level);
+            });
+            if (result != values) {
+                printf("\nIncorrect result unpacking %d bit values with %s\n", bitWidth,
+                    BitpackingUtils::toString(level));
+                exit(1);
+            }
+            printf(" %9.2f", throughput);
+        }
+        auto throughput = measureGBPerSecond(numBytes, numRuns, [&]() {
+            alg.decompressFromPage(packed.data(), 0 /*srcOffset*/, (uint8_t*)result.data(),
+                0 /*dstOffset*/, numValues, metadata);
+        });
+        printf(" %9.2f\n", throughput);
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t numValues = 1 << 20;
+    uint64_t numRuns = 100;
+    bool negative = false;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--values")) {
+            numValues = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--run")) {
+            numRuns = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--negative")) {
+            negative = true;
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    // Only whole chunks are unpacked by the kernels
+    numValues -= numValues % BitpackingUtils::CHUNK_SIZE;
+    if (numValues == 0) {
+        printf("--values must be at least %d", (int)BitpackingUtils::CHUNK_SIZE);
+        return 1;
+    }
+    runBenchmark<int32_t>(numValues, numRuns, negative);
+    runBenchmark<int64_t>(numValues, numRuns, negative);
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/file_system/virtual_file_system.h"
+#include "common/string_utils.h"
+#include "storage/buffer_manager/buffer_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+// Measures how the throughput of pinning and unpinning pages in the BM scales with the number of
+// threads, for each eviction policy. Each thread pins and unpins random pages of a file, which
+// enqueues an eviction candidate for each unpinned page. In the "cached" workload all pages fit
+// in the buffer pool, so only the page table lookups and the eviction queue are exercised. In the
+// "evicting" workload the file is twice as large as the buffer pool, so half of the pins evict a
+// page. The speedup is relative to the throughput of a single thread.
+//
+// Usage: kuzu_buffer_manager_benchmark [--threads=<max num threads>]
+//     [--pages=<num buffer pool pages>] [--ops=<num pins per thread>] [--run=<num runs>]
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+// Returns the number of pins per second.
+static double runWorkload(EvictionPolicyType policyType, uint64_t numThreads,
+    uint64_t numBufferPoolPages, uint64_t numFilePages, uint64_t numOpsPerThread) {
+    VirtualFileSystem vfs;
+    BufferManager bm(numBufferPoolPages * BufferPoolConstants::PAGE_4KB_SIZE,
+        1ull << 34 /* maxDBSize */, 0 /* maxSpillSize */, policyType);
+    auto fileHandle = bm.getBMFileHandle("buffer_manager_benchmark",
+        FileHandle::O_IN_MEM_TEMP_FILE_4KB_PAGED,
+        BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, &vfs, PAGE_4KB);
+    fileHandle->addNewPages(numFilePages);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (auto threadIdx = 0u; threadIdx < numThreads; threadIdx++) {
+        threads.emplace_back([&, threadIdx]() {
+            std::mt19937_64 random(threadIdx);
+            for (auto i = 0u; i < numOpsPerThread; i++) {
+                auto pageIdx = random() % numFilePages;
+                bm.pin(*fileHandle, pageIdx, BufferManager::PageReadPolicy::DONT_READ_PAGE);
+                bm.unpin(*fileHandle, pageIdx);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return numThreads * numOpsPerThread / elapsed.count();
+}
+
+int main(int argc, char** argv) {
+    uint64_t maxNumThreads = std::thread::hardware_concurrency();
+    uint64_t numBufferPoolPages = 1 << 14;
+    uint64_t numOpsPerThread = 1 << 20;
+    uint64_t numRuns = 3;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--threads")) {
+            maxNumThreads = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--pages")) {
+            numBufferPoolPages = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--ops")) {
+            numOpsPerThread = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--run")) {
+            numRuns = stoull(getArgumentValue(arg));
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    if (maxNumThreads == 0 || numBufferPoolPages == 0 || numOpsPerThread == 0 || numRuns == 0) {
+        printf("--threads, --pages, --ops and --run must be positive");
+        return 1;
+    }
+    printf("%lu buffer pool pages, %lu pins per thread\n", (unsigned long)numBufferPoolPages,
+        (unsigned long)numOpsPerThread);
+    printf("%10s %10s %10s %16s %10s\n", "policy", "workload", "threads", "pins/s (M)", "speedup");
+    for (auto policyType : {EvictionPolicyType::FIFO, EvictionPolicyType::TWO_QUEUE}) {
+        for (auto isEvicting : {false, true}) {
+            auto numFilePages = isEvicting ? 2 * numBufferPoolPages : numBufferPoolPages;
+            double singleThreadThroughput = 0;
+            for (auto numThreads = 1u; numThreads <= maxNumThreads; numThreads *= 2) {
+                double throughput = 0;
+                for (auto run = 0u; run < numRuns; run++) {
+                    throughput += runWorkload(policyType, numThreads, numBufferPoolPages,
+                        numFilePages, numOpsPerThread);
+                }
+                throughput /= numRuns;
+                if (numThreads == 1) {
+                    singleThreadThroughput = throughput;
+                }
+                printf("%10s %10s %10lu %16.2f %10.2f\n",
+                    EvictionPolicyTypeUtils::toString(policyType).c_str(),
+                    isEvicting ? "evicting" : "cached", (unsigned long)numThreads, throughput / 1e6,
+                    throughput / singleThreadThroughput);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/string_utils.h"
+#include "main/kuzu.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+// Measures the throughput of inserting nodes from multiple connections, each of which inserts
+// into its own node table, with and without concurrent write transactions. Each transaction is a
+// single auto-committed statement inserting a batch of nodes. Without concurrent write
+// transactions, the transactions of all connections run one at a time. With them, they only
+// commit one at a time.
+//
+// Usage: kuzu_concurrent_write_benchmark [--path=<dir>] [--threads=<max num connections>]
+//     [--transactions=<num transactions per connection>] [--batch=<num nodes per transaction>]
+//     [--run=<num runs>]
+
+static constexpr uint64_t BUFFER_POOL_SIZE = 1ull << 30;
+static constexpr uint64_t WRITE_TRANSACTION_WAIT_TIMEOUT_IN_MICROS = 600000000; // 10min
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+static void query(Connection& conn, const std::string& statement) {
+    auto result = conn.query(statement);
+    if (!result->isSuccess()) {
+        throw std::runtime_error(statement + ": " + result->getErrorMessage());
+    }
+}
+
+// Returns the number of inserted nodes per second.
+static double runWorkload(const std::filesystem::path& path, bool concurrentWrites,
+    uint64_t numThreads, uint64_t numTransactions, uint64_t batchSize) {
+    std::filesystem::remove_all(path);
+    auto systemConfig = SystemConfig(BUFFER_POOL_SIZE);
+    systemConfig.writeTransactionWaitTimeoutInMicros = WRITE_TRANSACTION_WAIT_TIMEOUT_IN_MICROS;
+    systemConfig.enableConcurrentWriteTransactions = concurrentWrites;
+    double throughput = 0;
+    {
+        Database database(path.string(), systemConfig);
+        Connection conn(&database);
+        for (auto i = 0u; i < numThreads; i++) {
+            query(conn, "CREATE NODE TABLE t" + std::to_string(i) +
+                            "(id INT64, value INT64, PRIMARY KEY (id))");
+        }
+        std::atomic<uint64_t> numFailures{0};
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (auto threadIdx = 0u; threadIdx < numThreads; threadIdx++) {
+            threads.emplace_back([&, threadIdx]() {
+                Connection connection(&database);
+                for (auto i = 0u; i < numTransactions; i++) {
+                    auto startID = std::to_string(i * batchSize);
+                    auto endID = std::to_string((i + 1) * batchSize - 1);
+                    auto result = connection.query("UNWIND range(" + startID + ", " + endID +
+                                                   ") AS x CREATE (:t" +
+                                                   std::to_string(threadIdx) +
+                                                   " {id: x, value: x * 2})");
+                    if (!result->isSuccess()) {
+                        numFailures++;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (numFailures.load() > 0) {
+            throw std::runtime_error(std::to_string(numFailures.load()) + " transactions failed");
+        }
+        throughput = numThreads * numTransactions * batchSize / elapsed.count();
+    }
+    std::filesystem::remove_all(path);
+    return throughput;
+}
+
+int main(int argc, char** argv) {
+    std::string path = "concurrent_write_benchmark";
+    uint64_t maxNumThreads = std::thread::hardware_concurrency();
+    uint64_t numTransactions = 20;
+    uint64_t batchSize = 10000;
+    uint64_t numRuns = 3;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--path")) {
+            path = getArgumentValue(arg);
+        } else if (arg.starts_with("--threads")) {
+            maxNumThreads = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--transactions")) {
+            numTransactions = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--batch")) {
+            batchSize = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--run")) {
+            numRuns = stoull(getArgumentValue(arg));
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    if (maxNumThreads == 0 || numTransactions == 0 || batchSize == 0 || numRuns == 0) {
+        printf("--threads, --transactions, --batch and --run must be positive");
+        return 1;
+    }
+    printf("%lu transactions per connection, %lu nodes per transaction\n",
+        (unsigned long)numTransactions, (unsigned long)batchSize);
+    printf("%12s %18s %18s %10s\n", "connections", "serialized (K/s)", "concurrent (K/s)",
+        "speedup");
+    for (auto numThreads = 1u; numThreads <= maxNumThreads; numThreads *= 2) {
+        double serializedThroughput = 0;
+        double concurrentThroughput = 0;
+        for (auto run = 0u; run < numRuns; run++) {
+            serializedThroughput += runWorkload(
+                path, false /* concurrentWrites */, numThreads, numTransactions, batchSize);
+            concurrentThroughput += runWorkload(
+                path, true /* concurrentWrites */, numThreads, numTransactions, batchSize);
+        }
+        serializedThroughput /= numRuns;
+        concurrentThroughput /= numRuns;
+        printf("%12lu %18.2f %18.2f %10.2f\n", (unsigned long)numThreads,
+            serializedThroughput / 1e3, concurrentThroughput / 1e3,
+            concurrentThroughput / serializedThroughput);
+    }
+    return 0;
+}
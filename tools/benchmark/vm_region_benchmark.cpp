@@ -0,0 +1,184 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/file_system/virtual_file_system.h"
+#include "common/string_utils.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+// Simulates the build side of a hash join on memory buffers of the MM with each NUMA policy, with
+// and without huge pages. Each thread first materializes its share of the build tuples into its
+// own buffers, then inserts all tuples into a hash directory, which reads the tuples of all
+// threads. For each phase, the time and the ratio of accesses to memory on a remote NUMA node are
+// reported. The ratio is sampled by looking up the node of the accessed page and of the CPU the
+// thread runs on, so threads should be spread across sockets (e.g. without taskset).
+//
+// Usage: kuzu_vm_region_benchmark [--threads=<num threads>] [--tuples=<num tuples per thread>]
+//     [--run=<num runs>]
+
+static constexpr uint64_t TUPLE_SIZE = 64;
+static constexpr uint64_t NUM_TUPLES_PER_BUFFER =
+    BufferPoolConstants::PAGE_256KB_SIZE / TUPLE_SIZE;
+// The node of every SAMPLE_INTERVAL-th access is looked up.
+static constexpr uint64_t SAMPLE_INTERVAL = 1024;
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+struct AccessCounter {
+    std::atomic<uint64_t> numSampledAccesses{0};
+    std::atomic<uint64_t> numRemoteAccesses{0};
+
+    // Returns the percentage of sampled accesses which were remote, or -1 if the nodes of the
+    // pages cannot be determined.
+    double getRemoteAccessPercentage() const {
+        auto numSampled = numSampledAccesses.load();
+        return numSampled == 0 ? -1 : 100.0 * numRemoteAccesses.load() / numSampled;
+    }
+
+    void sample(const uint8_t* address) {
+#ifdef __linux__
+        int pageNode = -1;
+        if (syscall(SYS_get_mempolicy, &pageNode, nullptr, 0, address,
+                MPOL_F_NODE | MPOL_F_ADDR) != 0) {
+            return;
+        }
+        unsigned cpu = 0, cpuNode = 0;
+        if (syscall(SYS_getcpu, &cpu, &cpuNode, nullptr) != 0) {
+            return;
+        }
+        numSampledAccesses.fetch_add(1, std::memory_order_relaxed);
+        if ((unsigned)pageNode != cpuNode) {
+            numRemoteAccesses.fetch_add(1, std::memory_order_relaxed);
+        }
+#else
+        (void)address;
+#endif
+    }
+};
+
+template<typename FUNC>
+static double runThreads(uint64_t numThreads, FUNC func) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (auto threadIdx = 0u; threadIdx < numThreads; threadIdx++) {
+        threads.emplace_back([&func, threadIdx]() { func(threadIdx); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+static void runBenchmark(VMRegionConfig config, uint64_t numThreads, uint64_t numTuplesPerThread,
+    uint64_t numRuns) {
+    auto numBuffersPerThread =
+        (numTuplesPerThread + NUM_TUPLES_PER_BUFFER - 1) / NUM_TUPLES_PER_BUFFER;
+    auto numTuples = numBuffersPerThread * NUM_TUPLES_PER_BUFFER * numThreads;
+    // The directory and the tuples fit in the buffer pool.
+    auto bufferPoolSize = 2 * (numTuples * TUPLE_SIZE + numTuples * sizeof(uint8_t*));
+    double materializeTime = 0, buildTime = 0;
+    AccessCounter materializeCounter, buildCounter;
+    for (auto run = 0u; run < numRuns; run++) {
+        VirtualFileSystem vfs;
+        BufferManager bm(bufferPoolSize, 1ull << 30 /* maxDBSize */, 0 /* maxSpillSize */,
+            EvictionPolicyType::TWO_QUEUE, config);
+        MemoryManager mm(&bm, &vfs);
+        std::vector<std::vector<std::unique_ptr<MemoryBuffer>>> buffers(numThreads);
+        materializeTime += runThreads(numThreads, [&](uint64_t threadIdx) {
+            std::mt19937_64 random(threadIdx);
+            for (auto i = 0u; i < numBuffersPerThread; i++) {
+                auto buffer = mm.allocateBuffer();
+                for (auto j = 0u; j < NUM_TUPLES_PER_BUFFER; j++) {
+                    auto tuple = buffer->buffer + j * TUPLE_SIZE;
+                    auto key = random();
+                    memcpy(tuple, &key, sizeof(key));
+                    memset(tuple + sizeof(key), (uint8_t)j, TUPLE_SIZE - sizeof(key));
+                    if (j % SAMPLE_INTERVAL == 0) {
+                        materializeCounter.sample(tuple);
+                    }
+                }
+                buffers[threadIdx].push_back(std::move(buffer));
+            }
+        });
+        // The threads insert the tuples of all threads into the directory, which stores a pointer
+        // to each tuple in the slot of its hash.
+        auto directoryBuffer = mm.allocateBuffer(true /* initializeToZero */,
+            std::min<uint64_t>(numTuples * sizeof(uint8_t*), MemoryManager::MAX_BUFFER_SIZE));
+        auto directory = (std::atomic<uint8_t*>*)directoryBuffer->buffer;
+        auto numSlots = directoryBuffer->allocator->getBufferSize() / sizeof(uint8_t*);
+        buildTime += runThreads(numThreads, [&](uint64_t threadIdx) {
+            for (auto tupleIdx = threadIdx; tupleIdx < numTuples; tupleIdx += numThreads) {
+                auto bufferIdx = tupleIdx / NUM_TUPLES_PER_BUFFER;
+                auto& buffer = buffers[bufferIdx % numThreads][bufferIdx / numThreads];
+                auto tuple = buffer->buffer + (tupleIdx % NUM_TUPLES_PER_BUFFER) * TUPLE_SIZE;
+                uint64_t key;
+                memcpy(&key, tuple, sizeof(key));
+                directory[key % numSlots].store(tuple, std::memory_order_relaxed);
+                if (tupleIdx % SAMPLE_INTERVAL == 0) {
+                    buildCounter.sample(tuple);
+                }
+            }
+        });
+    }
+    printf("%10s %10s %16.2f %16.2f %16.2f %16.2f\n",
+        NUMAPolicyUtils::toString(config.numaPolicy).c_str(), config.useHugePages ? "yes" : "no",
+        materializeTime / numRuns, materializeCounter.getRemoteAccessPercentage(),
+        buildTime / numRuns, buildCounter.getRemoteAccessPercentage());
+}
+
+int main(int argc, char** argv) {
+    uint64_t numThreads = std::thread::hardware_concurrency();
+    uint64_t numTuplesPerThread = 1 << 18;
+    uint64_t numRuns = 5;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--threads")) {
+            numThreads = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--tuples")) {
+            numTuplesPerThread = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--run")) {
+            numRuns = stoull(getArgumentValue(arg));
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    if (numThreads == 0 || numTuplesPerThread == 0 || numRuns == 0) {
+        printf("--threads, --tuples and --run must be positive");
+        return 1;
+    }
+    printf("%lu NUMA node(s), %lu threads, %lu tuples per thread\n",
+        (unsigned long)VMRegion::getNumNUMANodes(), (unsigned long)numThreads,
+        (unsigned long)numTuplesPerThread);
+    printf("%10s %10s %16s %16s %16s %16s\n", "policy", "hugepages", "materialize (ms)",
+        "remote (%)", "build (ms)", "remote (%)");
+    for (auto policy : {NUMAPolicy::DEFAULT, NUMAPolicy::LOCAL, NUMAPolicy::INTERLEAVE}) {
+        for (auto useHugePages : {false, true}) {
+            runBenchmark(VMRegionConfig{useHugePages, policy}, numThreads, numTuplesPerThread,
+                numRuns);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "common/constants.h"
+#include "common/string_utils.h"
+#include "main/kuzu.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+// Measures how long recovering a database takes with each number of threads. The database has a
+// node table with an INT64 primary key and INT64 columns, which are all updated by a single write
+// transaction that is committed without being checkpointed, as if the database crashed right
+// after the commit. Each run copies the crashed database and opens the copy, which replays the WAL.
+// The size of the WAL grows with the number of rows and columns: 100M rows with 2 columns give a
+// WAL of a few GB.
+//
+// Usage: kuzu_wal_recovery_benchmark [--path=<dir>] [--rows=<num rows>] [--columns=<num columns>]
+//     [--threads=<max num threads>] [--run=<num runs>]
+
+static constexpr uint64_t BUFFER_POOL_SIZE = 1ull << 32;
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+static void query(Connection& conn, const std::string& statement) {
+    auto result = conn.query(statement);
+    if (!result->isSuccess()) {
+        throw std::runtime_error(statement + ": " + result->getErrorMessage());
+    }
+}
+
+static uint64_t getWALSize(const std::filesystem::path& databasePath) {
+    uint64_t size = 0;
+    for (auto& entry : std::filesystem::directory_iterator(databasePath)) {
+        if (entry.path().extension() == StorageConstants::WAL_FILE_SUFFIX) {
+            size += entry.file_size();
+        }
+    }
+    return size;
+}
+
+static void createCrashedDatabase(
+    const std::filesystem::path& path, uint64_t numRows, uint64_t numColumns) {
+    auto csvPath = path / "rows.csv";
+    {
+        std::ofstream csv(csvPath);
+        for (auto i = 0u; i < numRows; i++) {
+            csv << i;
+            for (auto j = 0u; j < numColumns; j++) {
+                csv << ',' << i;
+            }
+            csv << '\n';
+        }
+    }
+    Database database((path / "crashed").string(), SystemConfig(BUFFER_POOL_SIZE));
+    Connection conn(&database);
+    std::string columns = "id INT64";
+    std::string updates;
+    for (auto j = 0u; j < numColumns; j++) {
+        columns += ", c" + std::to_string(j) + " INT64";
+        updates += (j == 0 ? "" : ", ") + std::string("t.c") + std::to_string(j) + " = t.c" +
+                   std::to_string(j) + " + 1";
+    }
+    query(conn, "CREATE NODE TABLE t(" + columns + ", PRIMARY KEY (id))");
+    query(conn, "COPY t FROM \"" + csvPath.string() + "\"");
+    query(conn, "BEGIN TRANSACTION");
+    query(conn, "MATCH (t:t) SET " + updates);
+    query(conn, "COMMIT_SKIP_CHECKPOINT");
+}
+
+// Returns the time to open the database in seconds.
+static double recover(const std::filesystem::path& path, uint64_t numThreads) {
+    auto runPath = path / "run";
+    std::filesystem::remove_all(runPath);
+    std::filesystem::copy(path / "crashed", runPath, std::filesystem::copy_options::recursive);
+    auto start = std::chrono::steady_clock::now();
+    {
+        Database database(runPath.string(), SystemConfig(BUFFER_POOL_SIZE, numThreads));
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::filesystem::remove_all(runPath);
+    return elapsed.count();
+}
+
+int main(int argc, char** argv) {
+    std::string path = "wal_recovery_benchmark";
+    uint64_t numRows = 1 << 24;
+    uint64_t numColumns = 2;
+    uint64_t maxNumThreads = std::thread::hardware_concurrency();
+    uint64_t numRuns = 3;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--path")) {
+            path = getArgumentValue(arg);
+        } else if (arg.starts_with("--rows")) {
+            numRows = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--columns")) {
+            numColumns = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--threads")) {
+            maxNumThreads = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--run")) {
+            numRuns = stoull(getArgumentValue(arg));
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    if (numRows == 0 || numColumns == 0 || maxNumThreads == 0 || numRuns == 0) {
+        printf("--rows, --columns, --threads and --run must be positive");
+        return 1;
+    }
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+    createCrashedDatabase(path, numRows, numColumns);
+    printf("%lu rows, %lu columns, WAL of %.2f MB\n", (unsigned long)numRows,
+        (unsigned long)numColumns, getWALSize(std::filesystem::path{path} / "crashed") / 1e6);
+    printf("%10s %16s %10s\n", "threads", "recovery (s)", "speedup");
+    double singleThreadTime = 0;
+    for (auto numThreads = 1u; numThreads <= maxNumThreads; numThreads *= 2) {
+        double time = 0;
+        for (auto run = 0u; run < numRuns; run++) {
+            time += recover(path, numThreads);
+        }
+        time /= numRuns;
+        if (numThreads == 1) {
+            singleThreadTime = time;
+        }
+        printf("%10lu %16.3f %10.2f\n", (unsigned long)numThreads, time, singleThreadTime / time);
+    }
+    std::filesystem::remove_all(path);
+    return 0;
+}
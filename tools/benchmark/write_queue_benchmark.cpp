@@ -0,0 +1,137 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/string_utils.h"
+#include "main/kuzu.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+// Measures the throughput of small auto-committed write transactions issued from multiple
+// connections, each inserting a single node. Without a write transaction wait timeout, a
+// transaction started while another one is active fails, and the connection retries it until it
+// succeeds. With the timeout, the transaction waits in the write transaction queue instead.
+//
+// Usage: kuzu_write_queue_benchmark [--path=<dir>] [--threads=<max num connections>]
+//     [--transactions=<num transactions per connection>] [--run=<num runs>]
+
+static constexpr uint64_t BUFFER_POOL_SIZE = 1ull << 30;
+static constexpr uint64_t WRITE_TRANSACTION_WAIT_TIMEOUT_IN_MICROS = 600000000; // 10min
+
+struct WorkloadResult {
+    // The number of committed transactions per second.
+    double throughput;
+    // The number of failed attempts per committed transaction.
+    double numRetries;
+};
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+static void query(Connection& conn, const std::string& statement) {
+    auto result = conn.query(statement);
+    if (!result->isSuccess()) {
+        throw std::runtime_error(statement + ": " + result->getErrorMessage());
+    }
+}
+
+static WorkloadResult runWorkload(const std::filesystem::path& path, bool queueWrites,
+    uint64_t numThreads, uint64_t numTransactions) {
+    std::filesystem::remove_all(path);
+    auto systemConfig = SystemConfig(BUFFER_POOL_SIZE);
+    if (queueWrites) {
+        systemConfig.writeTransactionWaitTimeoutInMicros = WRITE_TRANSACTION_WAIT_TIMEOUT_IN_MICROS;
+    }
+    WorkloadResult workloadResult{};
+    {
+        Database database(path.string(), systemConfig);
+        Connection conn(&database);
+        query(conn, "CREATE NODE TABLE t(id INT64, PRIMARY KEY (id))");
+        std::atomic<uint64_t> numRetries{0};
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (auto threadIdx = 0u; threadIdx < numThreads; threadIdx++) {
+            threads.emplace_back([&, threadIdx]() {
+                Connection connection(&database);
+                for (auto i = 0u; i < numTransactions; i++) {
+                    auto statement =
+                        "CREATE (:t {id: " + std::to_string(threadIdx * numTransactions + i) + "})";
+                    while (true) {
+                        auto result = connection.query(statement);
+                        if (result->isSuccess()) {
+                            break;
+                        }
+                        if (queueWrites || result->getErrorMessage().find(
+                                               "Only one write transaction") == std::string::npos) {
+                            throw std::runtime_error(statement + ": " + result->getErrorMessage());
+                        }
+                        numRetries++;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        auto numCommitted = numThreads * numTransactions;
+        workloadResult.throughput = numCommitted / elapsed.count();
+        workloadResult.numRetries = (double)numRetries.load() / numCommitted;
+    }
+    std::filesystem::remove_all(path);
+    return workloadResult;
+}
+
+int main(int argc, char** argv) {
+    std::string path = "write_queue_benchmark";
+    uint64_t maxNumThreads = std::thread::hardware_concurrency();
+    uint64_t numTransactions = 200;
+    uint64_t numRuns = 3;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--path")) {
+            path = getArgumentValue(arg);
+        } else if (arg.starts_with("--threads")) {
+            maxNumThreads = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--transactions")) {
+            numTransactions = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--run")) {
+            numRuns = stoull(getArgumentValue(arg));
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    if (maxNumThreads == 0 || numTransactions == 0 || numRuns == 0) {
+        printf("--threads, --transactions and --run must be positive");
+        return 1;
+    }
+    printf("%lu transactions per connection\n", (unsigned long)numTransactions);
+    printf("%12s %16s %16s %14s %10s\n", "connections", "retry (txn/s)", "queue (txn/s)",
+        "retries/txn", "speedup");
+    for (auto numThreads = 1u; numThreads <= maxNumThreads; numThreads *= 2) {
+        WorkloadResult retryResult{};
+        WorkloadResult queueResult{};
+        for (auto run = 0u; run < numRuns; run++) {
+            auto result = runWorkload(path, false /* queueWrites */, numThreads, numTransactions);
+            retryResult.throughput += result.throughput;
+            retryResult.numRetries += result.numRetries;
+            result = runWorkload(path, true /* queueWrites */, numThreads, numTransactions);
+            queueResult.throughput += result.throughput;
+        }
+        printf("%12lu %16.1f %16.1f %14.1f %10.2f\n", (unsigned long)numThreads,
+            retryResult.throughput / numRuns, queueResult.throughput / numRuns,
+            retryResult.numRetries / numRuns, queueResult.throughput / retryResult.throughput);
+    }
+    return 0;
+}
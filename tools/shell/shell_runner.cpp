@@ -24,6 +24,23 @@ int main(int argc, char* argv[]) {
         parser, "", "Path to directory for shell history", {'p'});
     args::Flag version(
         parser, "version", "Display current database version", {'v', "version"});
+    args::ValueFlag<std::string> spillDirFlag(parser, "",
+        "Directory to spill intermediate results to when they exceed the buffer pool",
+        {"spillDir"});
+    args::ValueFlag<uint64_t> maxSpillSizeInMBFlag(parser, "",
+        "Max size of spilled intermediate results in megabytes", {"maxSpillSize"}, -1u);
+    args::ValueFlag<std::string> evictionPolicyFlag(parser, "",
+        "Buffer pool eviction policy (2Q or FIFO)", {"evictionPolicy"}, "2Q");
+    args::Flag hugePages(parser, "hugePages",
+        "Use transparent huge pages for intermediate results", {"hugePages"});
+    args::ValueFlag<std::string> numaPolicyFlag(parser, "",
+        "NUMA placement of the buffer pool (DEFAULT, LOCAL or INTERLEAVE)", {"numaPolicy"},
+        "DEFAULT");
+    args::Flag warmUpBufferPool(parser, "warmUpBufferPool",
+        "Reload the pages cached in the buffer pool when the database was last closed",
+        {"warmUpBufferPool"});
+    args::Flag checkpointInBackground(parser, "checkpointInBackground",
+        "Checkpoint committed transactions in the background", {"checkpointInBackground"});
     try {
         parser.ParseCLI(argc, argv);
     } catch (std::exception& e) {
@@ -39,6 +56,16 @@ int main(int argc, char* argv[]) {
         bpSizeInBytes = bpSizeInMB << 20;
     }
     SystemConfig systemConfig(bpSizeInBytes);
+    systemConfig.spillDirectory = args::get(spillDirFlag);
+    uint64_t maxSpillSizeInMB = args::get(maxSpillSizeInMBFlag);
+    if (maxSpillSizeInMB != -1u) {
+        systemConfig.maxSpillSize = maxSpillSizeInMB << 20;
+    }
+    systemConfig.evictionPolicy = args::get(evictionPolicyFlag);
+    systemConfig.useHugePages = args::get(hugePages);
+    systemConfig.numaPolicy = args::get(numaPolicyFlag);
+    systemConfig.warmUpBufferPool = args::get(warmUpBufferPool);
+    systemConfig.checkpointInBackground = args::get(checkpointInBackground);
     if (disableCompression) {
         systemConfig.enableCompression = false;
     }